@@ -15,16 +15,98 @@
 
 #include "adapter/ohos/entrance/file_asset_provider.h"
 
+#include <cerrno>
 #include <cstring>
 #include <dirent.h>
+#include <fcntl.h>
 #include <limits>
 #include <mutex>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 
 #include "base/log/ace_trace.h"
 #include "base/log/log.h"
 
 namespace OHOS::Ace {
+namespace {
+
+// Small files are read into memory, mapping them wastes most of the page.
+constexpr size_t MMAP_SIZE_THRESHOLD = 16 * 1024;
+constexpr size_t MAX_INDEXED_ASSET_COUNT = 20000;
+constexpr int32_t MAX_INDEX_DEPTH = 16;
+// Expired assets are removed when a shard holds more assets than this.
+constexpr size_t ASSET_SHARD_PRUNE_SIZE = 64;
+
+} // namespace
+
+// Content of an asset file, which is mapped to memory if the file is large.
+class FileAssetData final {
+public:
+    FileAssetData(void* address, size_t size) : mappedAddress_(address), size_(size) {}
+    FileAssetData(std::unique_ptr<uint8_t[]> buffer, size_t size) : buffer_(std::move(buffer)), size_(size) {}
+    ~FileAssetData()
+    {
+        if (mappedAddress_ != nullptr) {
+            munmap(mappedAddress_, size_);
+        }
+    }
+
+    static std::shared_ptr<const FileAssetData> Load(const std::string& fileName)
+    {
+        int32_t fd = open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return nullptr;
+        }
+        std::unique_ptr<int32_t, void (*)(int32_t*)> fdGuard(&fd, [](int32_t* fdPtr) { close(*fdPtr); });
+        struct stat statBuf {};
+        if (fstat(fd, &statBuf) != 0 || !S_ISREG(statBuf.st_mode)) {
+            return nullptr;
+        }
+        auto size = static_cast<size_t>(statBuf.st_size);
+        if (size >= MMAP_SIZE_THRESHOLD) {
+            void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED) {
+                return std::make_shared<FileAssetData>(address, size);
+            }
+            LOGW("mmap asset failed, errno: %{public}d, read it instead", errno);
+        }
+        std::unique_ptr<uint8_t[]> buffer(new (std::nothrow) uint8_t[size]);
+        if (buffer == nullptr) {
+            LOGE("new uint8_t array failed");
+            return nullptr;
+        }
+        size_t offset = 0;
+        while (offset < size) {
+            auto result = read(fd, buffer.get() + offset, size - offset);
+            if (result < 0 && errno == EINTR) {
+                continue;
+            }
+            if (result <= 0) {
+                LOGE("read file failed");
+                return nullptr;
+            }
+            offset += static_cast<size_t>(result);
+        }
+        return std::make_shared<FileAssetData>(std::move(buffer), size);
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+    const uint8_t* GetData() const
+    {
+        return mappedAddress_ != nullptr ? static_cast<const uint8_t*>(mappedAddress_) : buffer_.get();
+    }
+
+private:
+    void* mappedAddress_ = nullptr;
+    std::unique_ptr<uint8_t[]> buffer_;
+    size_t size_ = 0;
+};
 
 bool FileAssetProvider::Initialize(const std::string& packagePath, const std::vector<std::string>& assetBasePaths)
 {
@@ -39,6 +121,68 @@ bool FileAssetProvider::Initialize(const std::string& packagePath, const std::ve
     return true;
 }
 
+const std::unordered_map<std::string, uint32_t>& FileAssetProvider::GetAssetIndex() const
+{
+    // Walking the package takes a while, do it when the first asset is loaded instead of on initialization.
+    std::call_once(assetIndexFlag_, [this] { BuildAssetIndex(); });
+    return assetIndex_;
+}
+
+void FileAssetProvider::BuildAssetIndex() const
+{
+    ACE_SCOPED_TRACE("BuildAssetIndex");
+    assetIndex_.clear();
+    size_t assetCount = 0;
+    for (uint32_t index = 0; index < assetBasePaths_.size(); ++index) {
+        std::string directory = packagePath_ + assetBasePaths_[index];
+        // Asset name is appended to the base path directly, so only base paths of directories are indexed.
+        if (directory.empty() || directory.back() != '/') {
+            continue;
+        }
+        if (!IndexDirectory(directory, "", index, 0, assetCount)) {
+            LOGW("too many assets, index is incomplete");
+            break;
+        }
+    }
+    LOGD("indexed %{public}d assets", static_cast<int32_t>(assetIndex_.size()));
+}
+
+bool FileAssetProvider::IndexDirectory(const std::string& directory, const std::string& relativePath,
+    uint32_t basePathIndex, int32_t depth, size_t& assetCount) const
+{
+    if (depth > MAX_INDEX_DEPTH) {
+        return true;
+    }
+    std::unique_ptr<DIR, decltype(&closedir)> dir(opendir((directory + relativePath).c_str()), closedir);
+    if (dir == nullptr) {
+        return true;
+    }
+    struct dirent* dptr = nullptr;
+    while ((dptr = readdir(dir.get())) != nullptr) {
+        if (strcmp(dptr->d_name, ".") == 0 || strcmp(dptr->d_name, "..") == 0) {
+            continue;
+        }
+        std::string name = relativePath + dptr->d_name;
+        bool isDirectory = dptr->d_type == DT_DIR;
+        if (dptr->d_type == DT_UNKNOWN || dptr->d_type == DT_LNK) {
+            struct stat statBuf {};
+            isDirectory = stat((directory + name).c_str(), &statBuf) == 0 && S_ISDIR(statBuf.st_mode);
+        }
+        if (isDirectory) {
+            if (!IndexDirectory(directory, name + "/", basePathIndex, depth + 1, assetCount)) {
+                return false;
+            }
+            continue;
+        }
+        if (++assetCount > MAX_INDEXED_ASSET_COUNT) {
+            return false;
+        }
+        // Base paths are probed in order, keep the first one.
+        assetIndex_.emplace(std::move(name), basePathIndex);
+    }
+    return true;
+}
+
 bool FileAssetProvider::IsValid() const
 {
     return true;
@@ -46,70 +190,89 @@ bool FileAssetProvider::IsValid() const
 
 class FileAssetMapping : public fml::Mapping {
 public:
-    FileAssetMapping(std::unique_ptr<uint8_t[]> data, size_t size) : data_(std::move(data)), size_(size) {}
+    explicit FileAssetMapping(std::shared_ptr<const FileAssetData> data) : data_(std::move(data)) {}
 
     ~FileAssetMapping() override = default;
 
     size_t GetSize() const override
     {
-        return size_;
+        return data_->GetSize();
     }
 
     const uint8_t* GetMapping() const override
     {
-        return data_.get();
+        return data_->GetData();
     }
 
 private:
-    std::unique_ptr<uint8_t[]> data_ = nullptr;
-    size_t size_ = 0;
+    std::shared_ptr<const FileAssetData> data_;
 };
 
-std::unique_ptr<fml::Mapping> FileAssetProvider::GetAsMapping(const std::string& assetName) const
+std::shared_ptr<const FileAssetData> FileAssetProvider::LoadAsset(const std::string& assetName) const
 {
-    ACE_SCOPED_TRACE("GetAsMapping");
-    LOGD("assert name is: %{public}s", assetName.c_str());
-    std::lock_guard<std::mutex> lock(mutex_);
-
-    for (const auto& basePath : assetBasePaths_) {
-        std::string fileName = packagePath_ + basePath + assetName;
-        std::FILE* fp = std::fopen(fileName.c_str(), "r");
-        if (fp == nullptr) {
-            continue;
+    const auto& assetIndex = GetAssetIndex();
+    auto iter = assetIndex.find(assetName);
+    if (iter != assetIndex.end()) {
+        auto data = FileAssetData::Load(packagePath_ + assetBasePaths_[iter->second] + assetName);
+        if (data) {
+            return data;
         }
-
-        if (std::fseek(fp, 0, SEEK_END) != 0) {
-            LOGE("seek file tail error");
-            std::fclose(fp);
-            continue;
+    }
+    // Not indexed, such as names not normalized, probe every base path.
+    for (const auto& basePath : assetBasePaths_) {
+        auto data = FileAssetData::Load(packagePath_ + basePath + assetName);
+        if (data) {
+            return data;
         }
+    }
+    return nullptr;
+}
 
-        int64_t size = std::ftell(fp);
-        uint8_t* dataArray = new (std::nothrow) uint8_t[size];
-        if (dataArray == nullptr) {
-            LOGE("new uint8_t array failed");
-            std::fclose(fp);
-            continue;
+std::unique_ptr<fml::Mapping> FileAssetProvider::GetAsMapping(const std::string& assetName) const
+{
+    ACE_SCOPED_TRACE("GetAsMapping");
+    LOGD("assert name is: %{public}s", assetName.c_str());
+    auto& shard = assetShards_[std::hash<std::string>()(assetName) % ASSET_SHARD_COUNT];
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.assets.find(assetName);
+        if (iter != shard.assets.end()) {
+            auto data = iter->second.lock();
+            if (data) {
+                return std::make_unique<FileAssetMapping>(std::move(data));
+            }
         }
+    }
 
-        rewind(fp);
-        std::unique_ptr<uint8_t[]> data(dataArray);
-        size_t result = std::fread(data.get(), 1, size, fp);
-        if (result != (size_t)size) {
-            LOGE("read file failed");
-            std::fclose(fp);
-            continue;
+    // Load the file without lock, assets in the same shard are loaded in parallel.
+    auto data = LoadAsset(assetName);
+    if (!data) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto& cached = shard.assets[assetName];
+    auto cachedData = cached.lock();
+    if (cachedData) {
+        // Loaded by another thread at the same time.
+        data = std::move(cachedData);
+    } else {
+        cached = data;
+    }
+    if (shard.assets.size() > ASSET_SHARD_PRUNE_SIZE) {
+        for (auto iter = shard.assets.begin(); iter != shard.assets.end();) {
+            iter = iter->second.expired() ? shard.assets.erase(iter) : std::next(iter);
         }
-
-        fclose(fp);
-        return std::make_unique<FileAssetMapping>(std::move(data), size);
     }
-    return nullptr;
+    return std::make_unique<FileAssetMapping>(std::move(data));
 }
 
 std::string FileAssetProvider::GetAssetPath(const std::string& assetName)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    const auto& assetIndex = GetAssetIndex();
+    auto iter = assetIndex.find(assetName);
+    if (iter != assetIndex.end()) {
+        return packagePath_ + assetBasePaths_[iter->second];
+    }
     for (const auto& basePath : assetBasePaths_) {
         std::string assetBasePath = packagePath_ + basePath;
         std::string fileName = assetBasePath + assetName;
@@ -126,7 +289,6 @@ std::string FileAssetProvider::GetAssetPath(const std::string& assetName)
 
 void FileAssetProvider::GetAssetList(const std::string& path, std::vector<std::string>& assetList)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
     for (const auto& basePath : assetBasePaths_) {
         std::string assetPath = packagePath_ + basePath + path;
         std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(assetPath.c_str()), closedir);
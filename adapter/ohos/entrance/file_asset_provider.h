@@ -16,7 +16,10 @@
 #ifndef FOUNDATION_ACE_ADAPTER_OHOS_CPP_FILE_ASSET_PROVIDER_H
 #define FOUNDATION_ACE_ADAPTER_OHOS_CPP_FILE_ASSET_PROVIDER_H
 
+#include <array>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -30,6 +33,8 @@
 
 namespace OHOS::Ace {
 
+class FileAssetData;
+
 class ACE_EXPORT FileAssetProvider : public FlutterAssetProvider {
     DECLARE_ACE_TYPE(FileAssetProvider, FlutterAssetProvider);
 
@@ -37,6 +42,7 @@ public:
     FileAssetProvider() = default;
     ~FileAssetProvider() override = default;
 
+    // Must be called before the provider is shared with other threads. The asset index is built on the first lookup.
     bool Initialize(const std::string& packagePath, const std::vector<std::string>& assetBasePaths);
 
     std::unique_ptr<fml::Mapping> GetAsMapping(const std::string& assetName) const override;
@@ -48,9 +54,26 @@ public:
     void GetAssetList(const std::string& path, std::vector<std::string>& assetList) override;
 
 private:
-    mutable std::mutex mutex_;
+    static constexpr size_t ASSET_SHARD_COUNT = 16;
+
+    // Loaded assets are shared by mappings of the same asset, and released with the last mapping.
+    struct AssetShard {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::weak_ptr<const FileAssetData>> assets;
+    };
+
+    const std::unordered_map<std::string, uint32_t>& GetAssetIndex() const;
+    void BuildAssetIndex() const;
+    bool IndexDirectory(const std::string& directory, const std::string& relativePath, uint32_t basePathIndex,
+        int32_t depth, size_t& assetCount) const;
+    std::shared_ptr<const FileAssetData> LoadAsset(const std::string& assetName) const;
+
     std::string packagePath_;
     std::vector<std::string> assetBasePaths_;
+    // Asset name to the index of the first base path which contains it, read only after it is built.
+    mutable std::unordered_map<std::string, uint32_t> assetIndex_;
+    mutable std::once_flag assetIndexFlag_;
+    mutable std::array<AssetShard, ASSET_SHARD_COUNT> assetShards_;
 };
 
 } // namespace OHOS::Ace
@@ -47,6 +47,7 @@
 #include "core/common/container_scope.h"
 #include "core/common/flutter/flutter_asset_manager.h"
 #include "core/common/plugin_manager.h"
+#include "core/image/animated_image_player.h"
 
 namespace OHOS::Ace {
 namespace {
@@ -960,6 +961,7 @@ void UIContentImpl::SetNextFrameLayoutCallback(std::function<void()>&& callback)
 void UIContentImpl::NotifyMemoryLevel(int32_t level)
 {
     LOGI("Receive memory level notification, level: %{public}d", level);
+    AnimatedImagePlayer::ReleaseFrameBuffers();
 }
 
 } // namespace OHOS::Ace
@@ -136,6 +136,28 @@ bool IsGpuUploadEnabled()
             system::GetParameter("debug.ace.gpuupload.enabled", "0") == "1");
 }
 
+bool IsParallelLayoutEnabled()
+{
+    return (system::GetParameter("persist.ace.parallel.layout.enabled", "0") == "1" ||
+            system::GetParameter("debug.ace.parallel.layout.enabled", "0") == "1");
+}
+
+bool IsParallelRenderEnabled()
+{
+    return (system::GetParameter("persist.ace.parallel.render.enabled", "0") == "1" ||
+            system::GetParameter("debug.ace.parallel.render.enabled", "0") == "1");
+}
+
+bool IsTouchCoalesceEnabled()
+{
+    return system::GetParameter("persist.ace.touch.coalesce.enabled", "1") == "1";
+}
+
+bool IsTouchResampleEnabled()
+{
+    return system::GetParameter("persist.ace.touch.resample.enabled", "0") == "1";
+}
+
 void OnAnimationScaleChanged(const char *key, const char *value, void *context)
 {
     if (key == nullptr) {
@@ -250,6 +272,10 @@ bool SystemProperties::debugBoundaryEnabled_ = false;
 bool SystemProperties::windowAnimationEnabled_ = IsWindowAnimationEnabled();
 bool SystemProperties::debugEnabled_ = IsDebugEnabled();
 bool SystemProperties::gpuUploadEnabled_ = IsGpuUploadEnabled();
+bool SystemProperties::parallelLayoutEnabled_ = IsParallelLayoutEnabled();
+bool SystemProperties::parallelRenderEnabled_ = IsParallelRenderEnabled();
+bool SystemProperties::touchCoalesceEnabled_ = IsTouchCoalesceEnabled();
+bool SystemProperties::touchResampleEnabled_ = IsTouchResampleEnabled();
 
 DeviceType SystemProperties::GetDeviceType()
 {
@@ -303,6 +329,10 @@ void SystemProperties::InitDeviceInfo(
     accessibilityEnabled_ = IsAccessibilityEnabled();
     rosenBackendEnabled_ = IsRosenBackendEnabled();
     isHookModeEnabled_ = IsHookModeEnabled();
+    parallelLayoutEnabled_ = IsParallelLayoutEnabled();
+    parallelRenderEnabled_ = IsParallelRenderEnabled();
+    touchCoalesceEnabled_ = IsTouchCoalesceEnabled();
+    touchResampleEnabled_ = IsTouchResampleEnabled();
     debugBoundaryEnabled_ = system::GetParameter(ENABLE_DEBUG_BOUNDARY_KEY, "false") == "true";
     animationScale_ = std::atof(system::GetParameter(ANIMATION_SCALE_KEY, "1").c_str());
     WatchParameter(ANIMATION_SCALE_KEY, OnAnimationScaleChanged, nullptr);
@@ -85,6 +85,10 @@ bool SystemProperties::rosenBackendEnabled_ = false;
 bool SystemProperties::windowAnimationEnabled_ = false;
 bool SystemProperties::debugBoundaryEnabled_ = false;
 bool SystemProperties::gpuUploadEnabled_ = false;
+bool SystemProperties::parallelLayoutEnabled_ = false;
+bool SystemProperties::parallelRenderEnabled_ = false;
+bool SystemProperties::touchCoalesceEnabled_ = true;
+bool SystemProperties::touchResampleEnabled_ = false;
 bool SystemProperties::isHookModeEnabled_ = false;
 
 bool SystemProperties::GetDebugBoundaryEnabled()
@@ -16,7 +16,10 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_GEOMETRY_CALC_DIMENSION_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_GEOMETRY_CALC_DIMENSION_H
 
+#include <memory>
+
 #include "base/geometry/dimension.h"
+#include "base/utils/string_expression.h"
 
 namespace OHOS::Ace {
 class CalcDimension : public Dimension {
@@ -26,7 +29,7 @@ public:
 
     explicit CalcDimension(const std::string& value, DimensionUnit unit = DimensionUnit::CALC)
     {
-        calcvalue_ = value;
+        SetCalcValue(value);
         SetUnit(DimensionUnit::CALC);
     };
 
@@ -41,6 +44,16 @@ public:
     void SetCalcValue(const std::string& value)
     {
         calcvalue_ = value;
+        // Compile once here, so the expression is evaluated without parsing in layout.
+        calcProgram_ = value.empty()
+                           ? nullptr
+                           : std::make_shared<const StringExpression::CalcProgram>(StringExpression::CompileExp(value));
+    }
+
+    const StringExpression::CalcProgram& GetCalcProgram() const
+    {
+        static const StringExpression::CalcProgram emptyProgram;
+        return calcProgram_ ? *calcProgram_ : emptyProgram;
     }
 
     CalcDimension& operator=(const Dimension& newDimension)
@@ -52,7 +65,8 @@ public:
 
     CalcDimension& operator=(const CalcDimension& newDimension)
     {
-        SetCalcValue(newDimension.CalcValue());
+        calcvalue_ = newDimension.calcvalue_;
+        calcProgram_ = newDimension.calcProgram_;
         SetValue(newDimension.Value());
         SetUnit(newDimension.Unit());
         return *this;
@@ -60,6 +74,8 @@ public:
 
 private:
     std::string calcvalue_ = "";
+    // Shared by copies of the dimension, it is immutable after compiled.
+    std::shared_ptr<const StringExpression::CalcProgram> calcProgram_;
 };
 } // namespace OHOS::Ace
 
@@ -0,0 +1,665 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/json/json_view.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+#include "base/log/log.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// max depth of nested arrays and objects, same as cJSON.
+constexpr int32_t NESTING_LIMIT = 1000;
+// integers with less digits are exact in double.
+constexpr size_t MAX_FAST_DIGITS = 15;
+constexpr size_t NUMBER_BUFFER_SIZE = 64;
+constexpr uint32_t HIGH_SURROGATE_MIN = 0xD800;
+constexpr uint32_t HIGH_SURROGATE_MAX = 0xDBFF;
+constexpr uint32_t LOW_SURROGATE_MIN = 0xDC00;
+constexpr uint32_t LOW_SURROGATE_MAX = 0xDFFF;
+
+bool IsNumberChar(char ch)
+{
+    return (ch >= '0' && ch <= '9') || ch == '+' || ch == '-' || ch == '.' || ch == 'e' || ch == 'E';
+}
+
+int32_t HexValue(char ch)
+{
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + 10;
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    }
+    return -1;
+}
+
+void AppendUtf8(std::string& output, uint32_t codePoint)
+{
+    if (codePoint < 0x80) {
+        output.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        output.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint < 0x10000) {
+        output.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else {
+        output.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        output.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+} // namespace
+
+// Recursive descent parser which appends nodes in pre-order, so the first child of a node is the next node.
+class JsonParser final {
+public:
+    JsonParser(JsonDocument& document, std::string_view text) : document_(document), text_(text) {}
+    ~JsonParser() = default;
+
+    bool Parse()
+    {
+        SkipWhitespace();
+        if (!ParseValue(0)) {
+            LOGD("Parse json failed at %{public}u", static_cast<uint32_t>(position_));
+            return false;
+        }
+        SkipWhitespace();
+        if (position_ != text_.size()) {
+            LOGD("Parse json failed, unexpected content at %{public}u", static_cast<uint32_t>(position_));
+            return false;
+        }
+        return true;
+    }
+
+private:
+    void SkipWhitespace()
+    {
+        // same as cJSON, all control characters are whitespace.
+        while (position_ < text_.size() && static_cast<unsigned char>(text_[position_]) <= ' ') {
+            ++position_;
+        }
+    }
+
+    bool Consume(char ch)
+    {
+        if (position_ < text_.size() && text_[position_] == ch) {
+            ++position_;
+            return true;
+        }
+        return false;
+    }
+
+    bool ConsumeLiteral(std::string_view literal)
+    {
+        if (text_.substr(position_, literal.size()) != literal) {
+            return false;
+        }
+        position_ += literal.size();
+        return true;
+    }
+
+    bool ParseValue(int32_t depth)
+    {
+        if (position_ >= text_.size()) {
+            return false;
+        }
+        uint32_t index = static_cast<uint32_t>(document_.nodes_.size());
+        document_.nodes_.emplace_back();
+        document_.nodes_[index].rawBegin = static_cast<uint32_t>(position_);
+        bool result = false;
+        switch (text_[position_]) {
+            case '{':
+                result = ParseObject(index, depth);
+                break;
+            case '[':
+                result = ParseArray(index, depth);
+                break;
+            case '"':
+                result = ParseStringValue(index);
+                break;
+            case 'n':
+                result = ParseLiteral(index, "null", JsonType::NULL_VALUE);
+                break;
+            case 't':
+                result = ParseLiteral(index, "true", JsonType::TRUE_VALUE);
+                break;
+            case 'f':
+                result = ParseLiteral(index, "false", JsonType::FALSE_VALUE);
+                break;
+            default:
+                result = ParseNumber(index);
+                break;
+        }
+        auto& node = document_.nodes_[index];
+        node.rawLength = static_cast<uint32_t>(position_) - node.rawBegin;
+        return result;
+    }
+
+    bool ParseLiteral(uint32_t index, std::string_view literal, JsonType type)
+    {
+        document_.nodes_[index].type = type;
+        return ConsumeLiteral(literal);
+    }
+
+    bool ParseNumber(uint32_t index)
+    {
+        size_t begin = position_;
+        while (position_ < text_.size() && IsNumberChar(text_[position_])) {
+            ++position_;
+        }
+        auto number = text_.substr(begin, position_ - begin);
+        if (number.empty()) {
+            return false;
+        }
+        auto& node = document_.nodes_[index];
+        node.type = JsonType::NUMBER;
+        // integers are parsed directly, strtod needs a terminated copy.
+        bool negative = number[0] == '-';
+        auto digits = number.substr(negative ? 1 : 0);
+        if (!digits.empty() && digits.size() <= MAX_FAST_DIGITS &&
+            std::all_of(digits.begin(), digits.end(), [](char ch) { return ch >= '0' && ch <= '9'; })) {
+            int64_t value = 0;
+            for (char ch : digits) {
+                value = value * 10 + (ch - '0');
+            }
+            node.number = static_cast<double>(negative ? -value : value);
+            return true;
+        }
+        char buffer[NUMBER_BUFFER_SIZE];
+        std::string longNumber;
+        const char* start = buffer;
+        if (number.size() < NUMBER_BUFFER_SIZE) {
+            std::copy(number.begin(), number.end(), buffer);
+            buffer[number.size()] = '\0';
+        } else {
+            longNumber.assign(number);
+            start = longNumber.c_str();
+        }
+        char* end = nullptr;
+        node.number = std::strtod(start, &end);
+        return end == start + number.size();
+    }
+
+    // Parse the content of string into the text range or the decoded buffer.
+    bool ParseString(uint32_t& begin, uint32_t& length, bool& decoded)
+    {
+        if (!Consume('"')) {
+            return false;
+        }
+        size_t start = position_;
+        while (position_ < text_.size() && text_[position_] != '"' && text_[position_] != '\\') {
+            ++position_;
+        }
+        if (position_ >= text_.size()) {
+            return false;
+        }
+        if (text_[position_] == '"') {
+            begin = static_cast<uint32_t>(start);
+            length = static_cast<uint32_t>(position_ - start);
+            decoded = false;
+            ++position_;
+            return true;
+        }
+        auto& output = document_.decoded_;
+        size_t outputStart = output.size();
+        output.append(text_.substr(start, position_ - start));
+        while (position_ < text_.size() && text_[position_] != '"') {
+            char ch = text_[position_++];
+            if (ch != '\\') {
+                output.push_back(ch);
+                continue;
+            }
+            if (!ParseEscape(output)) {
+                return false;
+            }
+        }
+        if (!Consume('"')) {
+            return false;
+        }
+        begin = static_cast<uint32_t>(outputStart);
+        length = static_cast<uint32_t>(output.size() - outputStart);
+        decoded = true;
+        return true;
+    }
+
+    bool ParseEscape(std::string& output)
+    {
+        if (position_ >= text_.size()) {
+            return false;
+        }
+        char ch = text_[position_++];
+        switch (ch) {
+            case '"':
+            case '\\':
+            case '/':
+                output.push_back(ch);
+                return true;
+            case 'b':
+                output.push_back('\b');
+                return true;
+            case 'f':
+                output.push_back('\f');
+                return true;
+            case 'n':
+                output.push_back('\n');
+                return true;
+            case 'r':
+                output.push_back('\r');
+                return true;
+            case 't':
+                output.push_back('\t');
+                return true;
+            case 'u':
+                return ParseUnicodeEscape(output);
+            default:
+                return false;
+        }
+    }
+
+    bool ParseHex4(uint32_t& value)
+    {
+        if (position_ + 4 > text_.size()) {
+            return false;
+        }
+        value = 0;
+        for (size_t index = 0; index < 4; ++index) {
+            int32_t digit = HexValue(text_[position_ + index]);
+            if (digit < 0) {
+                return false;
+            }
+            value = (value << 4) | static_cast<uint32_t>(digit);
+        }
+        position_ += 4;
+        return true;
+    }
+
+    bool ParseUnicodeEscape(std::string& output)
+    {
+        uint32_t codePoint = 0;
+        if (!ParseHex4(codePoint)) {
+            return false;
+        }
+        if (codePoint >= LOW_SURROGATE_MIN && codePoint <= LOW_SURROGATE_MAX) {
+            return false;
+        }
+        if (codePoint >= HIGH_SURROGATE_MIN && codePoint <= HIGH_SURROGATE_MAX) {
+            uint32_t lowSurrogate = 0;
+            if (!ConsumeLiteral("\\u") || !ParseHex4(lowSurrogate) || lowSurrogate < LOW_SURROGATE_MIN ||
+                lowSurrogate > LOW_SURROGATE_MAX) {
+                return false;
+            }
+            codePoint = 0x10000 + (((codePoint & 0x3FF) << 10) | (lowSurrogate & 0x3FF));
+        }
+        AppendUtf8(output, codePoint);
+        return true;
+    }
+
+    bool ParseStringValue(uint32_t index)
+    {
+        uint32_t begin = 0;
+        uint32_t length = 0;
+        bool decoded = false;
+        if (!ParseString(begin, length, decoded)) {
+            return false;
+        }
+        auto& node = document_.nodes_[index];
+        node.type = JsonType::STRING;
+        node.stringBegin = begin;
+        node.stringLength = length;
+        node.decodedString = decoded;
+        return true;
+    }
+
+    bool ParseArray(uint32_t index, int32_t depth)
+    {
+        document_.nodes_[index].type = JsonType::ARRAY;
+        if (depth >= NESTING_LIMIT) {
+            return false;
+        }
+        ++position_;
+        SkipWhitespace();
+        if (Consume(']')) {
+            return true;
+        }
+        uint32_t previous = JsonDocument::NO_NODE;
+        while (true) {
+            uint32_t child = static_cast<uint32_t>(document_.nodes_.size());
+            if (!ParseValue(depth + 1)) {
+                return false;
+            }
+            LinkChild(index, previous, child);
+            previous = child;
+            SkipWhitespace();
+            if (Consume(']')) {
+                return true;
+            }
+            if (!Consume(',')) {
+                return false;
+            }
+            SkipWhitespace();
+        }
+    }
+
+    bool ParseObject(uint32_t index, int32_t depth)
+    {
+        document_.nodes_[index].type = JsonType::OBJECT;
+        if (depth >= NESTING_LIMIT) {
+            return false;
+        }
+        ++position_;
+        SkipWhitespace();
+        if (Consume('}')) {
+            return true;
+        }
+        uint32_t previous = JsonDocument::NO_NODE;
+        while (true) {
+            uint32_t keyBegin = 0;
+            uint32_t keyLength = 0;
+            bool decodedKey = false;
+            if (!ParseString(keyBegin, keyLength, decodedKey)) {
+                return false;
+            }
+            SkipWhitespace();
+            if (!Consume(':')) {
+                return false;
+            }
+            SkipWhitespace();
+            uint32_t child = static_cast<uint32_t>(document_.nodes_.size());
+            if (!ParseValue(depth + 1)) {
+                return false;
+            }
+            auto& childNode = document_.nodes_[child];
+            childNode.keyBegin = keyBegin;
+            childNode.keyLength = keyLength;
+            childNode.decodedKey = decodedKey;
+            LinkChild(index, previous, child);
+            previous = child;
+            SkipWhitespace();
+            if (Consume('}')) {
+                return true;
+            }
+            if (!Consume(',')) {
+                return false;
+            }
+            SkipWhitespace();
+        }
+    }
+
+    void LinkChild(uint32_t parent, uint32_t previous, uint32_t child)
+    {
+        if (previous != JsonDocument::NO_NODE) {
+            document_.nodes_[previous].next = child;
+        }
+        ++document_.nodes_[parent].size;
+    }
+
+    JsonDocument& document_;
+    std::string_view text_;
+    size_t position_ = 0;
+};
+
+std::unique_ptr<JsonDocument> JsonDocument::ParseView(std::string_view text)
+{
+    return ParseDocument(std::unique_ptr<JsonDocument>(new JsonDocument()), text);
+}
+
+std::unique_ptr<JsonDocument> JsonDocument::Parse(std::string&& text)
+{
+    std::unique_ptr<JsonDocument> document(new JsonDocument());
+    document->ownedText_ = std::move(text);
+    std::string_view ownedText = document->ownedText_;
+    return ParseDocument(std::move(document), ownedText);
+}
+
+std::unique_ptr<JsonDocument> JsonDocument::ParseDocument(
+    std::unique_ptr<JsonDocument>&& document, std::string_view text)
+{
+    if (text.size() >= std::numeric_limits<uint32_t>::max()) {
+        LOGW("Parse json failed, text is too long");
+        return nullptr;
+    }
+    document->text_ = text;
+    // a node takes several bytes of text at least.
+    document->nodes_.reserve(text.size() / 8 + 1);
+    JsonParser parser(*document, text);
+    if (!parser.Parse()) {
+        return nullptr;
+    }
+    document->nodes_.shrink_to_fit();
+    return std::move(document);
+}
+
+JsonType JsonView::GetType() const
+{
+    return document_ ? document_->nodes_[index_].type : JsonType::INVALID;
+}
+
+bool JsonView::IsBool() const
+{
+    auto type = GetType();
+    return type == JsonType::TRUE_VALUE || type == JsonType::FALSE_VALUE;
+}
+
+bool JsonView::IsNumber() const
+{
+    return GetType() == JsonType::NUMBER;
+}
+
+bool JsonView::IsString() const
+{
+    return GetType() == JsonType::STRING;
+}
+
+bool JsonView::IsArray() const
+{
+    return GetType() == JsonType::ARRAY;
+}
+
+bool JsonView::IsObject() const
+{
+    return GetType() == JsonType::OBJECT;
+}
+
+bool JsonView::IsValid() const
+{
+    return GetType() != JsonType::INVALID;
+}
+
+bool JsonView::IsNull() const
+{
+    auto type = GetType();
+    return type == JsonType::INVALID || type == JsonType::NULL_VALUE;
+}
+
+bool JsonView::Contains(std::string_view key) const
+{
+    return static_cast<bool>(GetValue(key));
+}
+
+bool JsonView::GetBool() const
+{
+    return GetType() == JsonType::TRUE_VALUE;
+}
+
+bool JsonView::GetBool(std::string_view key, bool defaultValue) const
+{
+    auto value = GetValue(key);
+    return value.IsBool() ? value.GetBool() : defaultValue;
+}
+
+int32_t JsonView::GetInt() const
+{
+    // saturate as cJSON does for valueint.
+    double number = GetDouble();
+    if (number >= static_cast<double>(std::numeric_limits<int32_t>::max())) {
+        return std::numeric_limits<int32_t>::max();
+    }
+    if (number <= static_cast<double>(std::numeric_limits<int32_t>::min())) {
+        return std::numeric_limits<int32_t>::min();
+    }
+    return static_cast<int32_t>(number);
+}
+
+int32_t JsonView::GetInt(std::string_view key, int32_t defaultVal) const
+{
+    auto value = GetValue(key);
+    return value.IsNumber() ? value.GetInt() : defaultVal;
+}
+
+uint32_t JsonView::GetUInt() const
+{
+    double number = GetDouble();
+    if (number >= static_cast<double>(std::numeric_limits<uint32_t>::max())) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    if (number <= 0.0) {
+        return 0;
+    }
+    return static_cast<uint32_t>(number);
+}
+
+uint32_t JsonView::GetUInt(std::string_view key, uint32_t defaultVal) const
+{
+    auto value = GetValue(key);
+    return value.IsNumber() ? value.GetUInt() : defaultVal;
+}
+
+int64_t JsonView::GetInt64() const
+{
+    double number = GetDouble();
+    if (number >= static_cast<double>(std::numeric_limits<int64_t>::max())) {
+        return std::numeric_limits<int64_t>::max();
+    }
+    if (number <= static_cast<double>(std::numeric_limits<int64_t>::min())) {
+        return std::numeric_limits<int64_t>::min();
+    }
+    return static_cast<int64_t>(number);
+}
+
+double JsonView::GetDouble() const
+{
+    return IsNumber() ? document_->nodes_[index_].number : 0.0;
+}
+
+double JsonView::GetDouble(std::string_view key, double defaultVal) const
+{
+    auto value = GetValue(key);
+    return value.IsNumber() ? value.GetDouble() : defaultVal;
+}
+
+std::string_view JsonView::GetStringView() const
+{
+    if (!IsString()) {
+        return std::string_view();
+    }
+    const auto& node = document_->nodes_[index_];
+    return document_->GetText(node.stringBegin, node.stringLength, node.decodedString);
+}
+
+std::string JsonView::GetString() const
+{
+    return std::string(GetStringView());
+}
+
+std::string JsonView::GetString(std::string_view key, const std::string& defaultVal) const
+{
+    auto value = GetValue(key);
+    return value.IsString() ? value.GetString() : defaultVal;
+}
+
+JsonView JsonView::GetNext() const
+{
+    if (!document_ || document_->nodes_[index_].next == JsonDocument::NO_NODE) {
+        return JsonView();
+    }
+    return JsonView(document_, document_->nodes_[index_].next);
+}
+
+JsonView JsonView::GetChild() const
+{
+    if (!document_ || document_->nodes_[index_].size == 0) {
+        return JsonView();
+    }
+    return JsonView(document_, index_ + 1);
+}
+
+std::string_view JsonView::GetKey() const
+{
+    if (!document_) {
+        return std::string_view();
+    }
+    const auto& node = document_->nodes_[index_];
+    return document_->GetText(node.keyBegin, node.keyLength, node.decodedKey);
+}
+
+JsonView JsonView::GetValue(std::string_view key) const
+{
+    if (!IsObject()) {
+        return JsonView();
+    }
+    for (auto child = GetChild(); child; child = child.GetNext()) {
+        if (child.GetKey() == key) {
+            return child;
+        }
+    }
+    return JsonView();
+}
+
+JsonView JsonView::GetObject(std::string_view key) const
+{
+    auto value = GetValue(key);
+    return value.IsObject() ? value : JsonView();
+}
+
+int32_t JsonView::GetArraySize() const
+{
+    // same as cJSON, members of object are counted too.
+    return (IsArray() || IsObject()) ? static_cast<int32_t>(document_->nodes_[index_].size) : 0;
+}
+
+JsonView JsonView::GetArrayItem(int32_t index) const
+{
+    if (index < 0 || index >= GetArraySize()) {
+        return JsonView();
+    }
+    auto child = GetChild();
+    for (int32_t count = 0; count < index; ++count) {
+        child = child.GetNext();
+    }
+    return child;
+}
+
+std::string_view JsonView::GetRawText() const
+{
+    if (!document_) {
+        return std::string_view();
+    }
+    const auto& node = document_->nodes_[index_];
+    return document_->text_.substr(node.rawBegin, node.rawLength);
+}
+
+} // namespace OHOS::Ace
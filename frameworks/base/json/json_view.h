@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_VIEW_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_VIEW_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+class JsonDocument;
+
+enum class JsonType : uint8_t {
+    INVALID = 0,
+    NULL_VALUE,
+    FALSE_VALUE,
+    TRUE_VALUE,
+    NUMBER,
+    STRING,
+    ARRAY,
+    OBJECT,
+};
+
+// Read only view of a value in JsonDocument, it is only valid while the document is alive. Getters have the same
+// names and defaults as JsonValue, but return views by value, so no memory is allocated when the tree is walked.
+// operator-> returns the view itself, so code written for std::unique_ptr<JsonValue> can switch to the view with few
+// changes.
+class ACE_FORCE_EXPORT_WITH_PREVIEW JsonView final {
+public:
+    JsonView() = default;
+    JsonView(const JsonDocument* document, uint32_t index) : document_(document), index_(index) {}
+    ~JsonView() = default;
+
+    const JsonView* operator->() const
+    {
+        return this;
+    }
+
+    // true if the view refers to a value, a missing key or index returns a view which is false.
+    explicit operator bool() const
+    {
+        return document_ != nullptr;
+    }
+
+    // check functions
+    JsonType GetType() const;
+    bool IsBool() const;
+    bool IsNumber() const;
+    bool IsString() const;
+    bool IsArray() const;
+    bool IsObject() const;
+    bool IsValid() const;
+    bool IsNull() const;
+    bool Contains(std::string_view key) const;
+
+    // get functions
+    bool GetBool() const;
+    bool GetBool(std::string_view key, bool defaultValue = false) const;
+    int32_t GetInt() const;
+    int32_t GetInt(std::string_view key, int32_t defaultVal = 0) const;
+    uint32_t GetUInt() const;
+    uint32_t GetUInt(std::string_view key, uint32_t defaultVal = 0) const;
+    int64_t GetInt64() const;
+    double GetDouble() const;
+    double GetDouble(std::string_view key, double defaultVal = 0.0) const;
+    // Returns the decoded string without copy.
+    std::string_view GetStringView() const;
+    std::string GetString() const;
+    std::string GetString(std::string_view key, const std::string& defaultVal = "") const;
+
+    JsonView GetNext() const;
+    JsonView GetChild() const;
+    std::string_view GetKey() const;
+    JsonView GetValue(std::string_view key) const;
+    JsonView GetObject(std::string_view key) const;
+    int32_t GetArraySize() const;
+    JsonView GetArrayItem(int32_t index) const;
+
+    // Returns the text of the value in the input, such as the text of an object passed to another module.
+    std::string_view GetRawText() const;
+
+private:
+    const JsonDocument* document_ = nullptr;
+    uint32_t index_ = 0;
+};
+
+// DOM over a JSON text. Parsing fills a flat array of nodes which refer to the text by offset, strings with escape
+// sequences are decoded once into a side buffer. Values are read through JsonView.
+class ACE_FORCE_EXPORT_WITH_PREVIEW JsonDocument final {
+public:
+    ~JsonDocument() = default;
+
+    // Parse the text without copy, the text must outlive the document. Returns nullptr if the text is not valid json.
+    static std::unique_ptr<JsonDocument> ParseView(std::string_view text);
+    // Parse the text owned by the document.
+    static std::unique_ptr<JsonDocument> Parse(std::string&& text);
+
+    JsonView GetRoot() const
+    {
+        return JsonView(this, 0);
+    }
+
+    size_t GetNodeCount() const
+    {
+        return nodes_.size();
+    }
+
+private:
+    static constexpr uint32_t NO_NODE = 0;
+
+    struct Node {
+        JsonType type = JsonType::INVALID;
+        bool decodedKey = false;
+        bool decodedString = false;
+        // index of the next sibling, NO_NODE for the last child.
+        uint32_t next = NO_NODE;
+        // count of children for array and object.
+        uint32_t size = 0;
+        // text of the whole value.
+        uint32_t rawBegin = 0;
+        uint32_t rawLength = 0;
+        // key of the member of object, in text or decoded buffer.
+        uint32_t keyBegin = 0;
+        uint32_t keyLength = 0;
+        // content of string, in text or decoded buffer.
+        uint32_t stringBegin = 0;
+        uint32_t stringLength = 0;
+        double number = 0.0;
+    };
+
+    JsonDocument() = default;
+    static std::unique_ptr<JsonDocument> ParseDocument(
+        std::unique_ptr<JsonDocument>&& document, std::string_view text);
+
+    std::string_view GetText(uint32_t begin, uint32_t length, bool decoded) const
+    {
+        return decoded ? std::string_view(decoded_).substr(begin, length) : text_.substr(begin, length);
+    }
+
+    std::string ownedText_;
+    std::string_view text_;
+    std::string decoded_;
+    std::vector<Node> nodes_;
+
+    friend class JsonView;
+    friend class JsonParser;
+
+    ACE_DISALLOW_COPY_AND_MOVE(JsonDocument);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_VIEW_H
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/json/json_writer.h"
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+#include "base/log/log.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr size_t NUMBER_BUFFER_SIZE = 32;
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+} // namespace
+
+JsonWriter::JsonWriter(FlushCallback&& flushCallback, size_t flushSize)
+    : flushCallback_(std::move(flushCallback)), flushSize_(flushSize)
+{
+    buffer_.reserve(flushSize_);
+}
+
+JsonWriter::~JsonWriter()
+{
+    if (!scopes_.empty()) {
+        LOGW("JsonWriter is destroyed with %{public}u unclosed scopes", static_cast<uint32_t>(scopes_.size()));
+    }
+    if (flushCallback_) {
+        Flush();
+    }
+}
+
+void JsonWriter::BeginValue()
+{
+    if (afterKey_) {
+        afterKey_ = false;
+        return;
+    }
+    if (scopes_.empty()) {
+        if (hasRoot_) {
+            LOGE("JsonWriter writes more than one root value");
+        }
+        hasRoot_ = true;
+        return;
+    }
+    auto& scope = scopes_.back();
+    if (scope.hasItem) {
+        buffer_.push_back(',');
+    }
+    scope.hasItem = true;
+}
+
+void JsonWriter::StartObject()
+{
+    BeginValue();
+    buffer_.push_back('{');
+    scopes_.push_back({ true, false });
+}
+
+void JsonWriter::EndObject()
+{
+    EndScope(true);
+}
+
+void JsonWriter::StartArray()
+{
+    BeginValue();
+    buffer_.push_back('[');
+    scopes_.push_back({ false, false });
+}
+
+void JsonWriter::EndArray()
+{
+    EndScope(false);
+}
+
+void JsonWriter::EndScope(bool isObject)
+{
+    if (scopes_.empty() || scopes_.back().isObject != isObject || afterKey_) {
+        LOGE("JsonWriter ends a scope which is not started");
+        return;
+    }
+    scopes_.pop_back();
+    buffer_.push_back(isObject ? '}' : ']');
+    CheckFlush();
+}
+
+void JsonWriter::Key(std::string_view key)
+{
+    if (scopes_.empty() || !scopes_.back().isObject || afterKey_) {
+        LOGE("JsonWriter writes key out of object");
+        return;
+    }
+    BeginValue();
+    AppendEscaped(key);
+    buffer_.push_back(':');
+    afterKey_ = true;
+}
+
+void JsonWriter::String(std::string_view value)
+{
+    BeginValue();
+    AppendEscaped(value);
+    CheckFlush();
+}
+
+void JsonWriter::Int(int64_t value)
+{
+    BeginValue();
+    char buffer[NUMBER_BUFFER_SIZE];
+    int32_t length = snprintf(buffer, sizeof(buffer), "%" PRId64, value);
+    buffer_.append(buffer, length);
+    CheckFlush();
+}
+
+void JsonWriter::UInt(uint64_t value)
+{
+    BeginValue();
+    char buffer[NUMBER_BUFFER_SIZE];
+    int32_t length = snprintf(buffer, sizeof(buffer), "%" PRIu64, value);
+    buffer_.append(buffer, length);
+    CheckFlush();
+}
+
+void JsonWriter::Double(double value)
+{
+    BeginValue();
+    // same as cJSON, integers are written without fraction and 15 digits are used if they are enough.
+    if (std::isnan(value) || std::isinf(value)) {
+        buffer_.append("null");
+        CheckFlush();
+        return;
+    }
+    char buffer[NUMBER_BUFFER_SIZE];
+    int32_t length = 0;
+    if (std::abs(value) < static_cast<double>(std::numeric_limits<int32_t>::max()) &&
+        value == static_cast<double>(static_cast<int32_t>(value))) {
+        length = snprintf(buffer, sizeof(buffer), "%d", static_cast<int32_t>(value));
+    } else {
+        length = snprintf(buffer, sizeof(buffer), "%1.15g", value);
+        if (std::strtod(buffer, nullptr) != value) {
+            length = snprintf(buffer, sizeof(buffer), "%1.17g", value);
+        }
+    }
+    buffer_.append(buffer, length);
+    CheckFlush();
+}
+
+void JsonWriter::Bool(bool value)
+{
+    BeginValue();
+    buffer_.append(value ? "true" : "false");
+    CheckFlush();
+}
+
+void JsonWriter::Null()
+{
+    BeginValue();
+    buffer_.append("null");
+    CheckFlush();
+}
+
+void JsonWriter::RawValue(std::string_view json)
+{
+    BeginValue();
+    buffer_.append(json);
+    CheckFlush();
+}
+
+void JsonWriter::Put(std::string_view key, const char* value)
+{
+    if (value == nullptr) {
+        return;
+    }
+    Key(key);
+    String(value);
+}
+
+void JsonWriter::Put(std::string_view key, const std::string& value)
+{
+    Key(key);
+    String(value);
+}
+
+void JsonWriter::Put(std::string_view key, size_t value)
+{
+    Key(key);
+    Double(static_cast<double>(value));
+}
+
+void JsonWriter::Put(std::string_view key, int32_t value)
+{
+    Key(key);
+    Int(value);
+}
+
+void JsonWriter::Put(std::string_view key, int64_t value)
+{
+    Key(key);
+    Double(static_cast<double>(value));
+}
+
+void JsonWriter::Put(std::string_view key, double value)
+{
+    Key(key);
+    Double(value);
+}
+
+void JsonWriter::Put(std::string_view key, bool value)
+{
+    Key(key);
+    Bool(value);
+}
+
+void JsonWriter::Flush()
+{
+    if (!flushCallback_ || buffer_.empty()) {
+        return;
+    }
+    flushCallback_(buffer_);
+    buffer_.clear();
+}
+
+void JsonWriter::AppendEscaped(std::string_view value)
+{
+    buffer_.push_back('"');
+    size_t start = 0;
+    for (size_t index = 0; index < value.size(); ++index) {
+        auto ch = static_cast<unsigned char>(value[index]);
+        if (ch >= ' ' && ch != '"' && ch != '\\') {
+            continue;
+        }
+        buffer_.append(value.substr(start, index - start));
+        start = index + 1;
+        buffer_.push_back('\\');
+        switch (ch) {
+            case '"':
+            case '\\':
+                buffer_.push_back(static_cast<char>(ch));
+                break;
+            case '\b':
+                buffer_.push_back('b');
+                break;
+            case '\f':
+                buffer_.push_back('f');
+                break;
+            case '\n':
+                buffer_.push_back('n');
+                break;
+            case '\r':
+                buffer_.push_back('r');
+                break;
+            case '\t':
+                buffer_.push_back('t');
+                break;
+            default:
+                buffer_.append("u00");
+                buffer_.push_back(HEX_DIGITS[ch >> 4]);
+                buffer_.push_back(HEX_DIGITS[ch & 0xF]);
+                break;
+        }
+    }
+    buffer_.append(value.substr(start));
+    buffer_.push_back('"');
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_WRITER_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_WRITER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// Streaming writer of unformatted JSON, the output is the same as JsonValue::ToString. Values are appended to a
+// buffer, which is passed to the flush callback when it is full, so large dumps do not build a tree or a whole string.
+class ACE_FORCE_EXPORT_WITH_PREVIEW JsonWriter final {
+public:
+    using FlushCallback = std::function<void(std::string_view)>;
+
+    JsonWriter() = default;
+    explicit JsonWriter(FlushCallback&& flushCallback, size_t flushSize = DEFAULT_FLUSH_SIZE);
+    ~JsonWriter();
+
+    void StartObject();
+    void EndObject();
+    void StartArray();
+    void EndArray();
+    void Key(std::string_view key);
+
+    void String(std::string_view value);
+    void Int(int64_t value);
+    void UInt(uint64_t value);
+    void Double(double value);
+    void Bool(bool value);
+    void Null();
+    // Write the text which is already serialized, such as JsonView::GetRawText.
+    void RawValue(std::string_view json);
+
+    // Members of object, same as JsonValue::Put.
+    void Put(std::string_view key, const char* value);
+    void Put(std::string_view key, const std::string& value);
+    void Put(std::string_view key, size_t value);
+    void Put(std::string_view key, int32_t value);
+    void Put(std::string_view key, int64_t value);
+    void Put(std::string_view key, double value);
+    void Put(std::string_view key, bool value);
+
+    // Pass the buffer to the flush callback.
+    void Flush();
+
+    // Returns the output written without flush callback.
+    const std::string& GetString() const
+    {
+        return buffer_;
+    }
+
+    std::string TakeString()
+    {
+        return std::move(buffer_);
+    }
+
+    // true if the root value is written completely.
+    bool IsComplete() const
+    {
+        return hasRoot_ && scopes_.empty();
+    }
+
+private:
+    static constexpr size_t DEFAULT_FLUSH_SIZE = 64 * 1024;
+
+    struct Scope {
+        bool isObject = false;
+        bool hasItem = false;
+    };
+
+    // Append the separator before a value or a key.
+    void BeginValue();
+    void EndScope(bool isObject);
+    void AppendEscaped(std::string_view value);
+    void CheckFlush()
+    {
+        if (flushCallback_ && buffer_.size() >= flushSize_) {
+            Flush();
+        }
+    }
+
+    std::string buffer_;
+    std::vector<Scope> scopes_;
+    FlushCallback flushCallback_;
+    size_t flushSize_ = DEFAULT_FLUSH_SIZE;
+    bool afterKey_ = false;
+    bool hasRoot_ = false;
+
+    ACE_DISALLOW_COPY_AND_MOVE(JsonWriter);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_WRITER_H
@@ -15,6 +15,8 @@
 
 #include "base/log/ace_trace.h"
 
+#include "base/log/trace_recorder.h"
+
 #ifndef WINDOWS_PLATFORM
 #include "securec.h"
 #endif
@@ -47,11 +49,30 @@ bool AceTraceBeginWithArgs(const char* format, ...)
 
 AceScopedTrace::AceScopedTrace(const char* format, ...) : traceEnabled_(AceTraceEnabled())
 {
+    va_list args;
+    va_start(args, format);
+    Begin(nullptr, format, args);
+    va_end(args);
+}
+
+AceScopedTrace::AceScopedTrace(TraceSite& site, const char* format, ...) : traceEnabled_(AceTraceEnabled())
+{
+    va_list args;
+    va_start(args, format);
+    Begin(&site, format, args);
+    va_end(args);
+}
+
+void AceScopedTrace::Begin(TraceSite* site, const char* format, va_list args)
+{
+    if (TraceRecorder::IsEnabled()) {
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        recorded_ = TraceRecorder::GetInstance().Begin(site, format, argsCopy) != 0;
+        va_end(argsCopy);
+    }
     if (traceEnabled_) {
-        va_list args;
-        va_start(args, format);
         traceEnabled_ = AceTraceBeginWithArgv(format, args);
-        va_end(args);
     }
 }
 
@@ -60,15 +81,40 @@ AceScopedTrace::~AceScopedTrace()
     if (traceEnabled_) {
         AceTraceEnd();
     }
+    if (recorded_) {
+        TraceRecorder::GetInstance().End();
+    }
 }
 
 AceScopedTraceFlag::AceScopedTraceFlag(bool flag, const char* format, ...)
 {
-    if (flag && AceTraceEnabled()) {
-        va_list args;
-        va_start(args, format);
+    va_list args;
+    va_start(args, format);
+    Begin(nullptr, flag, format, args);
+    va_end(args);
+}
+
+AceScopedTraceFlag::AceScopedTraceFlag(TraceSite& site, bool flag, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    Begin(&site, flag, format, args);
+    va_end(args);
+}
+
+void AceScopedTraceFlag::Begin(TraceSite* site, bool flag, const char* format, va_list args)
+{
+    if (!flag) {
+        return;
+    }
+    if (TraceRecorder::IsEnabled()) {
+        va_list argsCopy;
+        va_copy(argsCopy, args);
+        recorded_ = TraceRecorder::GetInstance().Begin(site, format, argsCopy) != 0;
+        va_end(argsCopy);
+    }
+    if (AceTraceEnabled()) {
         flagTraceEnabled_ = AceTraceBeginWithArgv(format, args);
-        va_end(args);
     }
 }
 
@@ -77,6 +123,9 @@ AceScopedTraceFlag::~AceScopedTraceFlag()
     if (flagTraceEnabled_) {
         AceTraceEnd();
     }
+    if (recorded_) {
+        TraceRecorder::GetInstance().End();
+    }
 }
 
 std::string ACE_EXPORT AceAsyncTraceBeginWithArgv(int32_t taskId, const char* format, va_list args)
@@ -103,10 +152,17 @@ std::atomic<std::int32_t> AceAsyncScopedTrace::id_ = 0;
 AceAsyncScopedTrace::AceAsyncScopedTrace(const char* format, ...) : asyncTraceEnabled_(AceTraceEnabled())
 {
     taskId_ = id_++;
+    if (TraceRecorder::IsEnabled()) {
+        va_list args;
+        va_start(args, format);
+        recordedNameId_ = TraceRecorder::GetInstance().AsyncBegin(taskId_, format, args);
+        va_end(args);
+    }
     if (asyncTraceEnabled_) {
         va_list args;
         va_start(args, format);
         name_ = AceAsyncTraceBeginWithArgv(taskId_, format, args);
+        va_end(args);
     }
 }
 
@@ -115,5 +171,8 @@ AceAsyncScopedTrace::~AceAsyncScopedTrace()
     if (!name_.empty()) {
         AceAsyncTraceEnd(taskId_, name_.c_str());
     }
+    if (recordedNameId_ != 0) {
+        TraceRecorder::GetInstance().AsyncEnd(taskId_, recordedNameId_);
+    }
 }
 } // namespace OHOS::Ace
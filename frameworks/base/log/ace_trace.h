@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdio>
 #include <memory>
 #include <string>
@@ -26,11 +27,16 @@
 #include "base/utils/noncopyable.h"
 #include "base/utils/system_properties.h"
 
-#define ACE_SCOPED_TRACE(fmt, ...) AceScopedTrace aceScopedTrace(fmt, ##__VA_ARGS__)
-#define ACE_SVG_SCOPED_TRACE(fmt, ...) \
-    AceScopedTraceFlag aceScopedTraceFlag(SystemProperties::GetSvgTraceEnabled(), fmt, ##__VA_ARGS__)
+// Every call site has its own static TraceSite, which is constant initialized.
+#define ACE_SCOPED_TRACE(fmt, ...)       \
+    static TraceSite aceScopedTraceSite; \
+    AceScopedTrace aceScopedTrace(aceScopedTraceSite, fmt, ##__VA_ARGS__)
+#define ACE_SVG_SCOPED_TRACE(fmt, ...)       \
+    static TraceSite aceScopedTraceFlagSite; \
+    AceScopedTraceFlag aceScopedTraceFlag(   \
+        aceScopedTraceFlagSite, SystemProperties::GetSvgTraceEnabled(), fmt, ##__VA_ARGS__)
 #ifdef ACE_DEBUG
-#define ACE_DEBUG_SCOPED_TRACE(fmt, ...) AceScopedTrace aceScopedTrace(fmt, ##__VA_ARGS__)
+#define ACE_DEBUG_SCOPED_TRACE(fmt, ...) ACE_SCOPED_TRACE(fmt, ##__VA_ARGS__)
 #else
 #define ACE_DEBUG_SCOPED_TRACE(fmt, ...)
 #endif
@@ -50,26 +56,59 @@ std::string ACE_EXPORT AceAsyncTraceBeginWithArgv(int32_t taskId, const char* fo
 void ACE_EXPORT AceTraceEnd();
 void ACE_EXPORT AceAsyncTraceEnd(int32_t taskId, const char* name);
 
+struct TraceName;
+
+// Name of trace interned once per call site, so TraceRecorder doesn't look up the format on every trace.
+class TraceSite final {
+public:
+    constexpr TraceSite() = default;
+    ~TraceSite() = default;
+
+    ACE_DISALLOW_COPY_AND_MOVE(TraceSite);
+
+private:
+    friend class TraceRecorder;
+
+    static constexpr uint8_t EMPTY = 0;
+    static constexpr uint8_t WRITING = 1;
+    static constexpr uint8_t READY = 2;
+
+    std::atomic<uint8_t> state_ { EMPTY };
+    // the format the name is interned from, other formats at the same site are looked up as without site.
+    const char* format_ = nullptr;
+    const TraceName* name_ = nullptr;
+    uint32_t nameId_ = 0;
+};
+
 class ACE_EXPORT AceScopedTrace final {
 public:
     explicit AceScopedTrace(const char* format, ...) __attribute__((__format__(printf, 2, 3)));
+    AceScopedTrace(TraceSite& site, const char* format, ...) __attribute__((__format__(printf, 3, 4)));
     ~AceScopedTrace();
 
     ACE_DISALLOW_COPY_AND_MOVE(AceScopedTrace);
 
 private:
+    void Begin(TraceSite* site, const char* format, va_list args);
+
     bool traceEnabled_ { false };
+    bool recorded_ { false };
 };
 
 class ACE_EXPORT AceScopedTraceFlag final {
 public:
     explicit AceScopedTraceFlag(bool flag, const char* format, ...) __attribute__((__format__(printf, 3, 4)));
+    AceScopedTraceFlag(TraceSite& site, bool flag, const char* format, ...)
+        __attribute__((__format__(printf, 4, 5)));
     ~AceScopedTraceFlag();
 
     ACE_DISALLOW_COPY_AND_MOVE(AceScopedTraceFlag);
 
 private:
+    void Begin(TraceSite* site, bool flag, const char* format, va_list args);
+
     bool flagTraceEnabled_ { false };
+    bool recorded_ { false };
 };
 
 class ACE_EXPORT AceAsyncScopedTrace final {
@@ -83,6 +122,7 @@ private:
     bool asyncTraceEnabled_ { false };
     std::string name_;
     int32_t taskId_;
+    uint32_t recordedNameId_ = 0;
     static std::atomic<std::int32_t> id_;
 };
 
@@ -83,6 +83,8 @@ void DumpLog::ShowDumpHelp(std::vector<std::string>& info)
     info.emplace_back(" -render                        |show render tree");
     info.emplace_back(" -inspector                     |show inspector tree");
     info.emplace_back(" -frontend                      |show path and components count of current page");
+    info.emplace_back(" -framestats                    |show p50/p90/p99 duration of frame phases and jank count");
+    info.emplace_back(" -tracerecorder [-start|-stop|-clear] |control trace recorder, or export its chrome json");
 }
 
 } // namespace OHOS::Ace
\ No newline at end of file
@@ -0,0 +1,768 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/log/trace_recorder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string_view>
+#include <unordered_map>
+
+#include "base/json/json_writer.h"
+#include "base/log/ace_trace.h"
+#include "base/log/log.h"
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// records only come from this process, so a constant pid is enough for the trace viewers.
+constexpr int32_t TRACE_PID = 1;
+constexpr uint32_t MAX_NAME_COUNT = 4096;
+constexpr size_t MAX_THREAD_COUNT = 64;
+constexpr size_t MAX_STRING_ARG_LENGTH = UINT8_MAX;
+constexpr size_t FORMAT_BUFFER_SIZE = 128;
+constexpr double NANOSECONDS_PER_MICROSECOND = 1000.0;
+constexpr char TRACE_RECORDER_ENV[] = "ACE_TRACE_RECORDER";
+
+enum class ArgKind : uint8_t {
+    SIGNED = 0,
+    UNSIGNED,
+    DOUBLE,
+    STRING,
+    POINTER,
+};
+
+enum class ArgLength : uint8_t {
+    DEFAULT = 0,
+    LONG,
+    LONG_LONG,
+    SIZE,
+    INTMAX,
+    PTRDIFF,
+};
+
+// A piece of format, the literal text or a conversion.
+struct FormatSegment {
+    std::string text;
+    bool isConversion = false;
+    ArgKind kind = ArgKind::SIGNED;
+    ArgLength length = ArgLength::DEFAULT;
+    char conversion = 0;
+};
+
+// Split the format into segments, returns false if it has conversions which can't be deferred, such as '*' or %n.
+bool ParseFormat(std::string_view format, std::vector<FormatSegment>& segments)
+{
+    std::string literal;
+    size_t index = 0;
+    while (index < format.size()) {
+        char ch = format[index++];
+        if (ch != '%') {
+            literal.push_back(ch);
+            continue;
+        }
+        if (index < format.size() && format[index] == '%') {
+            literal.push_back('%');
+            ++index;
+            continue;
+        }
+        FormatSegment segment;
+        segment.isConversion = true;
+        segment.text.push_back('%');
+        while (index < format.size() && strchr("-+ #0.123456789", format[index]) != nullptr) {
+            segment.text.push_back(format[index++]);
+        }
+        if (index < format.size() && format[index] == 'h') {
+            index += (index + 1 < format.size() && format[index + 1] == 'h') ? 2 : 1;
+        } else if (index < format.size() && format[index] == 'l') {
+            bool isLongLong = index + 1 < format.size() && format[index + 1] == 'l';
+            segment.length = isLongLong ? ArgLength::LONG_LONG : ArgLength::LONG;
+            index += isLongLong ? 2 : 1;
+        } else if (index < format.size() && (format[index] == 'z' || format[index] == 'j' || format[index] == 't')) {
+            segment.length = format[index] == 'z' ? ArgLength::SIZE
+                             : format[index] == 'j' ? ArgLength::INTMAX : ArgLength::PTRDIFF;
+            ++index;
+        }
+        if (index >= format.size()) {
+            return false;
+        }
+        segment.conversion = format[index++];
+        switch (segment.conversion) {
+            case 'd':
+            case 'i':
+            case 'c':
+                segment.kind = ArgKind::SIGNED;
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                segment.kind = ArgKind::UNSIGNED;
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A':
+                segment.kind = ArgKind::DOUBLE;
+                break;
+            case 's':
+                segment.kind = ArgKind::STRING;
+                break;
+            case 'p':
+                segment.kind = ArgKind::POINTER;
+                break;
+            default:
+                return false;
+        }
+        if ((segment.conversion == 'c' || segment.kind == ArgKind::STRING) && segment.length != ArgLength::DEFAULT) {
+            // wide characters.
+            return false;
+        }
+        if (!literal.empty()) {
+            segments.push_back({ std::move(literal) });
+            literal.clear();
+        }
+        segments.emplace_back(std::move(segment));
+    }
+    if (!literal.empty()) {
+        segments.push_back({ std::move(literal) });
+    }
+    return true;
+}
+
+int64_t ReadSigned(ArgLength length, va_list* args)
+{
+    switch (length) {
+        case ArgLength::LONG:
+            return va_arg(*args, long);
+        case ArgLength::LONG_LONG:
+            return va_arg(*args, long long);
+        case ArgLength::SIZE:
+            return static_cast<int64_t>(va_arg(*args, size_t));
+        case ArgLength::INTMAX:
+            return va_arg(*args, intmax_t);
+        case ArgLength::PTRDIFF:
+            return va_arg(*args, ptrdiff_t);
+        default:
+            return va_arg(*args, int);
+    }
+}
+
+uint64_t ReadUnsigned(ArgLength length, va_list* args)
+{
+    switch (length) {
+        case ArgLength::LONG:
+            return va_arg(*args, unsigned long);
+        case ArgLength::LONG_LONG:
+            return va_arg(*args, unsigned long long);
+        case ArgLength::SIZE:
+            return va_arg(*args, size_t);
+        case ArgLength::INTMAX:
+            return va_arg(*args, uintmax_t);
+        case ArgLength::PTRDIFF:
+            return static_cast<uint64_t>(va_arg(*args, ptrdiff_t));
+        default:
+            return va_arg(*args, unsigned int);
+    }
+}
+
+template<class T>
+bool PackValue(TraceRecord& record, T value)
+{
+    if (record.argsSize + sizeof(T) > TraceRecord::ARGS_SIZE) {
+        return false;
+    }
+    memcpy(record.args.data() + record.argsSize, &value, sizeof(T));
+    record.argsSize += sizeof(T);
+    return true;
+}
+
+bool PackString(TraceRecord& record, const char* value)
+{
+    if (record.argsSize >= TraceRecord::ARGS_SIZE) {
+        return false;
+    }
+    if (value == nullptr) {
+        value = "(null)";
+    }
+    size_t available = TraceRecord::ARGS_SIZE - record.argsSize - 1;
+    size_t length = strnlen(value, std::min(available, MAX_STRING_ARG_LENGTH));
+    record.args[record.argsSize++] = static_cast<uint8_t>(length);
+    memcpy(record.args.data() + record.argsSize, value, length);
+    record.argsSize += length;
+    return true;
+}
+
+template<class T>
+bool UnpackValue(const TraceRecord& record, size_t& offset, T& value)
+{
+    if (offset + sizeof(T) > record.argsSize) {
+        return false;
+    }
+    memcpy(&value, record.args.data() + offset, sizeof(T));
+    offset += sizeof(T);
+    return true;
+}
+
+void AppendFormatted(std::string& output, const char* format, ...)
+{
+    char buffer[FORMAT_BUFFER_SIZE];
+    va_list args;
+    va_start(args, format);
+    int32_t length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length > 0) {
+        output.append(buffer, std::min<size_t>(length, sizeof(buffer) - 1));
+    }
+}
+
+} // namespace
+
+// Format of trace interned once, with the segments used to pack and format the arguments.
+struct TraceName {
+    std::string format;
+    std::vector<FormatSegment> segments;
+    // false if the arguments are formatted when recorded, and packed as a string.
+    bool deferred = true;
+};
+
+class TraceRecorder::TraceNameTable final {
+public:
+    TraceNameTable() = default;
+    ~TraceNameTable() = default;
+
+    const TraceName* Intern(std::string_view format, uint32_t& id)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = ids_.find(format);
+        if (iter != ids_.end()) {
+            id = iter->second;
+            return names_[id - 1].get();
+        }
+        if (names_.size() >= MAX_NAME_COUNT) {
+            LOGW("too many trace names, %{public}s is not recorded", std::string(format).c_str());
+            return nullptr;
+        }
+        auto name = std::make_unique<TraceName>();
+        name->format = format;
+        if (!ParseFormat(format, name->segments)) {
+            name->deferred = false;
+            name->segments.clear();
+            name->segments.push_back({ "%", true, ArgKind::STRING, ArgLength::DEFAULT, 's' });
+        }
+        names_.emplace_back(std::move(name));
+        id = static_cast<uint32_t>(names_.size());
+        ids_.emplace(names_.back()->format, id);
+        return names_.back().get();
+    }
+
+    const TraceName* Get(uint32_t id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return (id == 0 || id > names_.size()) ? nullptr : names_[id - 1].get();
+    }
+
+private:
+    mutable std::mutex mutex_;
+    // keys refer to the format of interned names, which are never released.
+    std::unordered_map<std::string_view, uint32_t> ids_;
+    std::vector<std::unique_ptr<TraceName>> names_;
+};
+
+// Ring buffer written by one thread, it is read by the exporter without lock. Every slot keeps the sequence of its
+// record, which is reset while the record is written, so records overwritten while they are copied are dropped.
+class TraceRecorder::ThreadBuffer final {
+public:
+    explicit ThreadBuffer(int32_t tid) : slots_(RECORD_CAPACITY), tid_(tid) {}
+    ~ThreadBuffer() = default;
+
+    TraceRecord& Next()
+    {
+        auto& slot = slots_[writeIndex_.load(std::memory_order_relaxed) % RECORD_CAPACITY];
+        slot.sequence.store(INVALID_SEQUENCE, std::memory_order_relaxed);
+        // the reset is visible before any write of the new record.
+        std::atomic_thread_fence(std::memory_order_release);
+        return slot.record;
+    }
+
+    void Commit()
+    {
+        auto index = writeIndex_.load(std::memory_order_relaxed);
+        slots_[index % RECORD_CAPACITY].sequence.store(GetSequence(index), std::memory_order_release);
+        writeIndex_.store(index + 1, std::memory_order_release);
+    }
+
+    void Clear()
+    {
+        clearIndex_.store(writeIndex_.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+
+    void Snapshot(std::vector<TraceRecord>& records) const
+    {
+        auto end = writeIndex_.load(std::memory_order_acquire);
+        auto begin = std::max(GetBeginIndex(end), clearIndex_.load(std::memory_order_relaxed));
+        records.clear();
+        for (auto index = begin; index < end; ++index) {
+            const auto& slot = slots_[index % RECORD_CAPACITY];
+            if (slot.sequence.load(std::memory_order_acquire) != GetSequence(index)) {
+                continue;
+            }
+            records.emplace_back(slot.record);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != GetSequence(index)) {
+                records.pop_back();
+            }
+        }
+    }
+
+    size_t GetCount() const
+    {
+        auto end = writeIndex_.load(std::memory_order_acquire);
+        return end - std::max(GetBeginIndex(end), clearIndex_.load(std::memory_order_relaxed));
+    }
+
+    int32_t GetTid() const
+    {
+        return tid_;
+    }
+
+private:
+    static constexpr uint64_t INVALID_SEQUENCE = 0;
+
+    struct Slot {
+        std::atomic<uint64_t> sequence { INVALID_SEQUENCE };
+        TraceRecord record;
+    };
+
+    static uint64_t GetBeginIndex(uint64_t end)
+    {
+        return end > RECORD_CAPACITY ? end - RECORD_CAPACITY : 0;
+    }
+
+    static uint64_t GetSequence(uint64_t index)
+    {
+        return index + 1;
+    }
+
+    std::vector<Slot> slots_;
+    std::atomic<uint64_t> writeIndex_ { 0 };
+    std::atomic<uint64_t> clearIndex_ { 0 };
+    int32_t tid_ = 0;
+};
+
+struct TraceRecorder::ThreadState final {
+    std::shared_ptr<ThreadBuffer> buffer;
+    // interned names used by this thread, looked up without lock.
+    std::unordered_map<std::string_view, std::pair<uint32_t, const TraceName*>> names;
+    bool bufferUnavailable = false;
+};
+
+TraceRecorder::ThreadState& TraceRecorder::GetThreadState()
+{
+    static thread_local ThreadState state;
+    return state;
+}
+
+std::atomic<bool> TraceRecorder::enabled_ { false };
+
+TraceRecorder& TraceRecorder::GetInstance()
+{
+    static TraceRecorder instance;
+    return instance;
+}
+
+TraceRecorder::TraceRecorder() : names_(std::make_unique<TraceNameTable>()) {}
+
+TraceRecorder::~TraceRecorder() = default;
+
+void TraceRecorder::Start()
+{
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+void TraceRecorder::Stop()
+{
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+void TraceRecorder::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& buffer : buffers_) {
+        buffer->Clear();
+    }
+}
+
+TraceRecorder::ThreadBuffer* TraceRecorder::GetThreadBuffer()
+{
+    auto& state = GetThreadState();
+    if (state.buffer) {
+        return state.buffer.get();
+    }
+    if (state.bufferUnavailable) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffers_.size() >= MAX_THREAD_COUNT) {
+        LOGW("too many threads, trace of this thread is not recorded");
+        state.bufferUnavailable = true;
+        return nullptr;
+    }
+    state.buffer = std::make_shared<ThreadBuffer>(static_cast<int32_t>(buffers_.size() + 1));
+    buffers_.emplace_back(state.buffer);
+    return state.buffer.get();
+}
+
+const TraceName* TraceRecorder::GetName(TraceSite* site, const char* format, uint32_t& nameId)
+{
+    if (site != nullptr && site->state_.load(std::memory_order_acquire) == TraceSite::READY &&
+        site->format_ == format) {
+        nameId = site->nameId_;
+        return site->name_;
+    }
+    auto& names = GetThreadState().names;
+    std::string_view formatView(format);
+    auto iter = names.find(formatView);
+    if (iter == names.end()) {
+        uint32_t id = 0;
+        const auto* name = names_->Intern(formatView, id);
+        if (name == nullptr) {
+            return nullptr;
+        }
+        iter = names.emplace(name->format, std::make_pair(id, name)).first;
+    }
+    nameId = iter->second.first;
+    // the first thread reaching the site caches the name, the site is never changed after that.
+    uint8_t expected = TraceSite::EMPTY;
+    if (site != nullptr && site->state_.compare_exchange_strong(expected, TraceSite::WRITING,
+        std::memory_order_relaxed)) {
+        site->format_ = format;
+        site->name_ = iter->second.second;
+        site->nameId_ = nameId;
+        site->state_.store(TraceSite::READY, std::memory_order_release);
+    }
+    return iter->second.second;
+}
+
+uint32_t TraceRecorder::Record(
+    TraceRecordType type, int32_t asyncId, TraceSite* site, const char* format, va_list args)
+{
+    if (format == nullptr) {
+        return 0;
+    }
+    auto* buffer = GetThreadBuffer();
+    if (buffer == nullptr) {
+        return 0;
+    }
+    uint32_t nameId = 0;
+    const auto* name = GetName(site, format, nameId);
+    if (name == nullptr) {
+        return 0;
+    }
+
+    auto& record = buffer->Next();
+    record.timestamp = GetSysTimestamp();
+    record.nameId = nameId;
+    record.type = type;
+    record.asyncId = asyncId;
+    record.argsSize = 0;
+    va_list argsCopy;
+    va_copy(argsCopy, args);
+    if (!name->deferred) {
+        char text[TraceRecord::ARGS_SIZE];
+        if (vsnprintf(text, sizeof(text), format, argsCopy) < 0) {
+            text[0] = '\0';
+        }
+        PackString(record, text);
+    } else {
+        for (const auto& segment : name->segments) {
+            if (!segment.isConversion) {
+                continue;
+            }
+            bool packed = true;
+            switch (segment.kind) {
+                case ArgKind::SIGNED:
+                    packed = PackValue(record, ReadSigned(segment.length, &argsCopy));
+                    break;
+                case ArgKind::UNSIGNED:
+                    packed = PackValue(record, ReadUnsigned(segment.length, &argsCopy));
+                    break;
+                case ArgKind::DOUBLE:
+                    packed = PackValue(record, va_arg(argsCopy, double));
+                    break;
+                case ArgKind::STRING:
+                    packed = PackString(record, va_arg(argsCopy, const char*));
+                    break;
+                case ArgKind::POINTER:
+                    packed = PackValue(record, reinterpret_cast<uint64_t>(va_arg(argsCopy, void*)));
+                    break;
+                default:
+                    break;
+            }
+            if (!packed) {
+                break;
+            }
+        }
+    }
+    va_end(argsCopy);
+    buffer->Commit();
+    return nameId;
+}
+
+uint32_t TraceRecorder::Begin(TraceSite* site, const char* format, va_list args)
+{
+    return Record(TraceRecordType::BEGIN, 0, site, format, args);
+}
+
+void TraceRecorder::End()
+{
+    auto* buffer = GetThreadBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    auto& record = buffer->Next();
+    record.timestamp = GetSysTimestamp();
+    record.nameId = 0;
+    record.type = TraceRecordType::END;
+    record.asyncId = 0;
+    record.argsSize = 0;
+    buffer->Commit();
+}
+
+uint32_t TraceRecorder::AsyncBegin(int32_t asyncId, const char* format, va_list args)
+{
+    return Record(TraceRecordType::ASYNC_BEGIN, asyncId, nullptr, format, args);
+}
+
+void TraceRecorder::AsyncEnd(int32_t asyncId, uint32_t nameId)
+{
+    auto* buffer = GetThreadBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    auto& record = buffer->Next();
+    record.timestamp = GetSysTimestamp();
+    record.nameId = nameId;
+    record.type = TraceRecordType::ASYNC_END;
+    record.asyncId = asyncId;
+    record.argsSize = 0;
+    buffer->Commit();
+}
+
+size_t TraceRecorder::GetRecordCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto& buffer : buffers_) {
+        count += buffer->GetCount();
+    }
+    return count;
+}
+
+namespace {
+
+// Format the name of record with the packed arguments, missing arguments are written as '?'.
+std::string FormatName(const TraceName& name, const TraceRecord& record)
+{
+    std::string output;
+    size_t offset = 0;
+    for (const auto& segment : name.segments) {
+        if (!segment.isConversion) {
+            output.append(segment.text);
+            continue;
+        }
+        std::string spec = segment.text;
+        bool unpacked = false;
+        switch (segment.kind) {
+            case ArgKind::SIGNED: {
+                int64_t value = 0;
+                if ((unpacked = UnpackValue(record, offset, value))) {
+                    if (segment.conversion == 'c') {
+                        AppendFormatted(output, (spec + "c").c_str(), static_cast<int32_t>(value));
+                    } else {
+                        spec.append("ll").push_back(segment.conversion);
+                        AppendFormatted(output, spec.c_str(), static_cast<long long>(value));
+                    }
+                }
+                break;
+            }
+            case ArgKind::UNSIGNED: {
+                uint64_t value = 0;
+                if ((unpacked = UnpackValue(record, offset, value))) {
+                    spec.append("ll").push_back(segment.conversion);
+                    AppendFormatted(output, spec.c_str(), static_cast<unsigned long long>(value));
+                }
+                break;
+            }
+            case ArgKind::DOUBLE: {
+                double value = 0.0;
+                if ((unpacked = UnpackValue(record, offset, value))) {
+                    spec.push_back(segment.conversion);
+                    AppendFormatted(output, spec.c_str(), value);
+                }
+                break;
+            }
+            case ArgKind::STRING: {
+                uint8_t length = 0;
+                if ((unpacked = UnpackValue(record, offset, length) && offset + length <= record.argsSize)) {
+                    std::string value(reinterpret_cast<const char*>(record.args.data() + offset), length);
+                    offset += length;
+                    AppendFormatted(output, (spec + "s").c_str(), value.c_str());
+                }
+                break;
+            }
+            case ArgKind::POINTER: {
+                uint64_t value = 0;
+                if ((unpacked = UnpackValue(record, offset, value))) {
+                    AppendFormatted(output, (spec + "p").c_str(), reinterpret_cast<void*>(value));
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        if (!unpacked) {
+            output.push_back('?');
+        }
+    }
+    return output;
+}
+
+void WriteEvent(JsonWriter& writer, const char* phase, const TraceRecord& record, int32_t tid)
+{
+    writer.StartObject();
+    writer.Put("ph", phase);
+    writer.Put("ts", static_cast<double>(record.timestamp) / NANOSECONDS_PER_MICROSECOND);
+    writer.Put("pid", TRACE_PID);
+    writer.Put("tid", tid);
+}
+
+} // namespace
+
+void TraceRecorder::Export(JsonWriter& writer)
+{
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers = buffers_;
+    }
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    std::vector<TraceRecord> records;
+    for (const auto& buffer : buffers) {
+        buffer->Snapshot(records);
+        auto tid = buffer->GetTid();
+        // the begin of the oldest records may be overwritten.
+        int32_t depth = 0;
+        for (const auto& record : records) {
+            switch (record.type) {
+                case TraceRecordType::BEGIN: {
+                    const auto* name = names_->Get(record.nameId);
+                    if (name == nullptr) {
+                        continue;
+                    }
+                    ++depth;
+                    WriteEvent(writer, "B", record, tid);
+                    writer.Put("name", FormatName(*name, record));
+                    writer.EndObject();
+                    break;
+                }
+                case TraceRecordType::END:
+                    if (depth == 0) {
+                        continue;
+                    }
+                    --depth;
+                    WriteEvent(writer, "E", record, tid);
+                    writer.EndObject();
+                    break;
+                case TraceRecordType::ASYNC_BEGIN:
+                case TraceRecordType::ASYNC_END: {
+                    const auto* name = names_->Get(record.nameId);
+                    if (name == nullptr) {
+                        continue;
+                    }
+                    bool isBegin = record.type == TraceRecordType::ASYNC_BEGIN;
+                    WriteEvent(writer, isBegin ? "b" : "e", record, tid);
+                    writer.Put("cat", "ace");
+                    writer.Put("id", record.asyncId);
+                    writer.Put("name", isBegin ? FormatName(*name, record) : name->format);
+                    writer.EndObject();
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+    writer.EndArray();
+    writer.Put("displayTimeUnit", "ns");
+    writer.EndObject();
+}
+
+std::string TraceRecorder::Export()
+{
+    JsonWriter writer;
+    Export(writer);
+    return writer.TakeString();
+}
+
+bool TraceRecorder::ExportToFile(const std::string& path)
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        LOGE("failed to open %{private}s to export trace records", path.c_str());
+        return false;
+    }
+    file << Export();
+    return file.good();
+}
+
+namespace {
+
+void ExportAtExit()
+{
+    const char* path = getenv(TRACE_RECORDER_ENV);
+    if (path != nullptr && path[0] != '\0') {
+        TraceRecorder::GetInstance().ExportToFile(path);
+    }
+}
+
+bool StartFromEnv()
+{
+    const char* path = getenv(TRACE_RECORDER_ENV);
+    if (path == nullptr || path[0] == '\0') {
+        return false;
+    }
+    // the recorder is constructed before the exit handler is registered, so it is still alive in the handler.
+    TraceRecorder::GetInstance().Start();
+    atexit(ExportAtExit);
+    return true;
+}
+
+const bool g_startedFromEnv = StartFromEnv();
+
+} // namespace
+
+} // namespace OHOS::Ace
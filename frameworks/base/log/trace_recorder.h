@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_TRACE_RECORDER_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_TRACE_RECORDER_H
+
+#include <array>
+#include <atomic>
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+class JsonWriter;
+class TraceSite;
+struct TraceName;
+
+enum class TraceRecordType : uint8_t {
+    BEGIN = 0,
+    END,
+    ASYNC_BEGIN,
+    ASYNC_END,
+};
+
+// Record of trace in binary, the name is the id of interned format and the arguments are packed without formatting.
+struct TraceRecord {
+    static constexpr size_t ARGS_SIZE = 44;
+
+    int64_t timestamp = 0;
+    uint32_t nameId = 0;
+    TraceRecordType type = TraceRecordType::BEGIN;
+    uint8_t argsSize = 0;
+    uint16_t reserved = 0;
+    int32_t asyncId = 0;
+    std::array<uint8_t, ARGS_SIZE> args;
+};
+
+// In-process backend of ACE_SCOPED_TRACE, it works without the platform trace, such as in previewer and headless
+// runs on Linux. Every thread writes records to its own ring buffer without lock, the format of trace is interned once
+// per call site and the arguments are formatted only when the records are exported to Chrome trace json, which can be
+// opened by chrome://tracing or Perfetto. Setting ACE_TRACE_RECORDER to a file path starts recording when the library
+// is loaded and exports the records to the file at exit.
+class ACE_EXPORT TraceRecorder final {
+public:
+    static TraceRecorder& GetInstance();
+
+    static bool IsEnabled()
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    void Start();
+    void Stop();
+    // Drop the records of all threads.
+    void Clear();
+
+    // Returns the interned name id, 0 if it can't be recorded. The name is cached in site if it is not null.
+    uint32_t Begin(TraceSite* site, const char* format, va_list args);
+    void End();
+    uint32_t AsyncBegin(int32_t asyncId, const char* format, va_list args);
+    void AsyncEnd(int32_t asyncId, uint32_t nameId);
+
+    // Export records of all threads as Chrome trace json.
+    void Export(JsonWriter& writer);
+    std::string Export();
+    bool ExportToFile(const std::string& path);
+
+    size_t GetRecordCount() const;
+
+    static constexpr size_t RECORD_CAPACITY = 2048;
+
+private:
+    class ThreadBuffer;
+    class TraceNameTable;
+    struct ThreadState;
+
+    TraceRecorder();
+    ~TraceRecorder();
+
+    static ThreadState& GetThreadState();
+    ThreadBuffer* GetThreadBuffer();
+    const TraceName* GetName(TraceSite* site, const char* format, uint32_t& nameId);
+    uint32_t Record(TraceRecordType type, int32_t asyncId, TraceSite* site, const char* format, va_list args);
+
+    static std::atomic<bool> enabled_;
+
+    mutable std::mutex mutex_;
+    // buffers are kept after the thread exits, so the records can be exported.
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::unique_ptr<TraceNameTable> names_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(TraceRecorder);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_TRACE_RECORDER_H
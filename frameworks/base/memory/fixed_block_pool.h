@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_FIXED_BLOCK_POOL_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_FIXED_BLOCK_POOL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Allocate instances of the class and its subclasses from size class pools, used by objects which are created and
+// destroyed in every frame. The destructor of a polymorphic class must be virtual to free the block of subclasses.
+// Place it in the public section of the class, it does not change the access of the following members.
+#define DECLARE_POOLED_ALLOCATION()                                  \
+    static void* operator new(std::size_t size)                      \
+    {                                                                \
+        return ::OHOS::Ace::SizeClassPool::Allocate(size);           \
+    }                                                                \
+    static void operator delete(void* ptr, std::size_t size)         \
+    {                                                                \
+        ::OHOS::Ace::SizeClassPool::Free(ptr, size);                 \
+    }
+
+namespace OHOS::Ace {
+
+// Pool of fixed size blocks for small objects which are created and destroyed frequently, such as reference counters.
+// Blocks are carved from slabs, freed blocks are cached by the freeing thread and moved to a shared list in batches
+// when the thread cache is full or the thread exits. Trim returns the slabs whose blocks are all in the shared list to
+// the system.
+template<size_t BlockSize>
+class FixedBlockPool final {
+public:
+    static void* Allocate()
+    {
+        auto& cache = threadCache_;
+        if (cache.head == nullptr) {
+            Refill(cache);
+        }
+        Block* block = cache.head;
+        cache.head = block->next;
+        --cache.count;
+        return block;
+    }
+
+    static void Free(void* ptr)
+    {
+        if (ptr == nullptr) {
+            return;
+        }
+        auto* block = static_cast<Block*>(ptr);
+        auto& cache = threadCache_;
+        RegisterThreadCache(cache);
+        if (cache.exited) {
+            // Thread cache is already flushed, return the block to the shared list directly.
+            std::lock_guard<std::mutex> lock(GetShared().mutex);
+            block->next = GetShared().head;
+            GetShared().head = block;
+            return;
+        }
+        block->next = cache.head;
+        cache.head = block;
+        if (++cache.count >= MAX_CACHED_BLOCKS) {
+            Flush(cache, MAX_CACHED_BLOCKS / 2);
+        }
+    }
+
+    // Called when memory is low, the blocks cached by other threads keep their slabs.
+    static void Trim()
+    {
+        auto& cache = threadCache_;
+        Flush(cache, cache.count);
+        auto& shared = GetShared();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        if (shared.head == nullptr) {
+            return;
+        }
+        std::vector<size_t> freeCounts(shared.slabs.size(), 0);
+        for (Block* block = shared.head; block != nullptr; block = block->next) {
+            ++freeCounts[FindSlab(shared, block)];
+        }
+        Block* head = nullptr;
+        Block* block = shared.head;
+        while (block != nullptr) {
+            Block* next = block->next;
+            if (freeCounts[FindSlab(shared, block)] != BLOCKS_PER_SLAB) {
+                block->next = head;
+                head = block;
+            }
+            block = next;
+        }
+        shared.head = head;
+        size_t kept = 0;
+        for (size_t idx = 0; idx < shared.slabs.size(); ++idx) {
+            if (freeCounts[idx] == BLOCKS_PER_SLAB) {
+                delete[] shared.slabs[idx];
+            } else {
+                shared.slabs[kept++] = shared.slabs[idx];
+            }
+        }
+        shared.slabs.resize(kept);
+    }
+
+    static size_t GetSlabCount()
+    {
+        std::lock_guard<std::mutex> lock(GetShared().mutex);
+        return GetShared().slabs.size();
+    }
+
+private:
+    static constexpr size_t SLAB_BYTES = 16 * 1024;
+    static constexpr size_t MIN_BLOCKS_PER_SLAB = 16;
+    static constexpr size_t BLOCKS_PER_SLAB =
+        SLAB_BYTES / BlockSize > MIN_BLOCKS_PER_SLAB ? SLAB_BYTES / BlockSize : MIN_BLOCKS_PER_SLAB;
+    static constexpr size_t MAX_CACHED_BLOCKS = BLOCKS_PER_SLAB * 2;
+
+    union Block {
+        Block* next;
+        alignas(std::max_align_t) unsigned char storage[BlockSize];
+    };
+
+    // Trivially destructible, so it is still accessible when objects are released after the thread cache is flushed.
+    struct ThreadCache {
+        Block* head;
+        size_t count;
+        bool registered;
+        bool exited;
+    };
+
+    struct SharedList {
+        std::mutex mutex;
+        Block* head = nullptr;
+        // Sorted by address, used to find the slab of a block when trimming.
+        std::vector<Block*> slabs;
+    };
+
+    struct ThreadCacheFlusher {
+        ~ThreadCacheFlusher()
+        {
+            Flush(threadCache_, threadCache_.count);
+            threadCache_.exited = true;
+        }
+    };
+
+    static SharedList& GetShared()
+    {
+        // Never destroyed, blocks may be freed during static destruction.
+        static auto* shared = new SharedList();
+        return *shared;
+    }
+
+    static void RegisterThreadCache(ThreadCache& cache)
+    {
+        if (!cache.registered && !cache.exited) {
+            cache.registered = true;
+            static thread_local ThreadCacheFlusher flusher;
+            (void)flusher;
+        }
+    }
+
+    static void Refill(ThreadCache& cache)
+    {
+        RegisterThreadCache(cache);
+        {
+            auto& shared = GetShared();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            while (shared.head != nullptr && cache.count < BLOCKS_PER_SLAB) {
+                Block* block = shared.head;
+                shared.head = block->next;
+                block->next = cache.head;
+                cache.head = block;
+                ++cache.count;
+            }
+        }
+        if (cache.head != nullptr) {
+            return;
+        }
+        auto* slab = new Block[BLOCKS_PER_SLAB];
+        {
+            auto& shared = GetShared();
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.slabs.insert(
+                std::upper_bound(shared.slabs.begin(), shared.slabs.end(), slab, std::less<const Block*>()), slab);
+        }
+        for (size_t idx = 0; idx < BLOCKS_PER_SLAB; ++idx) {
+            slab[idx].next = cache.head;
+            cache.head = &slab[idx];
+        }
+        cache.count += BLOCKS_PER_SLAB;
+    }
+
+    static void Flush(ThreadCache& cache, size_t num)
+    {
+        if (num == 0 || cache.head == nullptr) {
+            return;
+        }
+        Block* first = cache.head;
+        Block* last = first;
+        size_t count = 1;
+        while (count < num && last->next != nullptr) {
+            last = last->next;
+            ++count;
+        }
+        cache.head = last->next;
+        cache.count -= count;
+        auto& shared = GetShared();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        last->next = shared.head;
+        shared.head = first;
+    }
+
+    static size_t FindSlab(const SharedList& shared, const Block* block)
+    {
+        auto iter = std::upper_bound(shared.slabs.begin(), shared.slabs.end(), block, std::less<const Block*>());
+        return static_cast<size_t>(iter - shared.slabs.begin()) - 1;
+    }
+
+    static inline thread_local ThreadCache threadCache_ {};
+};
+
+template<size_t Granule, size_t... Index>
+constexpr auto MakeSizeClassAllocators(std::index_sequence<Index...> /* index */)
+{
+    return std::array<void* (*)(), sizeof...(Index)> { &FixedBlockPool<(Index + 1) * Granule>::Allocate... };
+}
+
+template<size_t Granule, size_t... Index>
+constexpr auto MakeSizeClassTrimmers(std::index_sequence<Index...> /* index */)
+{
+    return std::array<void (*)(), sizeof...(Index)> { &FixedBlockPool<(Index + 1) * Granule>::Trim... };
+}
+
+template<size_t Granule, size_t... Index>
+constexpr auto MakeSizeClassFreers(std::index_sequence<Index...> /* index */)
+{
+    return std::array<void (*)(void*), sizeof...(Index)> { &FixedBlockPool<(Index + 1) * Granule>::Free... };
+}
+
+// Route allocations to fixed block pools by size rounded up to GRANULE, larger allocations use the heap.
+class SizeClassPool final {
+public:
+    static constexpr size_t GRANULE = 16;
+    static constexpr size_t MAX_POOLED_SIZE = 1024;
+
+    static void* Allocate(size_t size)
+    {
+        if (size == 0 || size > MAX_POOLED_SIZE) {
+            return ::operator new(size);
+        }
+        return ALLOCATORS[(size - 1) / GRANULE]();
+    }
+
+    static void Free(void* ptr, size_t size)
+    {
+        if (size == 0 || size > MAX_POOLED_SIZE) {
+            ::operator delete(ptr);
+            return;
+        }
+        FREERS[(size - 1) / GRANULE](ptr);
+    }
+
+    // Return the free slabs of all size classes to the system.
+    static void Trim()
+    {
+        for (auto trim : TRIMMERS) {
+            trim();
+        }
+    }
+
+private:
+    static constexpr size_t CLASS_COUNT = MAX_POOLED_SIZE / GRANULE;
+    static constexpr auto ALLOCATORS = MakeSizeClassAllocators<GRANULE>(std::make_index_sequence<CLASS_COUNT>());
+    static constexpr auto FREERS = MakeSizeClassFreers<GRANULE>(std::make_index_sequence<CLASS_COUNT>());
+    static constexpr auto TRIMMERS = MakeSizeClassTrimmers<GRANULE>(std::make_index_sequence<CLASS_COUNT>());
+};
+
+// Standard allocator on top of SizeClassPool, used by node based containers such as std::map.
+template<class T>
+class PoolAllocator {
+public:
+    using value_type = T;
+
+    PoolAllocator() = default;
+    template<class U>
+    PoolAllocator(const PoolAllocator<U>& /* other */)
+    {}
+
+    T* allocate(size_t num)
+    {
+        return static_cast<T*>(SizeClassPool::Allocate(num * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t num)
+    {
+        SizeClassPool::Free(ptr, num * sizeof(T));
+    }
+
+    template<class U>
+    bool operator==(const PoolAllocator<U>& /* other */) const
+    {
+        return true;
+    }
+
+    template<class U>
+    bool operator!=(const PoolAllocator<U>& /* other */) const
+    {
+        return false;
+    }
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_FIXED_BLOCK_POOL_H
@@ -17,151 +17,125 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_REF_COUNTER_H
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 
+#include "base/memory/fixed_block_pool.h"
 #include "base/utils/macros.h"
 #include "base/utils/noncopyable.h"
 
 namespace OHOS::Ace {
 
-// Reference counter.
-class RefCounter {
+// Reference counter, allocated from a block pool. Counter operations are not virtual, the thread-unsafe counter
+// avoids atomic read-modify-write operations.
+class RefCounter final {
 public:
-    virtual int32_t IncStrongRef() = 0;
-    virtual int32_t DecStrongRef() = 0;
-    virtual int32_t TryIncStrongRef() = 0;
-    virtual int32_t StrongRefCount() const = 0;
-    virtual int32_t IncWeakRef() = 0;
-    virtual int32_t DecWeakRef() = 0;
-
-protected:
-    virtual ~RefCounter() = default;
-};
-
-// Define thread-safe counter using 'std::atomic' to implement Increase/Decrease count.
-class ThreadSafeCounter final {
-public:
-    explicit ThreadSafeCounter(int32_t count) : count_(count) {}
-    ~ThreadSafeCounter() = default;
-
-    int32_t Increase()
+    static RefCounter* Create(bool threadSafe)
     {
-        int32_t count = count_.fetch_add(1, std::memory_order_relaxed) + 1;
-        ACE_DCHECK(count > 0);
-        return count;
-    }
-    int32_t Decrease()
-    {
-        int32_t count = count_.fetch_sub(1, std::memory_order_release);
-        ACE_DCHECK(count > 0);
-        return count - 1;
-    }
-    int32_t CurrentCount() const
-    {
-        return count_.load(std::memory_order_relaxed);
+        return new RefCounter(threadSafe);
     }
 
-    // Try to increase reference count while current value is not zero.
-    int32_t TryIncrease()
+    int32_t IncStrongRef()
     {
-        int32_t count = CurrentCount();
-        do {
-            if (count == 0) {
-                return 0;
-            }
-            ACE_DCHECK(count > 0);
-        } while (!count_.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
-        return count + 1;
+        return Increase(strongRef_);
     }
-
-private:
-    std::atomic<int32_t> count_ { 0 };
-
-    ACE_DISALLOW_COPY_AND_MOVE(ThreadSafeCounter);
-};
-
-// Define thread-unsafe counter.
-class ThreadUnsafeCounter final {
-public:
-    explicit ThreadUnsafeCounter(int32_t count) : count_(count) {}
-    ~ThreadUnsafeCounter() = default;
-
-    int32_t Increase()
+    int32_t DecStrongRef()
     {
-        int32_t count = ++count_;
-        ACE_DCHECK(count > 0);
-        return count;
+        return Decrease(strongRef_);
     }
-    int32_t Decrease()
+    int32_t TryIncStrongRef()
     {
-        int32_t count = --count_;
-        ACE_DCHECK(count >= 0);
-        return count;
+        return TryIncrease(strongRef_);
     }
-    int32_t CurrentCount() const
+    int32_t StrongRefCount() const
     {
-        return count_;
+        return strongRef_.load(std::memory_order_relaxed);
     }
 
-    // Try to increase count while current value is not zero.
-    int32_t TryIncrease()
+    int32_t IncWeakRef()
     {
-        return CurrentCount() == 0 ? 0 : Increase();
+        return Increase(weakRef_);
     }
-
-private:
-    int32_t count_ { 0 };
-
-    ACE_DISALLOW_COPY_AND_MOVE(ThreadUnsafeCounter);
-};
-
-template<class T>
-class RefCounterImpl final : public RefCounter {
-public:
-    static RefCounter* Create()
+    int32_t DecWeakRef()
     {
-        return new RefCounterImpl();
+        int32_t refCount = Decrease(weakRef_);
+        if (refCount == 0) {
+            // Release this reference counter, while its weak reference have reduced to zero.
+            delete this;
+        }
+        return refCount;
     }
 
-    int32_t IncStrongRef() final
+    static void* operator new([[maybe_unused]] size_t size)
     {
-        return strongRef_.Increase();
+        ACE_DCHECK(size == sizeof(RefCounter));
+        return FixedBlockPool<sizeof(RefCounter)>::Allocate();
     }
-    int32_t DecStrongRef() final
+    static void operator delete(void* ptr)
     {
-        return strongRef_.Decrease();
+        FixedBlockPool<sizeof(RefCounter)>::Free(ptr);
     }
-    int32_t TryIncStrongRef() final
+
+    // Return the free slabs of reference counters to the system.
+    static void TrimPool()
     {
-        return strongRef_.TryIncrease();
+        FixedBlockPool<sizeof(RefCounter)>::Trim();
     }
-    int32_t StrongRefCount() const final
+
+private:
+    explicit RefCounter(bool threadSafe) : threadSafe_(threadSafe) {}
+    ~RefCounter() = default;
+
+    int32_t Increase(std::atomic<int32_t>& counter)
     {
-        return strongRef_.CurrentCount();
+        int32_t count = 0;
+        if (threadSafe_) {
+            count = counter.fetch_add(1, std::memory_order_relaxed) + 1;
+        } else {
+            count = counter.load(std::memory_order_relaxed) + 1;
+            counter.store(count, std::memory_order_relaxed);
+        }
+        ACE_DCHECK(count > 0);
+        return count;
     }
 
-    int32_t IncWeakRef() final
+    int32_t Decrease(std::atomic<int32_t>& counter)
     {
-        return weakRef_.Increase();
+        int32_t count = 0;
+        if (threadSafe_) {
+            count = counter.fetch_sub(1, std::memory_order_release) - 1;
+        } else {
+            count = counter.load(std::memory_order_relaxed) - 1;
+            counter.store(count, std::memory_order_relaxed);
+        }
+        ACE_DCHECK(count >= 0);
+        return count;
     }
-    int32_t DecWeakRef() final
+
+    // Try to increase reference count while current value is not zero.
+    int32_t TryIncrease(std::atomic<int32_t>& counter)
     {
-        int32_t refCount = weakRef_.Decrease();
-        if (refCount == 0) {
-            // Release this reference counter, while its weak reference have reduced to zero.
-            delete this;
+        int32_t count = counter.load(std::memory_order_relaxed);
+        if (!threadSafe_) {
+            return count == 0 ? 0 : Increase(counter);
         }
-        return refCount;
+        do {
+            if (count == 0) {
+                return 0;
+            }
+            ACE_DCHECK(count > 0);
+        } while (!counter.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+        return count + 1;
     }
 
-private:
-    T strongRef_ { 0 };
+    std::atomic<int32_t> strongRef_ { 0 };
     // Weak reference count should start with 1,
     // because instance MUST hold the reference counter for itself.
-    T weakRef_ { 1 };
-};
+    std::atomic<int32_t> weakRef_ { 1 };
+    const bool threadSafe_;
 
-using ThreadSafeRef = RefCounterImpl<ThreadSafeCounter>;
-using ThreadUnsafeRef = RefCounterImpl<ThreadUnsafeCounter>;
+    ACE_DISALLOW_COPY_AND_MOVE(RefCounter);
+};
 
 } // namespace OHOS::Ace
 
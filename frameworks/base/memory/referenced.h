@@ -86,7 +86,7 @@ public:
 
 protected:
     explicit Referenced(bool threadSafe = true)
-        : refCounter_(threadSafe ? ThreadSafeRef::Create() : ThreadUnsafeRef::Create())
+        : refCounter_(RefCounter::Create(threadSafe))
     {
 #ifdef ACE_MEMORY_MONITOR
         MemoryMonitor::GetInstance().Add(this);
@@ -16,45 +16,62 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_TYPE_INFO_BASE_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_TYPE_INFO_BASE_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include "base/memory/memory_monitor_def.h"
 
 // Generate 'TypeInfo' for each classes.
-// And using hash code of its name for 'TypeId'.
+// And using hash code of its name for 'TypeId', which is computed at compile time.
 #define DECLARE_CLASS_TYPE_INFO(classname)                                              \
 public:                                                                                 \
     static const char* TypeName()                                                       \
     {                                                                                   \
         return #classname;                                                              \
     }                                                                                   \
-    static TypeInfoBase::IdType TypeId()                                                \
+    static constexpr TypeInfoBase::IdType TypeId()                                      \
     {                                                                                   \
-        static TypeInfoBase::IdType myTypeId = std::hash<std::string> {}(TypeName());   \
-        return myTypeId;                                                                \
+        return ::OHOS::Ace::TypeNameHash(#classname);                                   \
     }                                                                                   \
     DECLARE_CLASS_TYPE_SIZE(classname)
 
 // Integrate it into class declaration to support 'DynamicCast'.
+// 'TypeIds' lists the ids of the class and all its ancestors, so a failed cast is rejected without walking the
+// inheritance tree. Only a successful cast walks the tree to get the adjusted pointer.
 #define DECLARE_RELATIONSHIP_OF_CLASSES(classname, ...) DECLARE_CLASS_TYPE_INFO(classname)            \
+    static constexpr auto TypeIds()                                                                   \
+    {                                                                                                 \
+        return ::OHOS::Ace::UniqueTypeIds<TypeId(), __VA_ARGS__>();                                   \
+    }                                                                                                 \
+                                                                                                      \
 protected:                                                                                            \
     template<class __T, class __O, class... __V>                                                      \
     uintptr_t TrySafeCastById(TypeInfoBase::IdType id) const                                          \
     {                                                                                                 \
         VERIFY_DECLARED_CLASS(__T);                                                                   \
-        uintptr_t ptr = __T::SafeCastById(id);                                                        \
+        uintptr_t ptr = __T::CastById(id);                                                            \
         return ptr != 0 ? ptr : TrySafeCastById<__O, __V...>(id);                                     \
     }                                                                                                 \
     template<class __T>                                                                               \
     uintptr_t TrySafeCastById(TypeInfoBase::IdType id) const                                          \
     {                                                                                                 \
         VERIFY_DECLARED_CLASS(__T);                                                                   \
-        return __T::SafeCastById(id);                                                                 \
+        return __T::CastById(id);                                                                     \
     }                                                                                                 \
-    uintptr_t SafeCastById(TypeInfoBase::IdType id) const override                                    \
+    uintptr_t CastById(TypeInfoBase::IdType id) const                                                 \
     {                                                                                                 \
         return id == TypeId() ? reinterpret_cast<uintptr_t>(this) : TrySafeCastById<__VA_ARGS__>(id); \
     }                                                                                                 \
+    uintptr_t SafeCastById(TypeInfoBase::IdType id) const override                                    \
+    {                                                                                                 \
+        if (id == TypeId()) {                                                                         \
+            return reinterpret_cast<uintptr_t>(this);                                                 \
+        }                                                                                             \
+        static constexpr auto typeIds = TypeIds();                                                    \
+        return ::OHOS::Ace::ContainsTypeId(typeIds, id) ? TrySafeCastById<__VA_ARGS__>(id) : 0;       \
+    }                                                                                                 \
     TypeInfoBase::IdType GetTypeId() const override                                                   \
     {                                                                                                 \
         return TypeId();                                                                              \
@@ -67,6 +84,79 @@ protected:
 
 namespace OHOS::Ace {
 
+// FNV-1a hash of the type name, the same name gets the same id in different libraries.
+constexpr std::size_t TypeNameHash(const char* name)
+{
+    constexpr bool is64Bit = sizeof(std::size_t) >= sizeof(uint64_t);
+    constexpr std::size_t offsetBasis = is64Bit ? static_cast<std::size_t>(14695981039346656037ULL) : 2166136261U;
+    constexpr std::size_t prime = is64Bit ? static_cast<std::size_t>(1099511628211ULL) : 16777619U;
+    std::size_t hash = offsetBasis;
+    for (; *name != '\0'; ++name) {
+        hash = (hash ^ static_cast<unsigned char>(*name)) * prime;
+    }
+    return hash;
+}
+
+// Ids of the class itself and ancestors of all its bases.
+template<class... Bases>
+constexpr auto MergeTypeIds(std::size_t id)
+{
+    std::array<std::size_t, (1 + ... + Bases::TypeIds().size())> ids {};
+    std::size_t count = 0;
+    ids[count++] = id;
+    auto append = [&ids, &count](const auto& baseIds) {
+        for (auto baseId : baseIds) {
+            ids[count++] = baseId;
+        }
+    };
+    (append(Bases::TypeIds()), ...);
+    return ids;
+}
+
+template<std::size_t N>
+constexpr std::size_t CountUniqueTypeIds(const std::array<std::size_t, N>& ids)
+{
+    std::size_t count = 0;
+    for (std::size_t index = 0; index < N; ++index) {
+        bool unique = true;
+        for (std::size_t prev = 0; prev < index; ++prev) {
+            unique = unique && (ids[prev] != ids[index]);
+        }
+        count += unique ? 1 : 0;
+    }
+    return count;
+}
+
+// Ids of the class and its ancestors without duplicates, the virtual bases are listed once.
+template<std::size_t Id, class... Bases>
+constexpr auto UniqueTypeIds()
+{
+    constexpr auto ids = MergeTypeIds<Bases...>(Id);
+    std::array<std::size_t, CountUniqueTypeIds(ids)> uniqueIds {};
+    std::size_t count = 0;
+    for (std::size_t index = 0; index < ids.size(); ++index) {
+        bool unique = true;
+        for (std::size_t prev = 0; prev < count; ++prev) {
+            unique = unique && (uniqueIds[prev] != ids[index]);
+        }
+        if (unique) {
+            uniqueIds[count++] = ids[index];
+        }
+    }
+    return uniqueIds;
+}
+
+template<std::size_t N>
+inline bool ContainsTypeId(const std::array<std::size_t, N>& ids, std::size_t id)
+{
+    for (auto item : ids) {
+        if (item == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
 // Define the base class, inherit this class to support partial 'RTTI' feature.
 class TypeInfoBase {
 public:
@@ -76,8 +166,18 @@ public:
     using IdType = std::size_t;
     DECLARE_CLASS_TYPE_INFO(TypeInfoBase);
 
+    static constexpr std::array<IdType, 1> TypeIds()
+    {
+        return { TypeId() };
+    }
+
 protected:
     virtual uintptr_t SafeCastById(IdType id) const
+    {
+        return CastById(id);
+    }
+
+    uintptr_t CastById(IdType id) const
     {
         return id == TypeId() ? reinterpret_cast<uintptr_t>(this) : 0;
     }
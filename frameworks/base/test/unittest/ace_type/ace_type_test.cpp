@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/memory/ace_type.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+class BaseA : public virtual AceType {
+    DECLARE_ACE_TYPE(BaseA, AceType);
+};
+
+class BaseB : public virtual AceType {
+    DECLARE_ACE_TYPE(BaseB, AceType);
+
+public:
+    int32_t valueB = 1;
+};
+
+class Derived : public BaseA, public BaseB {
+    DECLARE_ACE_TYPE(Derived, BaseA, BaseB);
+
+public:
+    int32_t valueDerived = 2;
+};
+
+class Unrelated : public virtual AceType {
+    DECLARE_ACE_TYPE(Unrelated, AceType);
+};
+
+class PooledBase : public virtual AceType {
+    DECLARE_ACE_TYPE(PooledBase, AceType);
+
+public:
+    DECLARE_POOLED_ALLOCATION();
+};
+
+class PooledDerived : public PooledBase {
+    DECLARE_ACE_TYPE(PooledDerived, PooledBase);
+
+public:
+    char data[SizeClassPool::MAX_POOLED_SIZE / 2] {};
+};
+
+static_assert(Derived::TypeId() == TypeNameHash("Derived"), "type id should be computed at compile time");
+static_assert(Derived::TypeIds().size() == 5, "type ids should contain all ancestors once");
+} // namespace
+
+class AceTypeTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: AceTypeTest001
+ * @tc.desc: DynamicCast to ancestors and back to the derived class with multiple inheritance.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTypeTest, AceTypeTest001, TestSize.Level1)
+{
+    auto derived = AceType::MakeRefPtr<Derived>();
+    auto baseB = AceType::DynamicCast<BaseB>(derived);
+    ASSERT_NE(baseB, nullptr);
+    EXPECT_EQ(baseB->valueB, 1);
+    RefPtr<AceType> base = baseB;
+    EXPECT_EQ(AceType::DynamicCast<Derived>(base), derived);
+    EXPECT_EQ(AceType::DynamicCast<Derived>(baseB)->valueDerived, 2);
+    EXPECT_TRUE(AceType::InstanceOf<BaseA>(base));
+    EXPECT_TRUE(AceType::InstanceOf<TypeInfoBase>(base));
+}
+
+/**
+ * @tc.name: AceTypeTest002
+ * @tc.desc: DynamicCast to unrelated classes fails, and type info is got by instance.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTypeTest, AceTypeTest002, TestSize.Level1)
+{
+    RefPtr<AceType> baseA = AceType::MakeRefPtr<BaseA>();
+    EXPECT_EQ(AceType::DynamicCast<Derived>(baseA), nullptr);
+    EXPECT_EQ(AceType::DynamicCast<BaseB>(baseA), nullptr);
+    EXPECT_FALSE(AceType::InstanceOf<Unrelated>(baseA));
+    EXPECT_EQ(AceType::DynamicCast<BaseA>(RefPtr<AceType>()), nullptr);
+    EXPECT_EQ(AceType::TypeId(baseA), BaseA::TypeId());
+    EXPECT_EQ(std::string(AceType::TypeName(baseA)), "BaseA");
+    EXPECT_NE(BaseA::TypeId(), BaseB::TypeId());
+}
+
+/**
+ * @tc.name: AceTypeTest003
+ * @tc.desc: Reference counters from the pool keep weak pointers valid, also when released in another thread.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTypeTest, AceTypeTest003, TestSize.Level1)
+{
+    constexpr int32_t count = 1000;
+    std::vector<RefPtr<BaseA>> instances;
+    std::vector<WeakPtr<BaseA>> weakInstances;
+    for (int32_t idx = 0; idx < count; ++idx) {
+        instances.emplace_back(AceType::MakeRefPtr<BaseA>());
+        weakInstances.emplace_back(instances.back());
+    }
+    EXPECT_NE(instances.front(), instances.back());
+
+    std::thread releaseThread([&instances]() { instances.clear(); });
+    releaseThread.join();
+    for (const auto& weak : weakInstances) {
+        EXPECT_TRUE(weak.Invalid());
+        EXPECT_EQ(weak.Upgrade(), nullptr);
+    }
+
+    auto instance = AceType::MakeRefPtr<BaseA>();
+    WeakPtr<BaseA> weak = instance;
+    EXPECT_EQ(weak.Upgrade(), instance);
+}
+
+/**
+ * @tc.name: AceTypeTest004
+ * @tc.desc: Blocks of pooled instances are reused after the instances are released.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTypeTest, AceTypeTest004, TestSize.Level1)
+{
+    auto derived = AceType::MakeRefPtr<PooledDerived>();
+    auto* derivedAddress = AceType::RawPtr(derived);
+    derived.Reset();
+    auto reused = AceType::MakeRefPtr<PooledDerived>();
+    EXPECT_EQ(AceType::RawPtr(reused), derivedAddress);
+
+    RefPtr<PooledBase> base = AceType::MakeRefPtr<PooledBase>();
+    EXPECT_NE(AceType::RawPtr(base), static_cast<PooledBase*>(derivedAddress));
+    EXPECT_TRUE(AceType::InstanceOf<PooledDerived>(RefPtr<PooledBase>(reused)));
+}
+
+/**
+ * @tc.name: AceTypeTest005
+ * @tc.desc: Trim returns the slabs whose blocks are all free and keeps the slabs still in use.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AceTypeTest, AceTypeTest005, TestSize.Level1)
+{
+    using Pool = FixedBlockPool<SizeClassPool::MAX_POOLED_SIZE>;
+    /**
+     * @tc.steps: step1. allocate blocks of several slabs and keep one of them.
+     */
+    constexpr size_t count = 1000;
+    std::vector<void*> blocks;
+    for (size_t idx = 0; idx < count; ++idx) {
+        blocks.emplace_back(Pool::Allocate());
+    }
+    auto* kept = blocks.back();
+    blocks.pop_back();
+    auto slabCount = Pool::GetSlabCount();
+    EXPECT_GT(slabCount, 1u);
+
+    /**
+     * @tc.steps: step2. free the other blocks and trim the pool.
+     * @tc.expected: step2. only the slab of the kept block remains, and the pool still allocates.
+     */
+    for (auto* block : blocks) {
+        Pool::Free(block);
+    }
+    Pool::Trim();
+    EXPECT_EQ(Pool::GetSlabCount(), 1u);
+    auto* block = Pool::Allocate();
+    EXPECT_NE(block, nullptr);
+    Pool::Free(block);
+    Pool::Free(kept);
+    Pool::Trim();
+    EXPECT_EQ(Pool::GetSlabCount(), 0u);
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/json/json_util.h"
+#include "base/json/json_view.h"
+#include "base/json/json_writer.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+const std::string TEST_JSON = R"({"name": "card", "version": 2, "ratio": 0.5, "visible": true, "extra": null,
+    "items": [1, -2, 3.25e2], "params": {"id": 7, "tags": ["a", "b"]}})";
+constexpr int32_t NESTING_LIMIT = 1000;
+
+} // namespace
+
+class JsonViewTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: JsonViewTest001
+ * @tc.desc: Read values of all types from the view of document.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonViewTest, JsonViewTest001, TestSize.Level1)
+{
+    auto document = JsonDocument::ParseView(TEST_JSON);
+    ASSERT_TRUE(document);
+    auto root = document->GetRoot();
+    EXPECT_TRUE(root->IsObject());
+    EXPECT_EQ(root->GetString("name"), "card");
+    EXPECT_EQ(root->GetInt("version"), 2);
+    EXPECT_EQ(root->GetDouble("ratio"), 0.5);
+    EXPECT_TRUE(root->GetBool("visible"));
+    EXPECT_TRUE(root->GetValue("extra")->IsNull());
+    EXPECT_TRUE(root->Contains("extra"));
+
+    // missing keys and wrong types return the default values.
+    EXPECT_FALSE(root->Contains("missing"));
+    EXPECT_FALSE(root->GetValue("missing"));
+    EXPECT_TRUE(root->GetValue("missing")->IsNull());
+    EXPECT_EQ(root->GetInt("name", -1), -1);
+    EXPECT_EQ(root->GetString("version", "none"), "none");
+    EXPECT_FALSE(root->GetObject("items")->IsValid());
+
+    auto items = root->GetValue("items");
+    ASSERT_TRUE(items->IsArray());
+    ASSERT_EQ(items->GetArraySize(), 3);
+    EXPECT_EQ(items->GetArrayItem(0)->GetInt(), 1);
+    EXPECT_EQ(items->GetArrayItem(1)->GetInt(), -2);
+    EXPECT_EQ(items->GetArrayItem(2)->GetDouble(), 325.0);
+    EXPECT_FALSE(items->GetArrayItem(3));
+
+    auto params = root->GetObject("params");
+    EXPECT_EQ(params->GetUInt("id"), 7u);
+    EXPECT_EQ(params->GetValue("tags")->GetArrayItem(1)->GetStringView(), "b");
+
+    std::vector<std::string> keys;
+    for (auto child = root->GetChild(); child; child = child->GetNext()) {
+        keys.emplace_back(child->GetKey());
+    }
+    std::vector<std::string> expected = { "name", "version", "ratio", "visible", "extra", "items", "params" };
+    EXPECT_EQ(keys, expected);
+}
+
+/**
+ * @tc.name: JsonViewTest002
+ * @tc.desc: Strings without escape refer to the input, strings with escape are decoded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonViewTest, JsonViewTest002, TestSize.Level1)
+{
+    std::string text = R"({"plain": "text", "esc\"aped": "a\\b\/c\n\tAé中😀"})";
+    auto document = JsonDocument::ParseView(text);
+    ASSERT_TRUE(document);
+    auto root = document->GetRoot();
+
+    auto plain = root->GetValue("plain")->GetStringView();
+    EXPECT_EQ(plain, "text");
+    EXPECT_GE(plain.data(), text.data());
+    EXPECT_LT(plain.data(), text.data() + text.size());
+
+    auto escaped = root->GetValue("esc\"aped");
+    ASSERT_TRUE(escaped);
+    EXPECT_EQ(escaped->GetKey(), "esc\"aped");
+    EXPECT_EQ(escaped->GetString(), "a\\b/c\n\tA\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80");
+}
+
+/**
+ * @tc.name: JsonViewTest003
+ * @tc.desc: Invalid texts are rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonViewTest, JsonViewTest003, TestSize.Level1)
+{
+    std::vector<std::string> invalidTexts = { "", "{", "[1,]", R"({"a" 1})", R"({"a": 1} x)", R"("\x")",
+        R"("\ud83d")", "tru", "1.2.3", R"({1: 2})" };
+    for (const auto& text : invalidTexts) {
+        EXPECT_FALSE(JsonDocument::ParseView(text)) << text;
+    }
+
+    std::string deepText = std::string(NESTING_LIMIT + 1, '[') + std::string(NESTING_LIMIT + 1, ']');
+    EXPECT_FALSE(JsonDocument::ParseView(deepText));
+    std::string text = std::string(NESTING_LIMIT, '[') + std::string(NESTING_LIMIT, ']');
+    EXPECT_TRUE(JsonDocument::ParseView(text));
+}
+
+/**
+ * @tc.name: JsonViewTest004
+ * @tc.desc: Raw text of values and document owning the text.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonViewTest, JsonViewTest004, TestSize.Level1)
+{
+    auto document = JsonDocument::Parse(std::string(TEST_JSON));
+    ASSERT_TRUE(document);
+    auto root = document->GetRoot();
+    EXPECT_EQ(root->GetObject("params")->GetRawText(), R"({"id": 7, "tags": ["a", "b"]})");
+    EXPECT_EQ(root->GetValue("name")->GetRawText(), R"("card")");
+    EXPECT_EQ(root->GetRawText(), TEST_JSON);
+
+    auto shortDocument = JsonDocument::Parse(std::string("[\"s\"]"));
+    ASSERT_TRUE(shortDocument);
+    EXPECT_EQ(shortDocument->GetRoot()->GetArrayItem(0)->GetString(), "s");
+}
+
+/**
+ * @tc.name: JsonViewTest005
+ * @tc.desc: Output of writer is the same as JsonValue.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonViewTest, JsonViewTest005, TestSize.Level1)
+{
+    auto value = JsonUtil::Create(true);
+    value->Put("name", "line\n\"quoted\"");
+    value->Put("count", 3);
+    value->Put("ratio", 0.1);
+    value->Put("visible", false);
+    auto child = JsonUtil::CreateArray(true);
+    child->Put(JsonUtil::Create(true));
+    value->Put("children", child);
+
+    JsonWriter writer;
+    writer.StartObject();
+    writer.Put("name", "line\n\"quoted\"");
+    writer.Put("count", 3);
+    writer.Put("ratio", 0.1);
+    writer.Put("visible", false);
+    writer.Key("children");
+    writer.StartArray();
+    writer.StartObject();
+    writer.EndObject();
+    writer.EndArray();
+    writer.EndObject();
+    EXPECT_TRUE(writer.IsComplete());
+    EXPECT_EQ(writer.GetString(), value->ToString());
+}
+
+/**
+ * @tc.name: JsonViewTest006
+ * @tc.desc: Writer passes the output to flush callback in chunks, and the output can be parsed back.
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonViewTest, JsonViewTest006, TestSize.Level1)
+{
+    constexpr int32_t itemCount = 1000;
+    constexpr size_t flushSize = 256;
+    std::string output;
+    int32_t flushCount = 0;
+    {
+        JsonWriter writer(
+            [&output, &flushCount](std::string_view chunk) {
+                output.append(chunk);
+                ++flushCount;
+            },
+            flushSize);
+        writer.StartArray();
+        for (int32_t index = 0; index < itemCount; ++index) {
+            writer.StartObject();
+            writer.Put("id", index);
+            writer.Put("text", std::to_string(index) + "\t");
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
+    EXPECT_GT(flushCount, 1);
+
+    auto document = JsonDocument::ParseView(output);
+    ASSERT_TRUE(document);
+    auto root = document->GetRoot();
+    ASSERT_EQ(root->GetArraySize(), itemCount);
+    int32_t index = 0;
+    for (auto item = root->GetChild(); item; item = item->GetNext()) {
+        EXPECT_EQ(item->GetInt("id"), index);
+        EXPECT_EQ(item->GetString("text"), std::to_string(index) + "\t");
+        ++index;
+    }
+    EXPECT_EQ(index, itemCount);
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "base/geometry/calc_dimension.h"
+#include "base/utils/string_expression.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr double PARENT_LENGTH = 200.0;
+constexpr double VP_SCALE = 2.0;
+
+double ConvertToPx(const Dimension& dimension)
+{
+    switch (dimension.Unit()) {
+        case DimensionUnit::PERCENT:
+            return dimension.Value() * PARENT_LENGTH;
+        case DimensionUnit::VP:
+            return dimension.Value() * VP_SCALE;
+        default:
+            return dimension.Value();
+    }
+}
+} // namespace
+
+class StringExpressionTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: StringExpressionTest001
+ * @tc.desc: Multiplication and division take precedence over addition and subtraction.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StringExpressionTest, StringExpressionTest001, TestSize.Level1)
+{
+    EXPECT_DOUBLE_EQ(StringExpression::CalculateExp("calc(100% - 2 * 10vp)", ConvertToPx), 160.0);
+    EXPECT_DOUBLE_EQ(StringExpression::CalculateExp("calc((100% - 20px) / 3 + 4px)", ConvertToPx), 64.0);
+    EXPECT_DOUBLE_EQ(StringExpression::CalculateExp("calc(10px - 4px - 2px)", ConvertToPx), 4.0);
+    EXPECT_DOUBLE_EQ(StringExpression::CalculateExp("calc(-10px + 50%)", ConvertToPx), 90.0);
+    EXPECT_DOUBLE_EQ(StringExpression::CalculateExp("calc(10px / 0)", ConvertToPx), 0.0);
+}
+
+/**
+ * @tc.name: StringExpressionTest002
+ * @tc.desc: Invalid expressions are compiled to empty programs and evaluated to 0.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StringExpressionTest, StringExpressionTest002, TestSize.Level1)
+{
+    EXPECT_TRUE(StringExpression::CompileExp("calc(10px +)").Empty());
+    EXPECT_TRUE(StringExpression::CompileExp("calc((10px + 2px)").Empty());
+    EXPECT_TRUE(StringExpression::CompileExp("calc(10px + 2px))").Empty());
+    EXPECT_TRUE(StringExpression::CompileExp("calc(10px 2px)").Empty());
+    EXPECT_TRUE(StringExpression::CompileExp("").Empty());
+    EXPECT_DOUBLE_EQ(StringExpression::CalculateExp("calc(* 10px)", ConvertToPx), 0.0);
+}
+
+/**
+ * @tc.name: StringExpressionTest003
+ * @tc.desc: CalcDimension compiles the expression once and shares the program with its copies.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StringExpressionTest, StringExpressionTest003, TestSize.Level1)
+{
+    CalcDimension dimension("calc(50% + 10vp)");
+    const auto& program = dimension.GetCalcProgram();
+    EXPECT_EQ(program.instructions.size(), 3);
+    EXPECT_EQ(program.stackDepth, 2);
+    EXPECT_DOUBLE_EQ(StringExpression::CalculateExp(program, ConvertToPx), 120.0);
+
+    CalcDimension copy;
+    copy = dimension;
+    EXPECT_EQ(&copy.GetCalcProgram(), &program);
+    EXPECT_EQ(copy.CalcValue(), dimension.CalcValue());
+
+    copy.SetCalcValue("");
+    EXPECT_TRUE(copy.GetCalcProgram().Empty());
+    EXPECT_DOUBLE_EQ(StringExpression::CalculateExp(dimension.GetCalcProgram(), ConvertToPx), 120.0);
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/json/json_view.h"
+#include "base/log/ace_trace.h"
+#include "base/log/trace_recorder.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t THREAD_COUNT = 4;
+constexpr int32_t TRACE_COUNT_PER_THREAD = 100;
+constexpr int32_t CONCURRENT_TRACE_COUNT = 200000;
+
+std::vector<std::string> GetEventNames(const std::string& json, const std::string& phase)
+{
+    std::vector<std::string> names;
+    auto document = JsonDocument::ParseView(json);
+    if (!document) {
+        return names;
+    }
+    auto events = document->GetRoot()->GetValue("traceEvents");
+    for (auto event = events->GetChild(); event; event = event->GetNext()) {
+        if (event->GetString("ph") == phase) {
+            names.emplace_back(event->GetString("name"));
+        }
+    }
+    return names;
+}
+
+uint32_t BeginAtSite(TraceSite& site, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    auto nameId = TraceRecorder::GetInstance().Begin(&site, format, args);
+    va_end(args);
+    TraceRecorder::GetInstance().End();
+    return nameId;
+}
+
+} // namespace
+
+class TraceRecorderTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+
+    void SetUp() override
+    {
+        TraceRecorder::GetInstance().Clear();
+        TraceRecorder::GetInstance().Start();
+    }
+
+    void TearDown() override
+    {
+        TraceRecorder::GetInstance().Stop();
+        TraceRecorder::GetInstance().Clear();
+    }
+};
+
+/**
+ * @tc.name: TraceRecorderTest001
+ * @tc.desc: Scoped traces are recorded and exported as pairs of begin and end, with formatted names.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TraceRecorderTest, TraceRecorderTest001, TestSize.Level1)
+{
+    {
+        ACE_SCOPED_TRACE("Outer");
+        {
+            ACE_SCOPED_TRACE("Layout[%s][self:%d][parent:%lld]", "Column", 12, -3LL);
+            {
+                ACE_SCOPED_TRACE("Measure %zu %u %.2f %x %c%%", static_cast<size_t>(7), 8u, 1.5, 255u, 'z');
+            }
+        }
+    }
+    EXPECT_EQ(TraceRecorder::GetInstance().GetRecordCount(), 6u);
+
+    auto json = TraceRecorder::GetInstance().Export();
+    std::vector<std::string> expected = { "Outer", "Layout[Column][self:12][parent:-3]", "Measure 7 8 1.50 ff z%" };
+    EXPECT_EQ(GetEventNames(json, "B"), expected);
+    EXPECT_EQ(GetEventNames(json, "E").size(), 3u);
+
+    TraceRecorder::GetInstance().Stop();
+    {
+        ACE_SCOPED_TRACE("NotRecorded");
+    }
+    EXPECT_EQ(TraceRecorder::GetInstance().GetRecordCount(), 6u);
+}
+
+/**
+ * @tc.name: TraceRecorderTest002
+ * @tc.desc: Long strings are truncated, formats which can't be deferred are formatted when recorded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TraceRecorderTest, TraceRecorderTest002, TestSize.Level1)
+{
+    std::string longText(TraceRecord::ARGS_SIZE * 2, 'a');
+    {
+        ACE_SCOPED_TRACE("Long %s %d", longText.c_str(), 1);
+    }
+    {
+        ACE_SCOPED_TRACE("Width %*d", 4, 2);
+    }
+    auto names = GetEventNames(TraceRecorder::GetInstance().Export(), "B");
+    ASSERT_EQ(names.size(), 2u);
+    EXPECT_EQ(names[0], "Long " + std::string(TraceRecord::ARGS_SIZE - 1, 'a') + " ?");
+    EXPECT_EQ(names[1], "Width    2");
+}
+
+/**
+ * @tc.name: TraceRecorderTest003
+ * @tc.desc: Only the latest records are kept in the ring, and ends without begins are dropped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TraceRecorderTest, TraceRecorderTest003, TestSize.Level1)
+{
+    {
+        ACE_SCOPED_TRACE("Frame");
+        for (size_t index = 0; index < TraceRecorder::RECORD_CAPACITY; ++index) {
+            ACE_SCOPED_TRACE("Task %zu", index);
+        }
+    }
+    EXPECT_EQ(TraceRecorder::GetInstance().GetRecordCount(), TraceRecorder::RECORD_CAPACITY);
+    auto json = TraceRecorder::GetInstance().Export();
+    auto begins = GetEventNames(json, "B");
+    // the oldest record kept is the end of a task, the end of frame is dropped as its begin is overwritten.
+    ASSERT_EQ(begins.size(), TraceRecorder::RECORD_CAPACITY / 2 - 1);
+    EXPECT_EQ(begins.back(), "Task " + std::to_string(TraceRecorder::RECORD_CAPACITY - 1));
+    EXPECT_EQ(GetEventNames(json, "E").size(), begins.size());
+}
+
+/**
+ * @tc.name: TraceRecorderTest004
+ * @tc.desc: Every thread records to its own buffer, async traces are exported with id.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TraceRecorderTest, TraceRecorderTest004, TestSize.Level1)
+{
+    std::vector<std::thread> threads;
+    for (int32_t threadIndex = 0; threadIndex < THREAD_COUNT; ++threadIndex) {
+        threads.emplace_back([threadIndex]() {
+            for (int32_t index = 0; index < TRACE_COUNT_PER_THREAD; ++index) {
+                ACE_SCOPED_TRACE("Thread %d", threadIndex);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    {
+        AceAsyncScopedTrace asyncTrace("Load %s", "image");
+    }
+    auto json = TraceRecorder::GetInstance().Export();
+    EXPECT_EQ(GetEventNames(json, "B").size(), static_cast<size_t>(THREAD_COUNT * TRACE_COUNT_PER_THREAD));
+    EXPECT_EQ(GetEventNames(json, "b"), std::vector<std::string> { "Load image" });
+    EXPECT_EQ(GetEventNames(json, "e"), std::vector<std::string> { "Load %s" });
+}
+
+/**
+ * @tc.name: TraceRecorderTest005
+ * @tc.desc: Records exported while the ring is overwritten are complete and in order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TraceRecorderTest, TraceRecorderTest005, TestSize.Level1)
+{
+    std::atomic<bool> finished { false };
+    std::thread thread([&finished]() {
+        for (int32_t index = 0; index < CONCURRENT_TRACE_COUNT; ++index) {
+            ACE_SCOPED_TRACE("Task %d", index);
+        }
+        finished.store(true);
+    });
+    const std::string prefix = "Task ";
+    while (!finished.load()) {
+        int32_t lastIndex = -1;
+        for (const auto& name : GetEventNames(TraceRecorder::GetInstance().Export(), "B")) {
+            ASSERT_EQ(name.compare(0, prefix.size(), prefix), 0);
+            auto index = std::stoi(name.substr(prefix.size()));
+            EXPECT_GT(index, lastIndex);
+            lastIndex = index;
+        }
+    }
+    thread.join();
+}
+
+/**
+ * @tc.name: TraceRecorderTest006
+ * @tc.desc: The name is cached at the call site, other formats at the same site are still recorded with their names.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TraceRecorderTest, TraceRecorderTest006, TestSize.Level1)
+{
+    TraceSite site;
+    auto firstId = BeginAtSite(site, "Site %d", 1);
+    EXPECT_NE(firstId, 0u);
+    EXPECT_EQ(BeginAtSite(site, "Site %d", 2), firstId);
+    auto otherId = BeginAtSite(site, "Other %s", "format");
+    EXPECT_NE(otherId, 0u);
+    EXPECT_NE(otherId, firstId);
+    EXPECT_EQ(BeginAtSite(site, "Site %d", 3), firstId);
+
+    std::vector<std::string> expected = { "Site 1", "Site 2", "Other format", "Site 3" };
+    EXPECT_EQ(GetEventNames(TraceRecorder::GetInstance().Export(), "B"), expected);
+}
+
+/**
+ * @tc.name: TraceRecorderTest007
+ * @tc.desc: Records are exported to a file, as ACE_TRACE_RECORDER does at exit.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TraceRecorderTest, TraceRecorderTest007, TestSize.Level1)
+{
+    {
+        ACE_SCOPED_TRACE("Export %d", 1);
+    }
+    const std::string path = "trace_recorder_test.json";
+    ASSERT_TRUE(TraceRecorder::GetInstance().ExportToFile(path));
+    std::ifstream file(path);
+    std::stringstream json;
+    json << file.rdbuf();
+    file.close();
+    std::remove(path.c_str());
+    EXPECT_EQ(GetEventNames(json.str(), "B"), std::vector<std::string> { "Export 1" });
+    EXPECT_FALSE(TraceRecorder::GetInstance().ExportToFile("/nonexistent/trace_recorder_test.json"));
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/thread/work_stealing_queue.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr int32_t ITEM_COUNT = 100000;
+constexpr int32_t THIEF_COUNT = 3;
+} // namespace
+
+class WorkStealingQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: WorkStealingQueueTest001
+ * @tc.desc: Owner pops the latest item and thief steals the earliest item, the queue grows when full.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WorkStealingQueueTest, WorkStealingQueueTest001, TestSize.Level1)
+{
+    WorkStealingQueue<int32_t> queue(2);
+    EXPECT_TRUE(queue.Empty());
+    for (int32_t value = 0; value < 5; ++value) {
+        queue.Push(std::make_unique<int32_t>(value));
+    }
+    EXPECT_FALSE(queue.Empty());
+    EXPECT_EQ(*queue.Pop(), 4);
+    EXPECT_EQ(*queue.Steal(), 0);
+    EXPECT_EQ(*queue.Steal(), 1);
+    EXPECT_EQ(*queue.Pop(), 3);
+    EXPECT_EQ(*queue.Pop(), 2);
+    EXPECT_EQ(queue.Pop(), nullptr);
+    EXPECT_EQ(queue.Steal(), nullptr);
+    EXPECT_TRUE(queue.Empty());
+}
+
+/**
+ * @tc.name: WorkStealingQueueTest002
+ * @tc.desc: Every item is taken exactly once when thieves steal while the owner pushes and pops.
+ * @tc.type: FUNC
+ */
+HWTEST_F(WorkStealingQueueTest, WorkStealingQueueTest002, TestSize.Level1)
+{
+    WorkStealingQueue<int32_t> queue;
+    std::vector<std::atomic<int32_t>> takenCounts(ITEM_COUNT);
+    std::atomic<int32_t> totalTaken { 0 };
+    std::atomic<bool> done { false };
+
+    auto take = [&takenCounts, &totalTaken](std::unique_ptr<int32_t>&& item) {
+        if (item) {
+            ++takenCounts[*item];
+            ++totalTaken;
+        }
+    };
+
+    std::vector<std::thread> thieves;
+    for (int32_t idx = 0; idx < THIEF_COUNT; ++idx) {
+        thieves.emplace_back([&queue, &done, &take]() {
+            while (!done) {
+                take(queue.Steal());
+            }
+        });
+    }
+    for (int32_t value = 0; value < ITEM_COUNT; ++value) {
+        queue.Push(std::make_unique<int32_t>(value));
+        if (value % 3 == 0) {
+            take(queue.Pop());
+        }
+    }
+    while (totalTaken < ITEM_COUNT) {
+        take(queue.Pop());
+    }
+    done = true;
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    EXPECT_EQ(totalTaken, ITEM_COUNT);
+    for (const auto& count : takenCounts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+} // namespace OHOS::Ace
@@ -15,17 +15,22 @@
 
 #include "base/thread/background_task_executor.h"
 
+#include <algorithm>
 #include <pthread.h>
 #include <string>
 
 #include "base/log/log.h"
 #include "base/memory/memory_monitor.h"
+#include "base/thread/work_stealing_queue.h"
 
 namespace OHOS::Ace {
 namespace {
 
-constexpr size_t MAX_BACKGROUND_THREADS = 3;
-constexpr uint32_t PURGE_FLAG_MASK = (1 << MAX_BACKGROUND_THREADS) - 1;
+constexpr size_t DEFAULT_BACKGROUND_THREADS = 3;
+constexpr size_t MIN_BACKGROUND_THREADS = 2;
+constexpr size_t MAX_BACKGROUND_THREADS = 8;
+// Max count of injected tasks taken by a thread at one time, the others can steal them from its queue.
+constexpr size_t MAX_BATCH_SIZE = 8;
 
 void SetThreadName(uint32_t threadNo)
 {
@@ -38,16 +43,41 @@ void SetThreadName(uint32_t threadNo)
 #endif
 }
 
+size_t GetBackgroundThreadNum()
+{
+    // Leave one core for the UI thread.
+    size_t coreNum = std::thread::hardware_concurrency();
+    if (coreNum == 0) {
+        return DEFAULT_BACKGROUND_THREADS;
+    }
+    return std::clamp(coreNum - 1, MIN_BACKGROUND_THREADS, MAX_BACKGROUND_THREADS);
+}
+
 } // namespace
 
+struct BackgroundTaskExecutor::Worker {
+    std::array<WorkStealingQueue<Task>, PRIORITY_COUNT> queues;
+    std::atomic<bool> needPurge { false };
+    size_t index = 0;
+};
+
+thread_local BackgroundTaskExecutor::Worker* BackgroundTaskExecutor::currentWorker_ = nullptr;
+
 BackgroundTaskExecutor& BackgroundTaskExecutor::GetInstance()
 {
     static BackgroundTaskExecutor instance;
     return instance;
 }
 
-BackgroundTaskExecutor::BackgroundTaskExecutor() : maxThreadNum_(MAX_BACKGROUND_THREADS)
+BackgroundTaskExecutor::BackgroundTaskExecutor() : maxThreadNum_(GetBackgroundThreadNum())
 {
+    // Workers are created before threads, so their queues can be stolen at any time.
+    workers_.reserve(maxThreadNum_);
+    for (size_t idx = 0; idx < maxThreadNum_; ++idx) {
+        workers_.emplace_back(std::make_unique<Worker>());
+        workers_.back()->index = idx;
+    }
+
     if (maxThreadNum_ > 1) {
         // Start other threads in the first created thread.
         PostTask([this, num = maxThreadNum_ - 1]() { StartNewThreads(num); });
@@ -78,45 +108,150 @@ bool BackgroundTaskExecutor::PostTask(Task&& task, BgTaskPriority priority)
     if (!task) {
         return false;
     }
+    std::vector<std::unique_ptr<Task>> tasks;
+    tasks.emplace_back(std::make_unique<Task>(std::move(task)));
+    return PushTasks(std::move(tasks), priority);
+}
 
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (!running_) {
+bool BackgroundTaskExecutor::PostTask(const Task& task, BgTaskPriority priority)
+{
+    if (!task) {
         return false;
     }
-    switch (priority) {
-        case BgTaskPriority::LOW:
-            lowPriorityTasks_.emplace_back(std::move(task));
-            break;
-        default:
-            tasks_.emplace_back(std::move(task));
-            break;
-    }
-    condition_.notify_one();
-    return true;
+    std::vector<std::unique_ptr<Task>> tasks;
+    tasks.emplace_back(std::make_unique<Task>(task));
+    return PushTasks(std::move(tasks), priority);
 }
 
-bool BackgroundTaskExecutor::PostTask(const Task& task, BgTaskPriority priority)
+bool BackgroundTaskExecutor::PostTasks(std::vector<Task>&& tasks, BgTaskPriority priority)
 {
-    if (!task) {
+    std::vector<std::unique_ptr<Task>> taskPtrs;
+    taskPtrs.reserve(tasks.size());
+    for (auto& task : tasks) {
+        if (task) {
+            taskPtrs.emplace_back(std::make_unique<Task>(std::move(task)));
+        }
+    }
+    tasks.clear();
+    if (taskPtrs.empty()) {
         return false;
     }
+    return PushTasks(std::move(taskPtrs), priority);
+}
 
-    std::lock_guard<std::mutex> lock(mutex_);
+bool BackgroundTaskExecutor::PushTasks(std::vector<std::unique_ptr<Task>>&& tasks, BgTaskPriority priority)
+{
     if (!running_) {
         return false;
     }
-    switch (priority) {
-        case BgTaskPriority::LOW:
-            lowPriorityTasks_.emplace_back(task);
-            break;
-        default:
-            tasks_.emplace_back(task);
-            break;
+    auto lane = static_cast<size_t>(priority);
+    if (lane >= PRIORITY_COUNT) {
+        LOGE("Invalid priority of background task: %{public}zu", lane);
+        return false;
+    }
+    size_t num = tasks.size();
+    if (currentWorker_ != nullptr) {
+        // Posted from a background thread, no lock is needed.
+        auto& queue = currentWorker_->queues[lane];
+        for (auto& task : tasks) {
+            queue.Push(std::move(task));
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return false;
+        }
+        auto& injectedTasks = injectedTasks_[lane];
+        for (auto& task : tasks) {
+            injectedTasks.emplace_back(std::move(task));
+        }
+        injectedTaskNum_[lane] += num;
     }
-    condition_.notify_one();
+    ++taskSequence_;
+    WakeUpThreads(num);
     return true;
 }
 
+void BackgroundTaskExecutor::WakeUpThreads(size_t num)
+{
+    // taskSequence_ is increased before reading idleThreadNum_, and an idle thread checks taskSequence_ after
+    // increasing idleThreadNum_, so either the task is seen by the idle thread or the idle thread is notified.
+    size_t idleThreadNum = idleThreadNum_.load();
+    if (idleThreadNum == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (num >= idleThreadNum) {
+        condition_.notify_all();
+        return;
+    }
+    for (size_t idx = 0; idx < num; ++idx) {
+        condition_.notify_one();
+    }
+}
+
+std::unique_ptr<BackgroundTaskExecutor::Task> BackgroundTaskExecutor::FindTask(Worker& worker)
+{
+    for (size_t lane = 0; lane < PRIORITY_COUNT; ++lane) {
+        auto task = worker.queues[lane].Pop();
+        if (task) {
+            return task;
+        }
+        task = TakeInjectedTasks(worker, lane);
+        if (task) {
+            return task;
+        }
+        task = StealTask(worker, lane);
+        if (task) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+std::unique_ptr<BackgroundTaskExecutor::Task> BackgroundTaskExecutor::TakeInjectedTasks(Worker& worker, size_t lane)
+{
+    if (injectedTaskNum_[lane].load(std::memory_order_relaxed) == 0) {
+        return nullptr;
+    }
+    std::unique_ptr<Task> task;
+    size_t batchSize = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& injectedTasks = injectedTasks_[lane];
+        if (injectedTasks.empty()) {
+            return nullptr;
+        }
+        // Take a fair share of injected tasks, and keep the others in own queue to be stolen.
+        batchSize = std::min((injectedTasks.size() + maxThreadNum_ - 1) / maxThreadNum_, MAX_BATCH_SIZE);
+        task = std::move(injectedTasks.front());
+        injectedTasks.pop_front();
+        for (size_t idx = 1; idx < batchSize; ++idx) {
+            worker.queues[lane].Push(std::move(injectedTasks.front()));
+            injectedTasks.pop_front();
+        }
+        injectedTaskNum_[lane] -= batchSize;
+    }
+    if (batchSize > 1) {
+        // the others are in own queue now, let the idle threads steal them.
+        ++taskSequence_;
+        WakeUpThreads(batchSize - 1);
+    }
+    return task;
+}
+
+std::unique_ptr<BackgroundTaskExecutor::Task> BackgroundTaskExecutor::StealTask(const Worker& worker, size_t lane)
+{
+    for (size_t idx = 1; idx < maxThreadNum_; ++idx) {
+        auto& victim = workers_[(worker.index + idx) % maxThreadNum_];
+        auto task = victim->queues[lane].Steal();
+        if (task) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
 void BackgroundTaskExecutor::StartNewThreads(size_t num)
 {
     uint32_t currentThreadNo = 0;
@@ -160,38 +295,34 @@ void BackgroundTaskExecutor::ThreadLoop(uint32_t threadNo)
 
     SetThreadName(threadNo);
 
-    Task task;
-    const uint32_t purgeFlag = (1 << (threadNo - 1));
-    std::unique_lock<std::mutex> lock(mutex_);
+    auto& worker = *workers_[threadNo - 1];
+    currentWorker_ = &worker;
     while (running_) {
-        if (tasks_.empty() && lowPriorityTasks_.empty()) {
-            if ((purgeFlags_ & purgeFlag) != purgeFlag) {
-                condition_.wait(lock);
-                continue;
-            }
+        // read before looking for tasks, tasks made available after that change it and wake this thread.
+        auto sequence = taskSequence_.load();
+        auto task = FindTask(worker);
+        if (task) {
+            // Execute the task and clear after execution.
+            (*task)();
+            task.reset();
+            continue;
+        }
 
-            lock.unlock();
+        if (worker.needPurge.exchange(false)) {
             LOGD("Purge malloc cache for background thread %{public}u", threadNo);
             PurgeMallocCache();
-            lock.lock();
-            purgeFlags_ &= ~purgeFlag;
             continue;
         }
-        // deal with tasks_ first. do lowPriorityTasks_ only when all tasks_ done.
-        if (!tasks_.empty()) {
-            task = std::move(tasks_.front());
-            tasks_.pop_front();
-        } else {
-            task = std::move(lowPriorityTasks_.front());
-            lowPriorityTasks_.pop_front();
-        }
 
-        lock.unlock();
-        // Execute the task and clear after execution.
-        task();
-        task = nullptr;
-        lock.lock();
+        // nothing to pop or steal, sleep until tasks are posted instead of polling the queues of busy threads.
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++idleThreadNum_;
+        condition_.wait(lock, [this, &worker, sequence]() {
+            return !running_ || taskSequence_.load() != sequence || worker.needPurge;
+        });
+        --idleThreadNum_;
     }
+    currentWorker_ = nullptr;
 
     LOGD("Background thread is stopped");
 }
@@ -199,7 +330,9 @@ void BackgroundTaskExecutor::ThreadLoop(uint32_t threadNo)
 void BackgroundTaskExecutor::TriggerGarbageCollection()
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    purgeFlags_ = PURGE_FLAG_MASK;
+    for (auto& worker : workers_) {
+        worker->needPurge = true;
+    }
     condition_.notify_all();
 }
 
@@ -16,18 +16,30 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_BACKGROUND_TASK_EXECUTOR_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_BACKGROUND_TASK_EXECUTOR_H
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include "base/utils/noncopyable.h"
 
 namespace OHOS::Ace {
 
+// Tasks with higher priority are executed first, the declaration order is the order of execution.
 enum class BgTaskPriority {
+    HIGH,
     DEFAULT,
     LOW,
 };
 
+// Each background thread owns a lock-free work-stealing queue for every priority. Tasks posted from a background
+// thread are pushed into its own queues, tasks posted from other threads are injected into shared queues and taken
+// by background threads in batches. An idle thread steals tasks from other threads.
 class BackgroundTaskExecutor {
     ACE_DISALLOW_COPY_AND_MOVE(BackgroundTaskExecutor);
 
@@ -38,25 +50,47 @@ public:
 
     bool PostTask(Task&& task, BgTaskPriority priority = BgTaskPriority::DEFAULT);
     bool PostTask(const Task& task, BgTaskPriority priority = BgTaskPriority::DEFAULT);
+    // Post a batch of independent tasks which may be executed in parallel, with only one lock and wake-up.
+    bool PostTasks(std::vector<Task>&& tasks, BgTaskPriority priority = BgTaskPriority::DEFAULT);
 
     void TriggerGarbageCollection();
 
+    size_t GetThreadNum() const
+    {
+        return maxThreadNum_;
+    }
+
 private:
+    static constexpr size_t PRIORITY_COUNT = 3;
+    struct Worker;
+
     BackgroundTaskExecutor();
     ~BackgroundTaskExecutor();
 
     void StartNewThreads(size_t num = 1);
     void ThreadLoop(uint32_t threadNo);
 
+    bool PushTasks(std::vector<std::unique_ptr<Task>>&& tasks, BgTaskPriority priority);
+    std::unique_ptr<Task> FindTask(Worker& worker);
+    std::unique_ptr<Task> TakeInjectedTasks(Worker& worker, size_t lane);
+    std::unique_ptr<Task> StealTask(const Worker& worker, size_t lane);
+    void WakeUpThreads(size_t num);
+
+    static thread_local Worker* currentWorker_;
+
     std::mutex mutex_;
     std::condition_variable condition_;
-    std::list<Task> tasks_;
-    std::list<Task> lowPriorityTasks_;
+    // Tasks posted from threads out of the pool, guarded by mutex_.
+    std::array<std::list<std::unique_ptr<Task>>, PRIORITY_COUNT> injectedTasks_;
+    std::array<std::atomic<size_t>, PRIORITY_COUNT> injectedTaskNum_ {};
+    // Increased whenever tasks are made available to other threads, idle threads wait until it changes.
+    std::atomic<uint64_t> taskSequence_ { 0 };
+    std::atomic<size_t> idleThreadNum_ { 0 };
+    std::vector<std::unique_ptr<Worker>> workers_;
     std::list<std::thread> threads_;
     size_t currentThreadNum_ { 0 };
     size_t maxThreadNum_ { 0 };
-    bool running_ { true };
-    uint32_t purgeFlags_ { 0 };
+    std::atomic<bool> running_ { true };
 };
 
 } // namespace OHOS::Ace
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_WORK_STEALING_QUEUE_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_WORK_STEALING_QUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// Lock-free Chase-Lev deque. The owner thread pushes and pops items at the bottom, other threads steal items from
+// the top. The buffer grows when full, the old buffers are kept until the queue is destroyed because a thief may
+// still read them.
+template<typename T>
+class WorkStealingQueue final {
+public:
+    explicit WorkStealingQueue(int64_t capacity = DEFAULT_CAPACITY)
+    {
+        buffers_.emplace_back(std::make_unique<Buffer>(capacity));
+        buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+    }
+
+    ~WorkStealingQueue()
+    {
+        while (Pop()) {}
+    }
+
+    // Called by the owner thread only.
+    void Push(std::unique_ptr<T>&& item)
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_acquire);
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        if (bottom - top > buffer->capacity - 1) {
+            buffer = Grow(buffer, top, bottom);
+        }
+        buffer->Put(bottom, item.release());
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    // Called by the owner thread only, returns the latest pushed item.
+    std::unique_ptr<T> Pop()
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+        // Sequential consistency makes sure the thieves see the new bottom before the owner reads top.
+        bottom_.store(bottom, std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_seq_cst);
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T* item = buffer->Get(bottom);
+        if (top == bottom) {
+            // The last item, race with thieves.
+            if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return std::unique_ptr<T>(item);
+    }
+
+    // Called by any thread, returns the earliest pushed item, or nullptr if the queue is empty or the item is taken
+    // by another thread at the same time.
+    std::unique_ptr<T> Steal()
+    {
+        int64_t top = top_.load(std::memory_order_seq_cst);
+        int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+        if (top >= bottom) {
+            return nullptr;
+        }
+        Buffer* buffer = buffer_.load(std::memory_order_acquire);
+        T* item = buffer->Get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return std::unique_ptr<T>(item);
+    }
+
+    // The result is not exact when other threads are stealing.
+    bool Empty() const
+    {
+        return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr int64_t DEFAULT_CAPACITY = 64;
+
+    struct Buffer final {
+        explicit Buffer(int64_t size) : capacity(size), mask(size - 1), items(new std::atomic<T*>[size]) {}
+
+        T* Get(int64_t index) const
+        {
+            return items[index & mask].load(std::memory_order_relaxed);
+        }
+
+        void Put(int64_t index, T* item)
+        {
+            items[index & mask].store(item, std::memory_order_relaxed);
+        }
+
+        // Capacity must be power of 2.
+        const int64_t capacity;
+        const int64_t mask;
+        std::unique_ptr<std::atomic<T*>[]> items;
+    };
+
+    Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom)
+    {
+        auto newBuffer = std::make_unique<Buffer>(buffer->capacity * 2);
+        for (int64_t index = top; index < bottom; ++index) {
+            newBuffer->Put(index, buffer->Get(index));
+        }
+        buffer = newBuffer.get();
+        buffers_.emplace_back(std::move(newBuffer));
+        buffer_.store(buffer, std::memory_order_release);
+        return buffer;
+    }
+
+    std::atomic<int64_t> top_ { 0 };
+    std::atomic<int64_t> bottom_ { 0 };
+    std::atomic<Buffer*> buffer_ { nullptr };
+    // Only accessed by the owner thread.
+    std::vector<std::unique_ptr<Buffer>> buffers_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(WorkStealingQueue);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_THREAD_WORK_STEALING_QUEUE_H
@@ -15,12 +15,174 @@
 
 #include "base/utils/string_expression.h"
 
-#include <regex>
+#include <algorithm>
+#include <array>
 
 #include "base/log/log.h"
 #include "base/utils/string_utils.h"
 
 namespace OHOS::Ace::StringExpression {
+namespace {
+
+constexpr char CALC_KEYWORD[] = "calc";
+constexpr size_t CALC_KEYWORD_LENGTH = sizeof(CALC_KEYWORD) - 1;
+constexpr size_t MAX_LOCAL_STACK_DEPTH = 16;
+
+bool IsOperator(char ch)
+{
+    return ch == '+' || ch == '-' || ch == '*' || ch == '/';
+}
+
+bool IsDelimiter(char ch)
+{
+    return ch == ' ' || ch == '(' || ch == ')' || IsOperator(ch);
+}
+
+int32_t GetPriority(char op)
+{
+    return (op == '*' || op == '/') ? 1 : 0;
+}
+
+CalcOpCode ToOpCode(char op)
+{
+    switch (op) {
+        case '+':
+            return CalcOpCode::ADD;
+        case '-':
+            return CalcOpCode::SUB;
+        case '*':
+            return CalcOpCode::MUL;
+        default:
+            return CalcOpCode::DIV;
+    }
+}
+
+} // namespace
+
+CalcProgram CompileExp(const std::string& expression)
+{
+    CalcProgram program;
+    // Pending operators and left parentheses.
+    std::vector<char> opStack;
+    size_t depth = 0;
+    auto emitOperator = [&program, &opStack, &depth]() {
+        program.instructions.push_back({ ToOpCode(opStack.back()), Dimension() });
+        opStack.pop_back();
+        --depth;
+    };
+    auto onError = [&expression]() {
+        LOGE("ExpressionError, invalid calc expression: %{public}s", expression.c_str());
+        return CalcProgram();
+    };
+
+    bool expectOperand = true;
+    size_t pos = 0;
+    while (pos < expression.size()) {
+        char ch = expression[pos];
+        if (ch == ' ') {
+            ++pos;
+            continue;
+        }
+        if (expectOperand) {
+            if (expression.compare(pos, CALC_KEYWORD_LENGTH, CALC_KEYWORD) == 0) {
+                pos += CALC_KEYWORD_LENGTH;
+                continue;
+            }
+            if (ch == '(') {
+                opStack.push_back(ch);
+                ++pos;
+                continue;
+            }
+            // Sign is a part of the number, such as "-10px".
+            size_t start = pos;
+            if (ch == '+' || ch == '-') {
+                ++pos;
+            }
+            size_t numberStart = pos;
+            while (pos < expression.size() && !IsDelimiter(expression[pos])) {
+                ++pos;
+            }
+            if (pos == numberStart) {
+                return onError();
+            }
+            program.instructions.push_back({ CalcOpCode::OPERAND,
+                StringUtils::StringToDimensionWithUnit(expression.substr(start, pos - start)) });
+            program.stackDepth = std::max(program.stackDepth, ++depth);
+            expectOperand = false;
+            continue;
+        }
+        if (ch == ')') {
+            while (!opStack.empty() && opStack.back() != '(') {
+                emitOperator();
+            }
+            if (opStack.empty()) {
+                return onError();
+            }
+            opStack.pop_back();
+            ++pos;
+            continue;
+        }
+        if (!IsOperator(ch)) {
+            return onError();
+        }
+        while (!opStack.empty() && opStack.back() != '(' && GetPriority(opStack.back()) >= GetPriority(ch)) {
+            emitOperator();
+        }
+        opStack.push_back(ch);
+        expectOperand = true;
+        ++pos;
+    }
+    if (expectOperand) {
+        return onError();
+    }
+    while (!opStack.empty()) {
+        if (opStack.back() == '(') {
+            return onError();
+        }
+        emitOperator();
+    }
+    return program;
+}
+
+double CalculateExp(const CalcProgram& program, const std::function<double(const Dimension&)>& calcFunc)
+{
+    if (program.Empty()) {
+        LOGE("ExpressionError, expression is empty");
+        return 0.0;
+    }
+    // Avoid allocation for common expressions.
+    std::array<double, MAX_LOCAL_STACK_DEPTH> localStack;
+    std::vector<double> heapStack;
+    double* stack = localStack.data();
+    if (program.stackDepth > MAX_LOCAL_STACK_DEPTH) {
+        heapStack.resize(program.stackDepth);
+        stack = heapStack.data();
+    }
+    size_t top = 0;
+    for (const auto& instruction : program.instructions) {
+        if (instruction.opCode == CalcOpCode::OPERAND) {
+            stack[top++] = calcFunc(instruction.operand);
+            continue;
+        }
+        double rhs = stack[--top];
+        double& lhs = stack[top - 1];
+        switch (instruction.opCode) {
+            case CalcOpCode::ADD:
+                lhs += rhs;
+                break;
+            case CalcOpCode::SUB:
+                lhs -= rhs;
+                break;
+            case CalcOpCode::MUL:
+                lhs *= rhs;
+                break;
+            default:
+                lhs = NearZero(rhs) ? 0.0 : lhs / rhs;
+                break;
+        }
+    }
+    return stack[0];
+}
 void InitMapping(std::map<std::string, int>& mapping)
 {
     mapping["+"] = 0;
@@ -36,12 +198,13 @@ std::vector<std::string> ConvertDal2Rpn(std::string formula)
     std::vector<std::string> result;
     std::vector<std::string> opStack;
     std::map<std::string, int> OpMapping;
+    InitMapping(OpMapping);
     std::string curNum, curOp;
-    std::regex calc("calc");
-    std::regex space(" ");
     std::string ops = "+-*/()";
-    formula = regex_replace(formula, calc, "");
-    formula = regex_replace(formula, space, "");
+    for (auto pos = formula.find(CALC_KEYWORD); pos != std::string::npos; pos = formula.find(CALC_KEYWORD, pos)) {
+        formula.erase(pos, CALC_KEYWORD_LENGTH);
+    }
+    formula.erase(std::remove(formula.begin(), formula.end(), ' '), formula.end());
     for (char i : formula) {
         if (ops.find(i) == ops.npos) {
             curNum += i;
@@ -89,43 +252,6 @@ std::vector<std::string> ConvertDal2Rpn(std::string formula)
 
 double CalculateExp(const std::string& expression, const std::function<double(const Dimension&)>& calcFunc)
 {
-    std::vector<std::string> rpnexp = ConvertDal2Rpn(expression);
-    std::vector<double> result;
-    double num = 0.0;
-    std::string ops = "+-*/()";
-    for (auto& i : rpnexp) {
-        if (ops.find(i) == ops.npos) {
-            std::string value = i;
-            Dimension dim = StringUtils::StringToDimensionWithUnit(value);
-            num = calcFunc(dim);
-            result.push_back(num);
-        } else {
-            if (result.size() < 2) {
-                LOGE("ExpressionError, size < 2");
-                return 0.0;
-            }
-            double num1 = result.back();
-            result.pop_back();
-            double num2 = result.back();
-            result.pop_back();
-            double opRes = 0.0;
-            if (i == "+") {
-                opRes = num2 + num1;
-            } else if (i == "-") {
-                opRes = num2 - num1;
-            } else if (i == "*") {
-                opRes = num2 * num1;
-            } else if (i == "/" && !NearZero(num1)) {
-                opRes = num2 / num1;
-            }
-            result.push_back(opRes);
-        }
-    }
-    if (result.size() == 1) {
-        return result.back();
-    } else {
-        LOGE("ExpressionError");
-        return 0.0;
-    }
+    return CalculateExp(CompileExp(expression), calcFunc);
 }
 } // namespace OHOS::Ace::StringExpression
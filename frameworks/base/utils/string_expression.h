@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_STRING_EXPRESSION_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_STRING_EXPRESSION_H
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
@@ -25,6 +26,37 @@
 
 namespace OHOS::Ace::StringExpression {
 
+enum class CalcOpCode : uint8_t {
+    OPERAND = 0,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+};
+
+struct CalcInstruction {
+    CalcOpCode opCode = CalcOpCode::OPERAND;
+    // Only valid for OPERAND.
+    Dimension operand;
+};
+
+// Calc expression compiled to reverse polish notation, evaluated without any string work.
+struct CalcProgram {
+    std::vector<CalcInstruction> instructions;
+    // Max depth of the operand stack during evaluation.
+    size_t stackDepth = 0;
+
+    bool Empty() const
+    {
+        return instructions.empty();
+    }
+};
+
+// Parse expression such as "calc(100% - 2 * 10vp)", returns empty program if the expression is invalid.
+CalcProgram CompileExp(const std::string& expression);
+
+double CalculateExp(const CalcProgram& program, const std::function<double(const Dimension&)>& calcFunc);
+
 void InitMapping(std::map<std::string, int>& mapping);
 
 std::vector<std::string> ConvertDal2Rpn(std::string formula);
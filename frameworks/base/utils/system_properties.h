@@ -216,6 +216,26 @@ public:
         return gpuUploadEnabled_;
     }
 
+    static bool GetParallelLayoutEnabled()
+    {
+        return parallelLayoutEnabled_;
+    }
+
+    static bool GetParallelRenderEnabled()
+    {
+        return parallelRenderEnabled_;
+    }
+
+    static bool GetTouchCoalesceEnabled()
+    {
+        return touchCoalesceEnabled_;
+    }
+
+    static bool GetTouchResampleEnabled()
+    {
+        return touchResampleEnabled_;
+    }
+
     /*
      * Set device orientation.
      */
@@ -320,6 +340,10 @@ private:
     static bool debugEnabled_;
     static bool debugBoundaryEnabled_;
     static bool gpuUploadEnabled_;
+    static bool parallelLayoutEnabled_;
+    static bool parallelRenderEnabled_;
+    static bool touchCoalesceEnabled_;
+    static bool touchResampleEnabled_;
     static bool isHookModeEnabled_;
 };
 
@@ -966,9 +966,8 @@ bool JsCardParser::SelectStyle(const std::string& className, const std::unique_p
 void JsCardParser::SelectMediaQueryStyle(
     const std::string& styleClass, std::vector<std::pair<std::string, std::string>>& styles)
 {
-    const auto& mediaFeature = mediaQueryer_.GetMediaFeature();
     for (const auto& iter : mediaQueryStyles_) {
-        if (mediaQueryer_.MatchCondition(iter.first, mediaFeature)) {
+        if (mediaQueryer_.MatchCondition(iter.first)) {
             auto mediaIter = mediaQueryStyles_.find(iter.first);
             if (mediaIter != mediaQueryStyles_.end()) {
                 if (!SelectStyle(styleClass, mediaIter->second, styles)) {
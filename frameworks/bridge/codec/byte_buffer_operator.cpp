@@ -16,11 +16,49 @@
 #include "frameworks/bridge/codec/byte_buffer_operator.h"
 
 namespace OHOS::Ace::Framework {
+namespace {
+
+constexpr uint32_t VARINT_VALUE_BITS = 7;
+constexpr uint8_t VARINT_VALUE_MASK = 0x7F;
+constexpr uint8_t VARINT_CONTINUE_BIT = 0x80;
+// 5 bytes carry 35 bits, enough for uint32_t.
+constexpr uint32_t VARINT_MAX_BYTES = 5;
+
+} // namespace
+
+bool ByteBufferReader::ReadLength(uint32_t& length) const
+{
+    if (encoding_ == LengthEncoding::FIXED_INT32) {
+        int32_t fixedLength = -1;
+        if (!ReadData(fixedLength) || fixedLength < 0) {
+            return false;
+        }
+        length = static_cast<uint32_t>(fixedLength);
+        return true;
+    }
+    uint64_t value = 0;
+    for (uint32_t index = 0; index < VARINT_MAX_BYTES; ++index) {
+        uint8_t byte = 0;
+        if (!ReadData(byte)) {
+            return false;
+        }
+        value |= static_cast<uint64_t>(byte & VARINT_VALUE_MASK) << (VARINT_VALUE_BITS * index);
+        if ((byte & VARINT_CONTINUE_BIT) == 0) {
+            if (value > UINT32_MAX) {
+                return false;
+            }
+            length = static_cast<uint32_t>(value);
+            return true;
+        }
+    }
+    LOGW("Varint length is too long");
+    return false;
+}
 
 bool ByteBufferReader::ReadData(std::map<std::string, std::string>& mapValue) const
 {
-    int32_t size = -1;
-    if (!ReadData(size) || size < 0) {
+    uint32_t size = 0;
+    if (!ReadLength(size)) {
         LOGW("Could not read map size or map size is invalid");
         return false;
     }
@@ -29,7 +67,7 @@ bool ByteBufferReader::ReadData(std::map<std::string, std::string>& mapValue) co
 
     std::string key;
     std::string value;
-    for (int32_t idx = 0; idx < size; ++idx) {
+    for (uint32_t idx = 0; idx < size; ++idx) {
         if (!ReadData(key) || !ReadData(value)) {
             LOGW("Failed to read key or value");
             return false;
@@ -41,8 +79,8 @@ bool ByteBufferReader::ReadData(std::map<std::string, std::string>& mapValue) co
 
 bool ByteBufferReader::ReadData(std::set<std::string>& setValue) const
 {
-    int32_t size = -1;
-    if (!ReadData(size) || size < 0) {
+    uint32_t size = 0;
+    if (!ReadLength(size)) {
         LOGW("Could not read map size or map size is invalid");
         return false;
     }
@@ -50,7 +88,7 @@ bool ByteBufferReader::ReadData(std::set<std::string>& setValue) const
     setValue.clear();
 
     std::string value;
-    for (int32_t idx = 0; idx < size; ++idx) {
+    for (uint32_t idx = 0; idx < size; ++idx) {
         if (!ReadData(value)) {
             LOGW("Failed to read string value");
             return false;
@@ -60,9 +98,35 @@ bool ByteBufferReader::ReadData(std::set<std::string>& setValue) const
     return true;
 }
 
+void ByteBufferWriter::WriteLength(uint32_t length)
+{
+    if (encoding_ == LengthEncoding::FIXED_INT32) {
+        WriteData(static_cast<int32_t>(length));
+        return;
+    }
+    while (length > VARINT_VALUE_MASK) {
+        buffer_.push_back(static_cast<uint8_t>((length & VARINT_VALUE_MASK) | VARINT_CONTINUE_BIT));
+        length >>= VARINT_VALUE_BITS;
+    }
+    buffer_.push_back(static_cast<uint8_t>(length));
+}
+
+size_t ByteBufferWriter::GetLengthSize(uint32_t length, LengthEncoding encoding)
+{
+    if (encoding == LengthEncoding::FIXED_INT32) {
+        return sizeof(int32_t);
+    }
+    size_t size = 1;
+    while (length > VARINT_VALUE_MASK) {
+        length >>= VARINT_VALUE_BITS;
+        ++size;
+    }
+    return size;
+}
+
 void ByteBufferWriter::WriteData(const std::map<std::string, std::string>& mapValue)
 {
-    WriteData(static_cast<int32_t>(mapValue.size()));
+    WriteLength(static_cast<uint32_t>(mapValue.size()));
     for (const auto& [key, value] : mapValue) {
         WriteData(key);
         WriteData(value);
@@ -71,10 +135,10 @@ void ByteBufferWriter::WriteData(const std::map<std::string, std::string>& mapVa
 
 void ByteBufferWriter::WriteData(const std::set<std::string>& setValue)
 {
-    WriteData(static_cast<int32_t>(setValue.size()));
+    WriteLength(static_cast<uint32_t>(setValue.size()));
     for (const auto& value : setValue) {
         WriteData(value);
     }
 }
 
-} // namespace OHOS::Ace::Framework
\ No newline at end of file
+} // namespace OHOS::Ace::Framework
@@ -17,9 +17,11 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_BYTE_BUFFER_OPERATOR_H
 
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/log/log.h"
@@ -27,9 +29,22 @@
 
 namespace OHOS::Ace::Framework {
 
+// Encoding of the lengths of strings, arrays, maps and sets. FIXED_INT32 is the format of the platform side, VARINT
+// saves space of small lengths and is only used when both ends of the channel use it.
+enum class LengthEncoding : uint8_t {
+    FIXED_INT32 = 0,
+    VARINT,
+};
+
 class ByteBufferReader final {
 public:
-    explicit ByteBufferReader(const std::vector<uint8_t>& buffer) : buffer_(buffer) {}
+    explicit ByteBufferReader(const std::vector<uint8_t>& buffer, LengthEncoding encoding = LengthEncoding::FIXED_INT32)
+        : data_(buffer.data()), size_(buffer.size()), encoding_(encoding)
+    {}
+    // Read the buffer without copy, the buffer must outlive the reader.
+    ByteBufferReader(const uint8_t* data, size_t size, LengthEncoding encoding = LengthEncoding::FIXED_INT32)
+        : data_(data), size_(data == nullptr ? 0 : size), encoding_(encoding)
+    {}
     ~ByteBufferReader() = default;
 
     bool ReadData(uint8_t& value) const
@@ -52,6 +67,17 @@ public:
     {
         return ReadArray(value);
     }
+    // The string refers to the buffer.
+    bool ReadData(std::string_view& value) const
+    {
+        const uint8_t* data = nullptr;
+        uint32_t length = 0;
+        if (!ReadBytes(data, length, sizeof(char))) {
+            return false;
+        }
+        value = std::string_view(reinterpret_cast<const char*>(data), length);
+        return true;
+    }
 
     bool ReadData(std::vector<int8_t>& dst) const
     {
@@ -69,15 +95,35 @@ public:
     bool ReadData(std::map<std::string, std::string>& dst) const;
     bool ReadData(std::set<std::string>& dst) const;
 
+    // Read the length and the elements of an array without copy, elements in the buffer may be unaligned.
+    bool ReadBytes(const uint8_t*& data, uint32_t& length, size_t elementSize) const
+    {
+        if (!ReadLength(length) || static_cast<uint64_t>(length) * elementSize > size_ - readPos_) {
+            LOGW("Could not read array length or array length is invalid");
+            return false;
+        }
+        data = data_ + readPos_;
+        readPos_ += length * elementSize;
+        return true;
+    }
+
+    bool ReadLength(uint32_t& length) const;
+
+    size_t GetReadPosition() const
+    {
+        return readPos_;
+    }
+
 private:
     template<class T>
     bool ReadValue(T& value) const
     {
-        if (readPos_ + sizeof(T) > buffer_.size()) {
-            LOGW("Exceed buffer size, readPos = %{public}u, buffer size = %{public}zu", readPos_, buffer_.size());
+        if (sizeof(T) > size_ - readPos_) {
+            LOGW("Exceed buffer size, readPos = %{public}zu, buffer size = %{public}zu", readPos_, size_);
             return false;
         }
-        value = *reinterpret_cast<const T*>(buffer_.data() + readPos_);
+        // the value may be unaligned in the buffer.
+        memcpy(&value, data_ + readPos_, sizeof(T));
         readPos_ += sizeof(T);
         return true;
     }
@@ -85,27 +131,31 @@ private:
     template<class T>
     bool ReadArray(T& dst) const
     {
-        int32_t length = -1;
-        if (!ReadData(length) || length < 0 ||
-            readPos_ + static_cast<uint32_t>(sizeof(typename T::value_type) * length) > buffer_.size()) {
-            LOGW("Could not read array length or array length is invalid");
+        const uint8_t* data = nullptr;
+        uint32_t length = 0;
+        if (!ReadBytes(data, length, sizeof(typename T::value_type))) {
             return false;
         }
-        auto data = reinterpret_cast<const typename T::value_type*>(buffer_.data() + readPos_);
-        dst.assign(data, data + length);
-        readPos_ += static_cast<uint32_t>(sizeof(typename T::value_type) * length);
+        dst.resize(length);
+        if (length > 0) {
+            memcpy(&dst[0], data, sizeof(typename T::value_type) * length);
+        }
         return true;
     }
 
-    const std::vector<uint8_t>& buffer_;
-    mutable uint32_t readPos_ = 0;
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    LengthEncoding encoding_ = LengthEncoding::FIXED_INT32;
+    mutable size_t readPos_ = 0;
 
     ACE_DISALLOW_COPY_AND_MOVE(ByteBufferReader);
 };
 
 class ByteBufferWriter final {
 public:
-    ByteBufferWriter(std::vector<uint8_t>& buffer) : buffer_(buffer) {}
+    ByteBufferWriter(std::vector<uint8_t>& buffer, LengthEncoding encoding = LengthEncoding::FIXED_INT32)
+        : buffer_(buffer), encoding_(encoding)
+    {}
     ~ByteBufferWriter() = default;
 
     void WriteData(uint8_t value)
@@ -124,7 +174,7 @@ public:
     {
         WriteValue(value);
     }
-    void WriteData(const std::string& src)
+    void WriteData(std::string_view src)
     {
         WriteArray(src);
     }
@@ -145,6 +195,10 @@ public:
     void WriteData(const std::map<std::string, std::string>& mapValue);
     void WriteData(const std::set<std::string>& setValue);
 
+    void WriteLength(uint32_t length);
+
+    static size_t GetLengthSize(uint32_t length, LengthEncoding encoding);
+
 private:
     template<class T>
     void WriteValue(T value)
@@ -156,12 +210,13 @@ private:
     template<class T>
     void WriteArray(const T& array)
     {
-        WriteData(static_cast<int32_t>(array.size()));
+        WriteLength(static_cast<uint32_t>(array.size()));
         auto data = reinterpret_cast<const uint8_t*>(array.data());
         buffer_.insert(buffer_.end(), data, data + sizeof(typename T::value_type) * array.size());
     }
 
     std::vector<uint8_t>& buffer_;
+    LengthEncoding encoding_ = LengthEncoding::FIXED_INT32;
 
     ACE_DISALLOW_COPY_AND_MOVE(ByteBufferWriter);
 };
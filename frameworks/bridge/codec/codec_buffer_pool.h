@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_CODEC_BUFFER_POOL_H
+#define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_CODEC_BUFFER_POOL_H
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace::Framework {
+
+// Pool of byte buffers used by the codec, so encoding a message reuses the memory of the messages decoded before.
+// Buffers larger than MAX_BUFFER_SIZE are freed, such as those of image bytes, to keep the memory of the pool small.
+class CodecBufferPool final {
+public:
+    static constexpr size_t MAX_BUFFER_COUNT = 8;
+    static constexpr size_t MAX_BUFFER_SIZE = 1024 * 1024;
+
+    CodecBufferPool() = default;
+    ~CodecBufferPool() = default;
+
+    static CodecBufferPool& GetInstance()
+    {
+        static CodecBufferPool instance;
+        return instance;
+    }
+
+    // Returns an empty buffer with capacity of at least size.
+    std::vector<uint8_t> Acquire(size_t size = 0)
+    {
+        std::vector<uint8_t> buffer;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!buffers_.empty()) {
+                buffer = std::move(buffers_.back());
+                buffers_.pop_back();
+            }
+        }
+        buffer.reserve(size);
+        return buffer;
+    }
+
+    void Release(std::vector<uint8_t>&& buffer)
+    {
+        if (buffer.capacity() == 0 || buffer.capacity() > MAX_BUFFER_SIZE) {
+            return;
+        }
+        buffer.clear();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (buffers_.size() < MAX_BUFFER_COUNT) {
+            buffers_.emplace_back(std::move(buffer));
+        }
+    }
+
+    size_t GetIdleCount() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buffers_.size();
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::vector<uint8_t>> buffers_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(CodecBufferPool);
+};
+
+} // namespace OHOS::Ace::Framework
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_CODEC_BUFFER_POOL_H
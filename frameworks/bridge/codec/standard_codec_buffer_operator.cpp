@@ -16,6 +16,7 @@
 #include "frameworks/bridge/codec/standard_codec_buffer_operator.h"
 
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <set>
 #include <string>
@@ -39,6 +40,16 @@ inline bool ReadDataFromByteBuffer(const ByteBufferReader& buffer, CodecData& re
     return false;
 }
 
+template<class T>
+std::vector<T> CopyArray(const uint8_t* data, uint32_t length)
+{
+    std::vector<T> result(length);
+    if (length > 0) {
+        memcpy(result.data(), data, sizeof(T) * length);
+    }
+    return result;
+}
+
 } // namespace
 
 bool StandardCodecBufferReader::ReadType(BufferDataType& type)
@@ -59,7 +70,9 @@ bool StandardCodecBufferReader::ReadMapSize(int32_t& data)
         return false;
     }
     if (type == BufferDataType::TYPE_MAP) {
-        byteBufferReader_.ReadData(data);
+        uint32_t size = 0;
+        byteBufferReader_.ReadLength(size);
+        data = static_cast<int32_t>(size);
         return true;
     }
     return false;
@@ -132,6 +145,132 @@ bool StandardCodecBufferReader::ReadData(CodecData& resultData)
     }
 }
 
+bool StandardCodecBufferReader::ReadDataView(CodecDataView& resultData)
+{
+    BufferDataType type = BufferDataType::TYPE_NULL;
+    if (!ReadType(type)) {
+        LOGW("Read type failed");
+        return false;
+    }
+
+    resultData.type = type;
+    switch (type) {
+        case BufferDataType::TYPE_NULL:
+        case BufferDataType::TYPE_TRUE:
+        case BufferDataType::TYPE_FALSE:
+            return true;
+        case BufferDataType::TYPE_INT:
+        case BufferDataType::TYPE_FUNCTION: {
+            int32_t value = 0;
+            bool result = byteBufferReader_.ReadData(value);
+            resultData.longValue = value;
+            return result;
+        }
+        case BufferDataType::TYPE_LONG:
+            return byteBufferReader_.ReadData(resultData.longValue);
+        case BufferDataType::TYPE_DOUBLE:
+            return byteBufferReader_.ReadData(resultData.doubleValue);
+        case BufferDataType::TYPE_STRING:
+        case BufferDataType::TYPE_OBJECT:
+            return byteBufferReader_.ReadData(resultData.stringValue);
+        case BufferDataType::TYPE_INT8_ARRAY:
+            return byteBufferReader_.ReadBytes(resultData.arrayData, resultData.arrayLength, sizeof(int8_t));
+        case BufferDataType::TYPE_INT16_ARRAY:
+            return byteBufferReader_.ReadBytes(resultData.arrayData, resultData.arrayLength, sizeof(int16_t));
+        case BufferDataType::TYPE_INT32_ARRAY:
+            return byteBufferReader_.ReadBytes(resultData.arrayData, resultData.arrayLength, sizeof(int32_t));
+        case BufferDataType::TYPE_MAP:
+            return ReadDataFromByteBuffer<std::map<std::string, std::string>>(
+                byteBufferReader_, resultData.ownedValue);
+        case BufferDataType::TYPE_SET:
+            return ReadDataFromByteBuffer<std::set<std::string>>(byteBufferReader_, resultData.ownedValue);
+        default:
+            LOGW("Unknown type");
+            return false;
+    }
+}
+
+CodecData CodecDataView::ToCodecData() const
+{
+    switch (type) {
+        case BufferDataType::TYPE_TRUE:
+            return CodecData(true);
+        case BufferDataType::TYPE_FALSE:
+            return CodecData(false);
+        // same as ReadData, functions are decoded as int and objects as string.
+        case BufferDataType::TYPE_INT:
+        case BufferDataType::TYPE_FUNCTION:
+            return CodecData(static_cast<int32_t>(longValue));
+        case BufferDataType::TYPE_LONG:
+            return CodecData(longValue);
+        case BufferDataType::TYPE_DOUBLE:
+            return CodecData(doubleValue);
+        case BufferDataType::TYPE_STRING:
+        case BufferDataType::TYPE_OBJECT:
+            return CodecData(std::string(stringValue));
+        case BufferDataType::TYPE_INT8_ARRAY:
+            return CodecData(CopyArray<int8_t>(arrayData, arrayLength));
+        case BufferDataType::TYPE_INT16_ARRAY:
+            return CodecData(CopyArray<int16_t>(arrayData, arrayLength));
+        case BufferDataType::TYPE_INT32_ARRAY:
+            return CodecData(CopyArray<int32_t>(arrayData, arrayLength));
+        case BufferDataType::TYPE_MAP:
+        case BufferDataType::TYPE_SET:
+            return ownedValue;
+        default:
+            return CodecData();
+    }
+}
+
+size_t StandardCodecBufferWriter::GetEncodedSize(const CodecData& data, LengthEncoding encoding)
+{
+    auto arraySize = [encoding](size_t length, size_t elementSize) {
+        return ByteBufferWriter::GetLengthSize(static_cast<uint32_t>(length), encoding) + length * elementSize;
+    };
+    size_t size = sizeof(uint8_t);
+    switch (data.GetType()) {
+        case BufferDataType::TYPE_INT:
+        case BufferDataType::TYPE_FUNCTION:
+            return size + sizeof(int32_t);
+        case BufferDataType::TYPE_LONG:
+            return size + sizeof(int64_t);
+        case BufferDataType::TYPE_DOUBLE:
+            return size + sizeof(double);
+        case BufferDataType::TYPE_STRING:
+        case BufferDataType::TYPE_OBJECT:
+            return size + arraySize(data.GetStringValue().size(), sizeof(char));
+        case BufferDataType::TYPE_INT8_ARRAY:
+            return size + arraySize(data.GetInt8ArrayValue().size(), sizeof(int8_t));
+        case BufferDataType::TYPE_INT16_ARRAY:
+            return size + arraySize(data.GetInt16ArrayValue().size(), sizeof(int16_t));
+        case BufferDataType::TYPE_INT32_ARRAY:
+            return size + arraySize(data.GetInt32ArrayValue().size(), sizeof(int32_t));
+        case BufferDataType::TYPE_MAP:
+            size += ByteBufferWriter::GetLengthSize(static_cast<uint32_t>(data.GetMapValue().size()), encoding);
+            for (const auto& [key, value] : data.GetMapValue()) {
+                size += arraySize(key.size(), sizeof(char)) + arraySize(value.size(), sizeof(char));
+            }
+            return size;
+        case BufferDataType::TYPE_SET:
+            size += ByteBufferWriter::GetLengthSize(static_cast<uint32_t>(data.GetSetValue().size()), encoding);
+            for (const auto& value : data.GetSetValue()) {
+                size += arraySize(value.size(), sizeof(char));
+            }
+            return size;
+        default:
+            return size;
+    }
+}
+
+size_t StandardCodecBufferWriter::GetEncodedSize(const std::vector<CodecData>& dataList, LengthEncoding encoding)
+{
+    size_t size = sizeof(uint8_t);
+    for (const auto& data : dataList) {
+        size += GetEncodedSize(data, encoding);
+    }
+    return size;
+}
+
 void StandardCodecBufferWriter::WriteType(BufferDataType type)
 {
     byteBufferWriter_.WriteData(static_cast<uint8_t>(type));
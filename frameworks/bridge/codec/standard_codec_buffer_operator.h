@@ -17,6 +17,7 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_CODEC_BUFFER_OPERATOR_H
 
 #include <cstdint>
+#include <string_view>
 #include <vector>
 
 #include "base/utils/macros.h"
@@ -26,12 +27,37 @@
 
 namespace OHOS::Ace::Framework {
 
+// Value decoded without copy, strings and arrays refer to the decoded buffer. Maps and sets are copied to
+// ownedValue, they are small and not on the hot path.
+struct CodecDataView final {
+    BufferDataType type = BufferDataType::TYPE_NULL;
+    // TYPE_INT, TYPE_LONG and TYPE_FUNCTION.
+    int64_t longValue = 0;
+    double doubleValue = 0.0;
+    // TYPE_STRING and TYPE_OBJECT.
+    std::string_view stringValue;
+    // elements of arrays, which may be unaligned in the buffer.
+    const uint8_t* arrayData = nullptr;
+    uint32_t arrayLength = 0;
+    CodecData ownedValue;
+
+    // Copy the value to CodecData.
+    CodecData ToCodecData() const;
+};
+
 class ACE_EXPORT StandardCodecBufferReader final {
 public:
-    explicit StandardCodecBufferReader(const std::vector<uint8_t>& buffer) : byteBufferReader_(buffer) {}
+    explicit StandardCodecBufferReader(
+        const std::vector<uint8_t>& buffer, LengthEncoding encoding = LengthEncoding::FIXED_INT32)
+        : byteBufferReader_(buffer, encoding)
+    {}
+    StandardCodecBufferReader(const uint8_t* data, size_t size, LengthEncoding encoding = LengthEncoding::FIXED_INT32)
+        : byteBufferReader_(data, size, encoding)
+    {}
     ~StandardCodecBufferReader() = default;
 
     bool ReadData(CodecData& resultData);
+    bool ReadDataView(CodecDataView& resultData);
     bool ReadDataList(std::vector<CodecData>& resultDataList);
     bool ReadMapSize(int32_t& size);
 
@@ -45,12 +71,19 @@ private:
 
 class StandardCodecBufferWriter final {
 public:
-    explicit StandardCodecBufferWriter(std::vector<uint8_t>& buffer) : byteBufferWriter_(buffer) {}
+    explicit StandardCodecBufferWriter(
+        std::vector<uint8_t>& buffer, LengthEncoding encoding = LengthEncoding::FIXED_INT32)
+        : byteBufferWriter_(buffer, encoding)
+    {}
     ~StandardCodecBufferWriter() = default;
 
     void WriteData(const CodecData& data);
     void WriteDataList(const std::vector<CodecData>& dataList);
 
+    // Returns the size of encoded data, used to reserve the buffer at once.
+    static size_t GetEncodedSize(const CodecData& data, LengthEncoding encoding);
+    static size_t GetEncodedSize(const std::vector<CodecData>& dataList, LengthEncoding encoding);
+
 private:
     void WriteType(BufferDataType type);
 
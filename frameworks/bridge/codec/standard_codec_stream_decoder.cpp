@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "frameworks/bridge/codec/standard_function_codec.h"
+
+#include "frameworks/bridge/codec/standard_codec_stream_decoder.h"
+
+#include <algorithm>
+
+#include "base/log/log.h"
+#include "frameworks/bridge/codec/standard_codec_buffer_operator.h"
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+constexpr uint8_t VARINT_CONTINUE_BIT = 0x80;
+constexpr size_t VARINT_MAX_BYTES = 5;
+
+size_t GetElementSize(BufferDataType type)
+{
+    switch (type) {
+        case BufferDataType::TYPE_INT8_ARRAY:
+            return sizeof(int8_t);
+        case BufferDataType::TYPE_INT16_ARRAY:
+            return sizeof(int16_t);
+        case BufferDataType::TYPE_INT32_ARRAY:
+            return sizeof(int32_t);
+        default:
+            return 0;
+    }
+}
+
+} // namespace
+
+bool StandardCodecStreamDecoder::Feed(const uint8_t* data, size_t size)
+{
+    if (data == nullptr && size > 0) {
+        state_ = State::FAILED;
+        return false;
+    }
+    while (size > 0) {
+        switch (state_) {
+            case State::TYPE:
+                type_ = static_cast<BufferDataType>(*data);
+                elementSize_ = GetElementSize(type_);
+                if (elementSize_ > 0 && arrayChunkCallback_) {
+                    state_ = State::ARRAY_LENGTH;
+                    ++data;
+                    --size;
+                } else {
+                    state_ = State::BUFFERED;
+                }
+                break;
+            case State::ARRAY_LENGTH:
+                if (!FeedArrayLength(data, size)) {
+                    state_ = State::FAILED;
+                    return false;
+                }
+                break;
+            case State::ARRAY_ELEMENTS: {
+                auto chunkSize = static_cast<size_t>(std::min<uint64_t>(remainingBytes_, size));
+                arrayChunkCallback_(data, chunkSize);
+                data += chunkSize;
+                size -= chunkSize;
+                remainingBytes_ -= chunkSize;
+                if (remainingBytes_ == 0) {
+                    state_ = State::DONE;
+                }
+                break;
+            }
+            case State::BUFFERED:
+                buffer_.insert(buffer_.end(), data, data + size);
+                return true;
+            case State::DONE:
+                LOGW("Stream decoder receives data after the end of message");
+                state_ = State::FAILED;
+                return false;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool StandardCodecStreamDecoder::FeedArrayLength(const uint8_t*& data, size_t& size)
+{
+    // collect bytes of the length, which may be split between chunks.
+    bool complete = false;
+    while (size > 0 && !complete) {
+        buffer_.push_back(*data);
+        ++data;
+        --size;
+        complete = (encoding_ == LengthEncoding::VARINT) ?
+            ((buffer_.back() & VARINT_CONTINUE_BIT) == 0 || buffer_.size() >= VARINT_MAX_BYTES) :
+            buffer_.size() >= sizeof(int32_t);
+    }
+    if (!complete) {
+        return true;
+    }
+
+    ByteBufferReader reader(buffer_, encoding_);
+    uint32_t length = 0;
+    if (!reader.ReadLength(length)) {
+        LOGW("Stream decoder reads invalid array length");
+        return false;
+    }
+    buffer_.clear();
+    remainingBytes_ = static_cast<uint64_t>(length) * elementSize_;
+    state_ = remainingBytes_ > 0 ? State::ARRAY_ELEMENTS : State::DONE;
+    if (arrayStartCallback_) {
+        arrayStartCallback_(type_, length);
+    }
+    return true;
+}
+
+bool StandardCodecStreamDecoder::Finish(CodecData& result)
+{
+    switch (state_) {
+        case State::BUFFERED: {
+            StandardCodecBufferReader reader(buffer_, encoding_);
+            bool success = reader.ReadData(result);
+            buffer_.clear();
+            state_ = success ? State::DONE : State::FAILED;
+            return success;
+        }
+        case State::DONE:
+            if (type_ == BufferDataType::TYPE_INT8_ARRAY) {
+                result = CodecData(std::vector<int8_t>());
+            } else if (type_ == BufferDataType::TYPE_INT16_ARRAY) {
+                result = CodecData(std::vector<int16_t>());
+            } else if (type_ == BufferDataType::TYPE_INT32_ARRAY) {
+                result = CodecData(std::vector<int32_t>());
+            }
+            return true;
+        default:
+            LOGW("Stream decoder finishes with incomplete message");
+            state_ = State::FAILED;
+            return false;
+    }
+}
+
+} // namespace OHOS::Ace::Framework
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "frameworks/bridge/codec/standard_function_codec.h"
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_CODEC_STREAM_DECODER_H
+#define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_CODEC_STREAM_DECODER_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+#include "frameworks/bridge/codec/byte_buffer_operator.h"
+#include "frameworks/bridge/codec/codec_data.h"
+
+namespace OHOS::Ace::Framework {
+
+// Decode a platform message which arrives in chunks. Elements of int8, int16 and int32 arrays, such as image bytes,
+// are passed to the chunk callback as they arrive and are not kept, other values are buffered and decoded in Finish.
+class ACE_EXPORT StandardCodecStreamDecoder final {
+public:
+    using ArrayStartCallback = std::function<void(BufferDataType type, uint32_t length)>;
+    // Raw bytes of the elements, an element may be split between two chunks.
+    using ArrayChunkCallback = std::function<void(const uint8_t* data, size_t size)>;
+
+    explicit StandardCodecStreamDecoder(LengthEncoding encoding = LengthEncoding::FIXED_INT32) : encoding_(encoding) {}
+    ~StandardCodecStreamDecoder() = default;
+
+    void SetArrayStartCallback(ArrayStartCallback&& callback)
+    {
+        arrayStartCallback_ = std::move(callback);
+    }
+
+    void SetArrayChunkCallback(ArrayChunkCallback&& callback)
+    {
+        arrayChunkCallback_ = std::move(callback);
+    }
+
+    // Returns false if the data is invalid, the decoder should be discarded then.
+    bool Feed(const uint8_t* data, size_t size);
+    // Called after the last chunk. A streamed array is returned as an empty array of the same type.
+    bool Finish(CodecData& result);
+
+private:
+    enum class State : uint8_t {
+        TYPE = 0,
+        ARRAY_LENGTH,
+        ARRAY_ELEMENTS,
+        BUFFERED,
+        DONE,
+        FAILED,
+    };
+
+    bool FeedArrayLength(const uint8_t*& data, size_t& size);
+
+    LengthEncoding encoding_ = LengthEncoding::FIXED_INT32;
+    State state_ = State::TYPE;
+    BufferDataType type_ = BufferDataType::TYPE_NULL;
+    size_t elementSize_ = 0;
+    uint64_t remainingBytes_ = 0;
+    // bytes of the length of array, or the whole message if it is not streamed.
+    std::vector<uint8_t> buffer_;
+    ArrayStartCallback arrayStartCallback_;
+    ArrayChunkCallback arrayChunkCallback_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(StandardCodecStreamDecoder);
+};
+
+} // namespace OHOS::Ace::Framework
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_CODEC_STREAM_DECODER_H
@@ -26,15 +26,18 @@ bool StandardFunctionCodec::EncodeFunctionCall(const FunctionCall& functionCall,
         return false;
     }
 
-    StandardCodecBufferWriter bufferWriter(resultBuffer);
-    bufferWriter.WriteData(CodecData(functionCall.GetFuncName()));
+    CodecData funcName(functionCall.GetFuncName());
+    resultBuffer.reserve(resultBuffer.size() + StandardCodecBufferWriter::GetEncodedSize(funcName, encoding_) +
+                         StandardCodecBufferWriter::GetEncodedSize(functionCall.GetArgs(), encoding_));
+    StandardCodecBufferWriter bufferWriter(resultBuffer, encoding_);
+    bufferWriter.WriteData(funcName);
     bufferWriter.WriteDataList(functionCall.GetArgs());
     return true;
 }
 
 bool StandardFunctionCodec::DecodeFunctionCall(const std::vector<uint8_t>& buffer, FunctionCall& functionCall)
 {
-    StandardCodecBufferReader bufferReader(buffer);
+    StandardCodecBufferReader bufferReader(buffer, encoding_);
     CodecData funcName;
     if (!bufferReader.ReadData(funcName)) {
         LOGW("Decode funcName failed");
@@ -54,7 +57,12 @@ bool StandardFunctionCodec::DecodeFunctionCall(const std::vector<uint8_t>& buffe
 
 bool StandardFunctionCodec::DecodePlatformMessage(const std::vector<uint8_t>& buffer, CodecData& platformMessage)
 {
-    StandardCodecBufferReader bufferReader(buffer);
+    return DecodePlatformMessage(buffer.data(), buffer.size(), platformMessage);
+}
+
+bool StandardFunctionCodec::DecodePlatformMessage(const uint8_t* data, size_t size, CodecData& platformMessage)
+{
+    StandardCodecBufferReader bufferReader(data, size, encoding_);
     if (!bufferReader.ReadData(platformMessage)) {
         LOGW("Decode platform message failed");
         return false;
@@ -62,4 +70,15 @@ bool StandardFunctionCodec::DecodePlatformMessage(const std::vector<uint8_t>& bu
     return true;
 }
 
+bool StandardFunctionCodec::DecodePlatformMessageView(
+    const uint8_t* data, size_t size, CodecDataView& platformMessage)
+{
+    StandardCodecBufferReader bufferReader(data, size, encoding_);
+    if (!bufferReader.ReadDataView(platformMessage)) {
+        LOGW("Decode platform message failed");
+        return false;
+    }
+    return true;
+}
+
 } // namespace OHOS::Ace::Framework
\ No newline at end of file
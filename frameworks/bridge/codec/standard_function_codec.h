@@ -24,19 +24,27 @@
 #include "bridge/codec/codec_data.h"
 #include "bridge/codec/function_call.h"
 #include "frameworks/bridge/codec/function_codec.h"
+#include "frameworks/bridge/codec/standard_codec_buffer_operator.h"
 
 namespace OHOS::Ace::Framework {
 
 class ACE_EXPORT StandardFunctionCodec final : public FunctionCodec {
 public:
-    StandardFunctionCodec() = default;
+    explicit StandardFunctionCodec(LengthEncoding encoding = LengthEncoding::FIXED_INT32) : encoding_(encoding) {}
     ~StandardFunctionCodec() override = default;
 
     bool EncodeFunctionCall(const FunctionCall& functionCall, std::vector<uint8_t>& resultBuffer) override;
     bool DecodeFunctionCall(const std::vector<uint8_t>& buffer, FunctionCall& functionCall) override;
     bool DecodePlatformMessage(const std::vector<uint8_t>& buffer, CodecData& platformMessage) override;
 
+    // Decode the message in the buffer of platform without copying it to a vector.
+    bool DecodePlatformMessage(const uint8_t* data, size_t size, CodecData& platformMessage);
+    // Strings and arrays of the message refer to the buffer, which must outlive the message.
+    bool DecodePlatformMessageView(const uint8_t* data, size_t size, CodecDataView& platformMessage);
+
 private:
+    LengthEncoding encoding_ = LengthEncoding::FIXED_INT32;
+
     ACE_DISALLOW_COPY_AND_MOVE(StandardFunctionCodec);
 };
 
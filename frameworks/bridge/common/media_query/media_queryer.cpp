@@ -16,7 +16,9 @@
 #include "frameworks/bridge/common/media_query/media_queryer.h"
 
 #include <list>
+#include <mutex>
 #include <regex>
+#include <unordered_map>
 
 #include "base/log/log.h"
 #include "core/common/container.h"
@@ -27,31 +29,77 @@ namespace OHOS::Ace::Framework {
 namespace {
 
 constexpr double NOT_FOUND = -1.0;
-enum class MediaError {
-    NONE,
-    SYNTAX,
+constexpr size_t MAX_COMPILED_QUERY_COUNT = 256;
+
+enum class MediaUnit : uint8_t {
+    PX = 0,
+    DPI,
+    DPCM,
+    VP,
+};
+
+enum class MediaRelation : uint8_t {
+    GREAT_OR_EQUAL = 0,
+    GREAT_NOT_EQUAL,
+    LESS_OR_EQUAL,
+    LESS_NOT_EQUAL,
+};
+
+// Compare value of a numeric media feature with a constant, such as "width < 1000vp".
+struct MediaComparison {
+    bool featureOnLeft = true;
+    MediaRelation relation = MediaRelation::GREAT_OR_EQUAL;
+    double value = 0.0;
+    MediaUnit unit = MediaUnit::PX;
+};
+
+// Single media feature condition such as "(min-width: 1000)" or "(device-type: tv)".
+struct MediaCondition {
+    enum class Type : uint8_t {
+        // Syntax error, the query fails when it is evaluated.
+        INVALID = 0,
+        COMPARE,
+        STRING_EQUAL,
+        BOOL_EQUAL,
+    };
+
+    Type type = Type::INVALID;
+    std::string feature;
+    std::vector<MediaComparison> comparisons;
+    std::string stringValue;
+    bool boolValue = false;
 };
-using ConditionParser =
-    std::function<bool(const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason)>;
+
+} // namespace
+
+// Media query compiled from the condition string, evaluated without any string processing. The query matches when any
+// group matches, and a group matches when all conditions in it match.
+struct MediaQuery {
+    bool valid = false;
+    bool inverse = false;
+    // Whether the condition refers to "width" or "height".
+    bool dependsOnSize = false;
+    std::vector<std::vector<MediaCondition>> groups;
+};
+
+namespace {
+
+using ConditionCompiler = std::function<bool(const std::smatch& matchResults, MediaCondition& condition)>;
 
 class MediaQueryerRule {
 public:
-    MediaQueryerRule(const std::regex& regex, const ConditionParser& parser, uint32_t matchResultSize)
-        : regex_(regex), parser_(parser), matchResultSize_(matchResultSize)
+    MediaQueryerRule(const std::regex& regex, const ConditionCompiler& compiler, uint32_t matchResultSize)
+        : regex_(regex), compiler_(compiler), matchResultSize_(matchResultSize)
     {}
     explicit MediaQueryerRule(const std::regex& regex) : regex_(regex) {}
     ~MediaQueryerRule() = default;
 
-    bool ParseCondition(std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) const
+    bool CompileCondition(const std::smatch& matchResults, MediaCondition& condition) const
     {
-        if (!parser_) {
-            return false;
-        }
-        if (matchResults.size() != matchResultSize_) {
-            failReason = MediaError::SYNTAX;
+        if (!compiler_ || matchResults.size() != matchResultSize_) {
             return false;
         }
-        return parser_(matchResults, mediaFeature, failReason);
+        return compiler_(matchResults, condition);
     }
     bool Match(const std::string& condition, std::smatch& matchResults) const
     {
@@ -64,7 +112,7 @@ public:
 
 private:
     const std::regex regex_;
-    const ConditionParser parser_;
+    const ConditionCompiler compiler_;
     const uint32_t matchResultSize_ = 0;
 };
 
@@ -75,17 +123,60 @@ const std::string LESS_OR_EQUAL = "<=";
 const std::string LESS_NOT_EQUAL = "<";
 }; // namespace RelationShip
 
+MediaUnit ConvertToMediaUnit(const std::string& unit)
+{
+    if (unit == "dpi") {
+        return MediaUnit::DPI;
+    } else if (unit == "vp") {
+        return MediaUnit::VP;
+    } else if (unit == "dpcm") {
+        return MediaUnit::DPCM;
+    }
+    return MediaUnit::PX;
+}
+
+bool ConvertToMediaRelation(const std::string& relationship, MediaRelation& relation)
+{
+    if (relationship == RelationShip::GREAT_OR_EQUAL) {
+        relation = MediaRelation::GREAT_OR_EQUAL;
+    } else if (relationship == RelationShip::GREAT_NOT_EQUAL) {
+        relation = MediaRelation::GREAT_NOT_EQUAL;
+    } else if (relationship == RelationShip::LESS_OR_EQUAL) {
+        relation = MediaRelation::LESS_OR_EQUAL;
+    } else if (relationship == RelationShip::LESS_NOT_EQUAL) {
+        relation = MediaRelation::LESS_NOT_EQUAL;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool AddComparison(MediaCondition& condition, bool featureOnLeft, const std::string& relationship,
+    const std::string& value, const std::string& unit)
+{
+    MediaComparison comparison;
+    if (!ConvertToMediaRelation(relationship, comparison.relation)) {
+        return false;
+    }
+    comparison.featureOnLeft = featureOnLeft;
+    comparison.value = StringToDouble(value);
+    comparison.unit = ConvertToMediaUnit(unit);
+    condition.type = MediaCondition::Type::COMPARE;
+    condition.comparisons.emplace_back(comparison);
+    return true;
+}
+
 /**
  * transfer unit the same with condition value unit
  * @param value: device value should be transfer unit the same with condition value
  * @param unit: condition value unit, such as: dpi/dpcm/dppx
  */
-double TransferValue(double value, const std::string& unit)
+double TransferValue(double value, MediaUnit unit)
 {
     double transfer = 1.0;
-    if (unit == "dpi") {
+    if (unit == MediaUnit::DPI) {
         transfer = 96.0; // 1px = 96 dpi
-    } else if (unit == "vp") {
+    } else if (unit == MediaUnit::VP) {
         auto container = Container::Current();
         if (container) {
             auto pipeline = container->GetPipelineContext();
@@ -97,7 +188,7 @@ double TransferValue(double value, const std::string& unit)
         } else {
             LOGW("No container, use default scale.");
         }
-    } else if (unit == "dpcm") {
+    } else if (unit == MediaUnit::DPCM) {
         transfer = 36.0; // 1px = 36 dpcm
     } else {
         transfer = 1.0; // default same with device unit: px
@@ -105,20 +196,18 @@ double TransferValue(double value, const std::string& unit)
     return value * transfer;
 }
 
-bool CalculateExpression(double lvalue, const std::string& relationship, double rvalue, MediaError& failReason)
+bool CalculateExpression(double lvalue, MediaRelation relation, double rvalue)
 {
-    if (relationship == RelationShip::GREAT_OR_EQUAL) {
-        return GreatOrEqual(lvalue, rvalue);
-    } else if (relationship == RelationShip::GREAT_NOT_EQUAL) {
-        return GreatNotEqual(lvalue, rvalue);
-    } else if (relationship == RelationShip::LESS_OR_EQUAL) {
-        return LessOrEqual(lvalue, rvalue);
-    } else if (relationship == RelationShip::LESS_NOT_EQUAL) {
-        return LessNotEqual(lvalue, rvalue);
-    } else {
-        failReason = MediaError::SYNTAX;
+    switch (relation) {
+        case MediaRelation::GREAT_OR_EQUAL:
+            return GreatOrEqual(lvalue, rvalue);
+        case MediaRelation::GREAT_NOT_EQUAL:
+            return GreatNotEqual(lvalue, rvalue);
+        case MediaRelation::LESS_OR_EQUAL:
+            return LessOrEqual(lvalue, rvalue);
+        default:
+            return LessNotEqual(lvalue, rvalue);
     }
-    return false;
 }
 
 const MediaQueryerRule CONDITION_WITH_SCREEN(
@@ -130,7 +219,7 @@ const MediaQueryerRule CONDITION_WITH_AND(std::regex("(\\([\\.a-z0-9:>=<-]+\\))(
 const MediaQueryerRule CSS_LEVEL4_MULTI(
     std::regex(
         "\\(([\\d\\.]+)(dpi|dppx|dpcm|px|vp)?(>=|<=|>|<)([a-z0-9:-]+)(>|<|>=|<=)([\\d\\.]+)(dpi|dppx|dpcm|px|vp)?\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t LEFT_CONDITION_VALUE = 6;
         static constexpr int32_t LEFT_UNIT = 7;
         static constexpr int32_t LEFT_RELATIONSHIP = 5;
@@ -139,48 +228,48 @@ const MediaQueryerRule CSS_LEVEL4_MULTI(
         static constexpr int32_t RIGHT_UNIT = 2;
         static constexpr int32_t RIGHT_RELATIONSHIP = 3;
 
-        auto mediaFeatureValue = mediaFeature->GetDouble(matchResults[MEDIA_FEATURE], NOT_FOUND);
-        return CalculateExpression(TransferValue(mediaFeatureValue, matchResults[LEFT_UNIT]),
-                   matchResults[LEFT_RELATIONSHIP], StringToDouble(matchResults[LEFT_CONDITION_VALUE]), failReason) &&
-               CalculateExpression(StringToDouble(matchResults[RIGHT_CONDITION_VALUE]),
-                   matchResults[RIGHT_RELATIONSHIP], TransferValue(mediaFeatureValue, matchResults[RIGHT_UNIT]),
-                   failReason);
+        condition.feature = matchResults[MEDIA_FEATURE];
+        return AddComparison(condition, true, matchResults[LEFT_RELATIONSHIP], matchResults[LEFT_CONDITION_VALUE],
+                   matchResults[LEFT_UNIT]) &&
+               AddComparison(condition, false, matchResults[RIGHT_RELATIONSHIP], matchResults[RIGHT_CONDITION_VALUE],
+                   matchResults[RIGHT_UNIT]);
     },
     8);
 
 // condition such as: width < 1000
 const MediaQueryerRule CSS_LEVEL4_LEFT(
     std::regex("\\(([^m][a-z-]+)(>=|<=|>|<)([\\d\\.]+)(dpi|dppx|dpcm|px|vp)?\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t CONDITION_VALUE = 3;
         static constexpr int32_t UNIT = 4;
         static constexpr int32_t RELATIONSHIP = 2;
         static constexpr int32_t MEDIA_FEATURE = 1;
 
-        return CalculateExpression(
-            TransferValue(mediaFeature->GetDouble(matchResults[MEDIA_FEATURE], NOT_FOUND), matchResults[UNIT]),
-            matchResults[RELATIONSHIP], StringToDouble(matchResults[CONDITION_VALUE]), failReason);
+        condition.feature = matchResults[MEDIA_FEATURE];
+        return AddComparison(
+            condition, true, matchResults[RELATIONSHIP], matchResults[CONDITION_VALUE], matchResults[UNIT]);
     },
     5);
 
 // condition such as: 1000 < width
 const MediaQueryerRule CSS_LEVEL4_RIGHT(
     std::regex("\\(([\\d\\.]+)(dpi|dppx|dpcm|px|vp)?(>=|<=|>|<)([^m][a-z-]+)\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t CONDITION_VALUE = 1;
         static constexpr int32_t UNIT = 2;
         static constexpr int32_t RELATIONSHIP = 3;
         static constexpr int32_t MEDIA_FEATURE = 4;
-        return CalculateExpression(StringToDouble(matchResults[CONDITION_VALUE]), matchResults[RELATIONSHIP],
-            TransferValue(mediaFeature->GetDouble(matchResults[MEDIA_FEATURE], NOT_FOUND), matchResults[UNIT]),
-            failReason);
+
+        condition.feature = matchResults[MEDIA_FEATURE];
+        return AddComparison(
+            condition, false, matchResults[RELATIONSHIP], matchResults[CONDITION_VALUE], matchResults[UNIT]);
     },
     5);
 
 // condition such as: min-width: 1000
 const MediaQueryerRule CSS_LEVEL3_RULE(
     std::regex("\\((min|max)-([a-z-]+):([\\d\\.]+)(dpi|dppx|dpcm|vp)?\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t RELATIONSHIP = 1;
         static constexpr int32_t MEDIA_FEATURE = 2;
         static constexpr int32_t CONDITION_VALUE = 3;
@@ -194,55 +283,66 @@ const MediaQueryerRule CSS_LEVEL3_RULE(
             return false;
         }
 
-        return CalculateExpression(
-            TransferValue(mediaFeature->GetDouble(matchResults[MEDIA_FEATURE], NOT_FOUND), matchResults[UNIT]),
-            relationship, StringToDouble(matchResults[CONDITION_VALUE]), failReason);
+        condition.feature = matchResults[MEDIA_FEATURE];
+        return AddComparison(condition, true, relationship, matchResults[CONDITION_VALUE], matchResults[UNIT]);
     },
     5);
 
 const MediaQueryerRule SCREEN_SHAPE_RULE(
     std::regex("\\(round-screen:([a-z]+)\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t CONDITION_VALUE = 1;
-        return StringToBool(matchResults[CONDITION_VALUE]) == mediaFeature->GetBool("round-screen", false);
+        condition.type = MediaCondition::Type::BOOL_EQUAL;
+        condition.feature = "round-screen";
+        condition.boolValue = StringToBool(matchResults[CONDITION_VALUE]);
+        return true;
     },
     2);
 
 const MediaQueryerRule ORIENTATION_RULE(
     std::regex("\\(orientation:([a-z]+)\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t CONDITION_VALUE = 1;
-        return matchResults[CONDITION_VALUE] == mediaFeature->GetString("orientation", "");
+        condition.type = MediaCondition::Type::STRING_EQUAL;
+        condition.feature = "orientation";
+        condition.stringValue = matchResults[CONDITION_VALUE];
+        return true;
     },
     2);
 
 const MediaQueryerRule DEVICE_TYPE_RULE(
     std::regex("\\(device-type:([a-z]+)\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t CONDITION_VALUE = 1;
-        auto matchDeviceType = mediaFeature->GetString("device-type", "");
-        if (matchResults[CONDITION_VALUE] == "default") {
-            return matchDeviceType == "phone";
-        } else {
-            return matchResults[CONDITION_VALUE] == matchDeviceType;
+        condition.type = MediaCondition::Type::STRING_EQUAL;
+        condition.feature = "device-type";
+        condition.stringValue = matchResults[CONDITION_VALUE];
+        if (condition.stringValue == "default") {
+            condition.stringValue = "phone";
         }
+        return true;
     },
     2);
 
 const MediaQueryerRule DEVICE_BRAND_RULE(
     std::regex("\\(device-brand:([A-Z]+)\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t CONDITION_VALUE = 1;
-        auto value = matchResults[CONDITION_VALUE] == mediaFeature->GetString("device-brand", "");
-        return value;
+        condition.type = MediaCondition::Type::STRING_EQUAL;
+        condition.feature = "device-brand";
+        condition.stringValue = matchResults[CONDITION_VALUE];
+        return true;
     },
     2);
 
 const MediaQueryerRule DARK_MODE_RULE(
     std::regex("\\(dark-mode:([a-z]+)\\)"),
-    [](const std::smatch& matchResults, const MediaFeature& mediaFeature, MediaError& failReason) {
+    [](const std::smatch& matchResults, MediaCondition& condition) {
         static constexpr int32_t CONDITION_VALUE = 1;
-        return StringToBool(matchResults[CONDITION_VALUE]) == mediaFeature->GetBool("dark-mode", false);
+        condition.type = MediaCondition::Type::BOOL_EQUAL;
+        condition.feature = "dark-mode";
+        condition.boolValue = StringToBool(matchResults[CONDITION_VALUE]);
+        return true;
     },
     2);
 
@@ -259,84 +359,151 @@ const std::list<MediaQueryerRule> SINGLE_CONDITION_RULES = {
 
 };
 
-bool ParseSingleCondition(const std::string& condition, const MediaFeature& mediaFeature, MediaError& failReason)
+MediaCondition CompileSingleCondition(const std::string& condition)
 {
     for (const auto& rule : SINGLE_CONDITION_RULES) {
         std::smatch matchResults;
         if (rule.Match(condition, matchResults)) {
-            return rule.ParseCondition(matchResults, mediaFeature, failReason);
+            MediaCondition result;
+            if (!rule.CompileCondition(matchResults, result)) {
+                result = MediaCondition();
+            }
+            return result;
         }
     }
     LOGE("illegal condition");
-    failReason = MediaError::SYNTAX;
-    return false;
+    return MediaCondition();
 }
 
-bool ParseAndCondition(const std::string& condition, const MediaFeature& mediaFeature, MediaError& failReason)
+std::vector<MediaCondition> CompileAndCondition(const std::string& condition)
 {
     auto noAnd = std::regex_replace(condition, std::regex("and[^a-z]"), ",(");
     std::vector<std::string> conditionArr;
     StringUtils::SplitStr(noAnd, ",", conditionArr);
+    std::vector<MediaCondition> group;
     if (conditionArr.empty()) {
-        failReason = MediaError::SYNTAX;
-        return false;
+        group.emplace_back();
+        return group;
     }
-
     for (const auto& item : conditionArr) {
-        if (!ParseSingleCondition(item, mediaFeature, failReason)) {
-            return false;
-        }
+        group.emplace_back(CompileSingleCondition(item));
     }
-    return true;
+    return group;
 }
 
-bool DoMatchCondition(const std::string& condition, const MediaFeature& mediaFeature)
+std::shared_ptr<const MediaQuery> CompileMediaQuery(const std::string& condition)
 {
+    auto query = std::make_shared<MediaQuery>();
+    query->dependsOnSize =
+        condition.find("width") != std::string::npos || condition.find("height") != std::string::npos;
     // remove space from condition string
     std::string noSpace = std::regex_replace(condition, std::regex("\\s"), "");
-    bool inverse = false;
     std::string noScreen;
     if (CONDITION_WITH_SCREEN.Match(noSpace)) {
         if (noSpace.find("notscreen") != std::string::npos) {
-            inverse = true;
-        }
-        MediaQueryerRule screenPatten(std::regex("screen[^and:]"));
-        if (screenPatten.Match(noSpace)) {
-            return !inverse;
+            query->inverse = true;
         }
         noScreen = std::regex_replace(noSpace, std::regex("^(only|not)?screen(and)?"), "");
     } else if (CONDITION_WITHOUT_SCREEN.Match(noSpace)) {
         noScreen = noSpace;
     } else {
         LOGE("illegal condition");
-        return false;
+        return query;
     }
-    MediaError failReason = MediaError::NONE;
+    query->valid = true;
     // replace 'or' with comma ','
     auto commaCondition = std::regex_replace(noScreen, std::regex("or[(]"), ",(");
     // remove screen and modifier
     std::vector<std::string> conditionArr;
     StringUtils::SplitStr(commaCondition, ",", conditionArr);
-    int32_t len = static_cast<int32_t>(conditionArr.size());
-    for (int32_t i = 0; i < len; i++) {
-        if (CONDITION_WITH_AND.Match(conditionArr[i])) {
-            bool result = ParseAndCondition(conditionArr[i], mediaFeature, failReason);
-            if (failReason == MediaError::SYNTAX) {
-                return false;
-            }
-            if (i + 1 == len) {
-                return (inverse && !result) || (!inverse && result);
-            }
+    for (const auto& item : conditionArr) {
+        if (CONDITION_WITH_AND.Match(item)) {
+            query->groups.emplace_back(CompileAndCondition(item));
         } else {
-            if (ParseSingleCondition(conditionArr[i], mediaFeature, failReason)) {
-                return !inverse;
+            query->groups.emplace_back(std::vector<MediaCondition> { CompileSingleCondition(item) });
+        }
+    }
+    return query;
+}
+
+// Compiled queries are shared by all queryers, listeners of media query create a new queryer on every update.
+std::shared_ptr<const MediaQuery> GetMediaQuery(const std::string& condition)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const MediaQuery>> compiledQueries;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto iter = compiledQueries.find(condition);
+        if (iter != compiledQueries.end()) {
+            return iter->second;
+        }
+    }
+    auto query = CompileMediaQuery(condition);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (compiledQueries.size() >= MAX_COMPILED_QUERY_COUNT) {
+        compiledQueries.clear();
+    }
+    compiledQueries.emplace(condition, query);
+    return query;
+}
+
+bool EvaluateCondition(const MediaCondition& condition, const MediaFeature& mediaFeature)
+{
+    switch (condition.type) {
+        case MediaCondition::Type::COMPARE: {
+            auto featureValue = mediaFeature->GetDouble(condition.feature, NOT_FOUND);
+            for (const auto& comparison : condition.comparisons) {
+                auto value = TransferValue(featureValue, comparison.unit);
+                bool result = comparison.featureOnLeft
+                                  ? CalculateExpression(value, comparison.relation, comparison.value)
+                                  : CalculateExpression(comparison.value, comparison.relation, value);
+                if (!result) {
+                    return false;
+                }
             }
-            if (failReason == MediaError::SYNTAX) {
+            return true;
+        }
+        case MediaCondition::Type::STRING_EQUAL:
+            return mediaFeature->GetString(condition.feature, "") == condition.stringValue;
+        case MediaCondition::Type::BOOL_EQUAL:
+            return mediaFeature->GetBool(condition.feature, false) == condition.boolValue;
+        default:
+            return false;
+    }
+}
+
+bool EvaluateMediaQuery(const MediaQuery& query, const MediaFeature& mediaFeature)
+{
+    if (!query.valid) {
+        return false;
+    }
+    for (const auto& group : query.groups) {
+        bool result = true;
+        for (const auto& condition : group) {
+            if (condition.type == MediaCondition::Type::INVALID) {
+                // syntax error fails the whole query.
                 return false;
             }
+            if (!EvaluateCondition(condition, mediaFeature)) {
+                result = false;
+                break;
+            }
+        }
+        if (result) {
+            return !query.inverse;
         }
     }
-    return inverse;
+    return query.inverse;
+}
+
+bool MatchMediaQuery(const MediaQuery& query, const MediaFeature& mediaFeature)
+{
+    // If width and height are not initialized, and the query condition includes "width" or "height",
+    // return false directly.
+    if (query.dependsOnSize && mediaFeature->GetInt("width", 0) == 0) {
+        return false;
+    }
+    return EvaluateMediaQuery(query, mediaFeature);
 }
 
 } // namespace
@@ -346,25 +513,32 @@ bool MediaQueryer::MatchCondition(const std::string& condition, const MediaFeatu
     if (condition.empty()) {
         return false;
     }
+    return MatchMediaQuery(*GetMediaQuery(condition), mediaFeature);
+}
 
-    // If width and height are not initialized, and the query condition includes "width" or "height",
-    // return false directly.
-    if (mediaFeature->GetInt("width", 0) == 0 &&
-        (condition.find("width") != std::string::npos || condition.find("height") != std::string::npos)) {
+bool MediaQueryer::MatchCondition(const std::string& condition)
+{
+    if (condition.empty()) {
         return false;
     }
 
-    auto iter = queryHistories.find(condition);
-    if (iter != queryHistories.end()) {
-        auto queryHistory = iter->second;
-        if (queryHistory.mediaFeatureValue == mediaFeature->ToString()) {
-            return queryHistory.result;
+    auto iter = matchResults_.find(condition);
+    if (iter != matchResults_.end() && iter->second.featureGeneration == featureGeneration_) {
+        return iter->second.matches;
+    }
+    if (iter == matchResults_.end()) {
+        if (matchResults_.size() >= MAX_COMPILED_QUERY_COUNT) {
+            matchResults_.clear();
         }
+        iter = matchResults_.emplace(condition, MatchResult { GetMediaQuery(condition) }).first;
     }
-
-    auto result = DoMatchCondition(condition, mediaFeature);
-    queryHistories[condition] = { mediaFeature->ToString(), result };
-    return result;
+    if (!mediaFeature_) {
+        mediaFeature_ = GetMediaFeature();
+    }
+    auto& result = iter->second;
+    result.matches = MatchMediaQuery(*result.query, mediaFeature_);
+    result.featureGeneration = featureGeneration_;
+    return result.matches;
 }
 
 /* card info */
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_MEDIA_QUERYER_H
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CARD_FRONTEND_MEDIA_QUERYER_H
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -26,31 +27,51 @@ namespace OHOS::Ace::Framework {
 
 using MediaFeature = std::unique_ptr<JsonValue>;
 
+struct MediaQuery;
+
 class ACE_FORCE_EXPORT_WITH_PREVIEW MediaQueryer {
 public:
     bool MatchCondition(const std::string& condition, const MediaFeature& mediaFeature);
+    // Match the condition against the features of this queryer, results are cached until the features change.
+    bool MatchCondition(const std::string& condition);
     std::unique_ptr<JsonValue> GetMediaFeature() const;
     void SetColorMode(ColorMode colorMode)
     {
-        colorMode_ = colorMode;
+        if (colorMode_ != colorMode) {
+            colorMode_ = colorMode;
+            OnMediaFeatureUpdate();
+        }
     }
 
     void SetSurfaceSize(int32_t width, int32_t height)
     {
-        width_ = width;
-        height_ = height;
+        if (width_ != width || height_ != height) {
+            width_ = width;
+            height_ = height;
+            OnMediaFeatureUpdate();
+        }
+    }
+
+    // Features of the system changed, the cached results are evaluated again.
+    void OnMediaFeatureUpdate()
+    {
+        ++featureGeneration_;
+        mediaFeature_.reset();
     }
 
 private:
-    struct QueryHistory {
-        std::string mediaFeatureValue;
-        bool result = false;
+    struct MatchResult {
+        std::shared_ptr<const MediaQuery> query;
+        uint64_t featureGeneration = 0;
+        bool matches = false;
     };
-    std::unordered_map<std::string, QueryHistory> queryHistories;
+
+    uint64_t featureGeneration_ = 0;
+    MediaFeature mediaFeature_;
+    std::unordered_map<std::string, MatchResult> matchResults_;
     int32_t width_ = 0;
     int32_t height_ = 0;
     ColorMode colorMode_ = ColorMode::LIGHT;
-
 };
 
 } // namespace OHOS::Ace::Framework
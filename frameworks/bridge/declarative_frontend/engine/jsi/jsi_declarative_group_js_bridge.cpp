@@ -15,10 +15,13 @@
 
 #include "frameworks/bridge/declarative_frontend/engine/jsi/jsi_declarative_group_js_bridge.h"
 
+#include <algorithm>
+
 #include "base/json/json_util.h"
 #include "base/log/event_report.h"
 #include "base/log/log.h"
 #include "base/memory/ace_type.h"
+#include "frameworks/bridge/codec/codec_buffer_pool.h"
 #include "frameworks/bridge/codec/function_call.h"
 #include "frameworks/bridge/declarative_frontend/engine/jsi/jsi_declarative_engine.h"
 #include "frameworks/bridge/js_frontend/engine/common/js_constants.h"
@@ -149,7 +152,7 @@ shared_ptr<JsValue> JsiDeclarativeGroupJsBridge::ProcessJsRequest(const shared_p
 
     FunctionCall functionCall(strFunctionName, arguments);
     StandardFunctionCodec codec;
-    std::vector<uint8_t> encodeBuf;
+    std::vector<uint8_t> encodeBuf = CodecBufferPool::GetInstance().Acquire();
     if (!codec.EncodeFunctionCall(functionCall, encodeBuf)) {
         groupJsBridge->TriggerModulePluginGetErrorCallback(
             callbackId, PLUGIN_REQUEST_FAIL, "encode request message failed");
@@ -219,7 +222,7 @@ shared_ptr<JsValue> JsiDeclarativeGroupJsBridge::ProcessJsRequestSync(const shar
 
     FunctionCall functionCall(strFunctionName, arguments);
     StandardFunctionCodec codec;
-    std::vector<uint8_t> encodeBuf;
+    std::vector<uint8_t> encodeBuf = CodecBufferPool::GetInstance().Acquire();
     if (!codec.EncodeFunctionCall(functionCall, encodeBuf)) {
         LOGE("encode request message failed");
         return res;
@@ -236,12 +239,12 @@ shared_ptr<JsValue> JsiDeclarativeGroupJsBridge::ProcessJsRequestSync(const shar
         LOGW("Dispatcher Upgrade fail when dispatch request message to platform");
         return res;
     }
-    std::vector<uint8_t> messageData = std::vector<uint8_t>(resData, resData + position);
 
+    // decode the result in the buffer of platform directly, the string is only copied to the js value.
     shared_ptr<JsValue> callBackResult;
-    CodecData codecResult;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    CodecDataView codecResult;
+    if (codec.DecodePlatformMessageView(resData, static_cast<size_t>(std::max<int64_t>(position, 0)), codecResult)) {
+        std::string resultString(codecResult.stringValue);
         LOGI("sync resultString = %{private}s", resultString.c_str());
         if (resultString.empty()) {
             callBackResult = runtime->NewNull();
@@ -430,10 +433,10 @@ void JsiDeclarativeGroupJsBridge::TriggerModuleJsCallback(
     int32_t callbackId, int32_t code, std::vector<uint8_t>&& messageData)
 {
     shared_ptr<JsValue> callBackResult;
-    CodecData codecResult;
+    CodecDataView codecResult;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    if (codec.DecodePlatformMessageView(messageData.data(), messageData.size(), codecResult)) {
+        std::string resultString(codecResult.stringValue);
         if (resultString.empty()) {
             callBackResult = runtime_->NewNull();
         } else {
@@ -445,7 +448,8 @@ void JsiDeclarativeGroupJsBridge::TriggerModuleJsCallback(
     }
     CallModuleJsCallback(callbackId, code, callBackResult);
 
-    messageData.clear();
+    // the buffer is reused by the next request.
+    CodecBufferPool::GetInstance().Release(std::move(messageData));
 }
 
 void JsiDeclarativeGroupJsBridge::CallModuleJsCallback(
@@ -515,10 +519,11 @@ void JsiDeclarativeGroupJsBridge::CallEventJsCallback(int32_t callbackId, std::v
     shared_ptr<JsValue> global = runtime_->GetGlobal();
 
     shared_ptr<JsValue> callBackEvent;
-    CodecData codecEvent;
+    CodecDataView codecEvent;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(eventData, codecEvent)) {
-        std::string eventString = codecEvent.GetStringValue();
+    if (codec.DecodePlatformMessageView(eventData.data(), eventData.size(), codecEvent)) {
+        std::string eventString(codecEvent.stringValue);
+        CodecBufferPool::GetInstance().Release(std::move(eventData));
         if (eventString.empty()) {
             callBackEvent = runtime_->NewNull();
         } else {
@@ -15,7 +15,7 @@
 
 #include "frameworks/bridge/declarative_frontend/engine/jsi/modules/jsi_router_module.h"
 
-#include "base/json/json_util.h"
+#include "base/json/json_view.h"
 #include "base/log/log.h"
 #include "frameworks/bridge/common/utils/engine_helper.h"
 #include "frameworks/bridge/declarative_frontend/engine/jsi/jsi_declarative_engine.h"
@@ -34,9 +34,9 @@ std::string DeclarativeParseRouteUrl(const shared_ptr<JsRuntime>& runtime, const
     }
 
     std::string pageRoute;
-    std::unique_ptr<JsonValue> argsPtr = JsonUtil::ParseJsonString(argStr);
-    if (argsPtr != nullptr && argsPtr->GetValue(key) != nullptr && argsPtr->GetValue(key)->IsString()) {
-        pageRoute = argsPtr->GetValue(key)->GetString();
+    auto document = JsonDocument::ParseView(argStr);
+    if (document) {
+        pageRoute = document->GetRoot()->GetString(key);
     }
     LOGD("JsDeclarativeParseRouteUrl pageRoute = %{private}s", pageRoute.c_str());
 
@@ -47,10 +47,11 @@ std::string DeclarativeParseRouteParams(const shared_ptr<JsRuntime>& runtime, co
     const std::string& key)
 {
     std::string argStr = arg->GetJsonString(runtime);
-    std::unique_ptr<JsonValue> argsPtr = JsonUtil::ParseJsonString(argStr);
+    auto document = JsonDocument::ParseView(argStr);
     std::string params;
-    if (argsPtr != nullptr && argsPtr->Contains(key) && argsPtr->GetValue(key)->IsObject()) {
-        params = argsPtr->GetValue(key)->ToString();
+    if (document) {
+        // the text is printed by JSON.stringify without space, so the text of params is passed as it is.
+        params = document->GetRoot()->GetObject(key)->GetRawText();
     }
     return params;
 }
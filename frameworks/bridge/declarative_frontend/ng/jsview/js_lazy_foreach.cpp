@@ -110,6 +110,18 @@ public:
         return info;
     }
 
+    std::string OnGetKeyByIndex(int32_t index) override
+    {
+        std::string key;
+        JAVASCRIPT_EXECUTION_SCOPE_WITH_CHECK(executionContext_, key);
+        if (getDataFunc_.IsEmpty()) {
+            return key;
+        }
+        JSRef<JSVal> result = CallJSFunction(getDataFunc_, dataSourceObj_, index);
+        key = keyGenFunc_(result, index);
+        return key;
+    }
+
     void ReleaseChildGroupById(const std::string& id) override
     {
         JSLazyForEachActuator::ReleaseChildGroupByComposedId(id);
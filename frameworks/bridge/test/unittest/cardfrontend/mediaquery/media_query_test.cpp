@@ -80,4 +80,60 @@ HWTEST_F(MediaQueryTest, MediaQueryTest001, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: MediaQueryTest002
+ * @tc.desc: Verify that compiled conditions are evaluated against different media features, and a matched "and"
+ *           group is a match of the whole condition list.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MediaQueryTest, MediaQueryTest002, TestSize.Level1)
+{
+    OHOS::Ace::Framework::MediaFeature phoneFeature = JsonUtil::Create(true);
+    phoneFeature->Put("width", 720);
+    phoneFeature->Put("device-type", "phone");
+    phoneFeature->Put("dark-mode", false);
+    OHOS::Ace::Framework::MediaFeature tvFeature = JsonUtil::Create(true);
+    tvFeature->Put("width", 1920);
+    tvFeature->Put("device-type", "tv");
+    tvFeature->Put("dark-mode", false);
+    OHOS::Ace::Framework::MediaFeature emptyFeature = JsonUtil::Create(true);
+
+    MediaQueryer mediaQueryer;
+    const std::string condition = "(min-width: 1000) and (device-type: tv), (dark-mode: true)";
+    for (int32_t i = 0; i < 2; ++i) {
+        EXPECT_FALSE(mediaQueryer.MatchCondition(condition, phoneFeature));
+        EXPECT_TRUE(mediaQueryer.MatchCondition(condition, tvFeature));
+        EXPECT_FALSE(mediaQueryer.MatchCondition(condition, emptyFeature));
+    }
+    EXPECT_TRUE(mediaQueryer.MatchCondition("(dark-mode: false), (min-width: 1000) and (device-type: tv)", tvFeature));
+    EXPECT_TRUE(mediaQueryer.MatchCondition("(device-type: default)", phoneFeature));
+    EXPECT_TRUE(mediaQueryer.MatchCondition("not screen and (device-type: tv)", phoneFeature));
+    EXPECT_FALSE(mediaQueryer.MatchCondition("(device-type: phone), (min-width: 100px)", tvFeature));
+}
+
+/**
+ * @tc.name: MediaQueryTest003
+ * @tc.desc: Verify that the cached results of the queryer are evaluated again after its features change.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MediaQueryTest, MediaQueryTest003, TestSize.Level1)
+{
+    MediaQueryer mediaQueryer;
+    const std::string sizeCondition = "(min-width: 1000)";
+    const std::string darkCondition = "(dark-mode: true)";
+    EXPECT_FALSE(mediaQueryer.MatchCondition(sizeCondition));
+
+    mediaQueryer.SetSurfaceSize(1500, 800);
+    for (int32_t i = 0; i < 2; ++i) {
+        EXPECT_TRUE(mediaQueryer.MatchCondition(sizeCondition));
+        EXPECT_FALSE(mediaQueryer.MatchCondition(darkCondition));
+    }
+
+    mediaQueryer.SetSurfaceSize(500, 800);
+    mediaQueryer.SetColorMode(ColorMode::DARK);
+    EXPECT_FALSE(mediaQueryer.MatchCondition(sizeCondition));
+    EXPECT_TRUE(mediaQueryer.MatchCondition(darkCondition));
+    EXPECT_FALSE(mediaQueryer.MatchCondition(""));
+}
+
 } // namespace OHOS::Ace::Framework
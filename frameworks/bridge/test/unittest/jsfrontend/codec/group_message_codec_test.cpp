@@ -16,8 +16,10 @@
 #include "gtest/gtest.h"
 
 #include "base/log/log.h"
+#include "frameworks/bridge/codec/codec_buffer_pool.h"
 #include "frameworks/bridge/codec/codec_data.h"
 #include "frameworks/bridge/codec/function_call.h"
+#include "frameworks/bridge/codec/standard_codec_stream_decoder.h"
 #include "frameworks/bridge/codec/standard_function_codec.h"
 
 using namespace testing;
@@ -45,6 +47,10 @@ const std::map<std::string, std::string> FUNCTION_PARA_MAP = { { "1", "value1" }
 const std::vector<uint8_t> MAP_ENCODE_RESULT = { 22, 7, 0, 0, 0, 103, 101, 116, 73, 110, 102, 111,
     1, 23, 2, 0, 0, 0, 1, 0, 0, 0, 49, 6, 0, 0, 0, 118, 97, 108, 117, 101, 49, 1, 0, 0, 0, 50, 6,
     0, 0, 0, 118, 97, 108, 117, 101, 50 };
+const std::vector<uint8_t> VARINT_ENCODE_RESULT = { 22, 7, 103, 101, 116, 73, 110, 102, 111, 1, 22, 7, 111, 110,
+    101, 80, 97, 114, 97 };
+constexpr size_t LARGE_ARRAY_SIZE = 100000;
+constexpr size_t STREAM_CHUNK_SIZE = 333;
 
 } // namespace
 
@@ -475,4 +481,213 @@ HWTEST_F(GroupMessageCodecTest, PrimitiveTypeCodecTest010, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: ZeroCopyCodecTest001
+ * @tc.desc: Encode with varint lengths, then decode and check the result.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GroupMessageCodecTest, ZeroCopyCodecTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Encode a function call with varint lengths.
+     * @tc.expected: step1. lengths are encoded in one byte, the buffer is reserved at once.
+     */
+    FunctionCall functionCall(FUNCTION_NAME_VALUE, { CodecData(FUNCTION_PARA_STRING_VALUE) });
+    std::vector<uint8_t> encodeBuf;
+    StandardFunctionCodec codec(LengthEncoding::VARINT);
+    ASSERT_TRUE(codec.EncodeFunctionCall(functionCall, encodeBuf));
+    EXPECT_EQ(encodeBuf, VARINT_ENCODE_RESULT);
+    EXPECT_EQ(encodeBuf.capacity(), encodeBuf.size());
+
+    /**
+     * @tc.steps: step2. Decode the binary and check the result.
+     * @tc.expected: step2. function name and para are the same as encoded.
+     */
+    FunctionCall result;
+    ASSERT_TRUE(codec.DecodeFunctionCall(encodeBuf, result));
+    EXPECT_EQ(result.GetFuncName(), FUNCTION_NAME_VALUE);
+    ASSERT_EQ(result.GetArgs().size(), 1u);
+    EXPECT_EQ(result.GetArgs()[0].GetStringValue(), FUNCTION_PARA_STRING_VALUE);
+
+    /**
+     * @tc.steps: step3. Encode and decode large lengths, sets and maps with varint.
+     * @tc.expected: step3. values are the same as encoded.
+     */
+    std::vector<int32_t> largeArray(LARGE_ARRAY_SIZE, FUNCTION_PARA_INT_VALUE);
+    FunctionCall largeCall(FUNCTION_NAME_VALUE,
+        { CodecData(largeArray), CodecData(FUNCTION_PARA_SET), CodecData(FUNCTION_PARA_MAP) });
+    std::vector<uint8_t> largeBuf;
+    ASSERT_TRUE(codec.EncodeFunctionCall(largeCall, largeBuf));
+    FunctionCall largeResult;
+    ASSERT_TRUE(codec.DecodeFunctionCall(largeBuf, largeResult));
+    ASSERT_EQ(largeResult.GetArgs().size(), 3u);
+    EXPECT_EQ(largeResult.GetArgs()[0].GetInt32ArrayValue(), largeArray);
+    EXPECT_EQ(largeResult.GetArgs()[1].GetSetValue(), FUNCTION_PARA_SET);
+    EXPECT_EQ(largeResult.GetArgs()[2].GetMapValue(), FUNCTION_PARA_MAP);
+
+    /**
+     * @tc.steps: step4. Decode truncated binary.
+     * @tc.expected: step4. decode fails.
+     */
+    largeBuf.resize(largeBuf.size() / 2);
+    EXPECT_FALSE(codec.DecodeFunctionCall(largeBuf, largeResult));
+}
+
+/**
+ * @tc.name: ZeroCopyCodecTest002
+ * @tc.desc: Decode platform messages as views of the buffer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GroupMessageCodecTest, ZeroCopyCodecTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Decode a string message as view.
+     * @tc.expected: step1. the string refers to the buffer.
+     */
+    std::vector<uint8_t> buffer;
+    StandardCodecBufferWriter writer(buffer);
+    writer.WriteData(CodecData(FUNCTION_PARA_STRING_VALUE));
+    StandardFunctionCodec codec;
+    CodecDataView view;
+    ASSERT_TRUE(codec.DecodePlatformMessageView(buffer.data(), buffer.size(), view));
+    EXPECT_EQ(view.type, BufferDataType::TYPE_STRING);
+    EXPECT_EQ(view.stringValue, FUNCTION_PARA_STRING_VALUE);
+    EXPECT_GT(view.stringValue.data(), reinterpret_cast<const char*>(buffer.data()));
+    EXPECT_LT(view.stringValue.data(), reinterpret_cast<const char*>(buffer.data() + buffer.size()));
+
+    /**
+     * @tc.steps: step2. Decode an int16 array which is unaligned in the buffer.
+     * @tc.expected: step2. the array copied from view is the same as encoded.
+     */
+    buffer.clear();
+    StandardCodecBufferWriter arrayWriter(buffer);
+    arrayWriter.WriteData(CodecData(FUNCTION_PARA_INT16_ARRAY));
+    ASSERT_TRUE(codec.DecodePlatformMessageView(buffer.data(), buffer.size(), view));
+    EXPECT_EQ(view.type, BufferDataType::TYPE_INT16_ARRAY);
+    EXPECT_EQ(view.arrayLength, FUNCTION_PARA_INT16_ARRAY.size());
+    EXPECT_EQ(view.ToCodecData().GetInt16ArrayValue(), FUNCTION_PARA_INT16_ARRAY);
+
+    CodecData message;
+    ASSERT_TRUE(codec.DecodePlatformMessage(buffer.data(), buffer.size(), message));
+    EXPECT_EQ(message.GetInt16ArrayValue(), FUNCTION_PARA_INT16_ARRAY);
+
+    /**
+     * @tc.steps: step3. Decode an array with length larger than the buffer.
+     * @tc.expected: step3. decode fails.
+     */
+    EXPECT_FALSE(codec.DecodePlatformMessageView(buffer.data(), buffer.size() - 1, view));
+    EXPECT_FALSE(codec.DecodePlatformMessageView(nullptr, 0, view));
+}
+
+/**
+ * @tc.name: ZeroCopyCodecTest003
+ * @tc.desc: Decode a large int8 array arriving in chunks with stream decoder.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GroupMessageCodecTest, ZeroCopyCodecTest003, TestSize.Level1)
+{
+    for (auto encoding : { LengthEncoding::FIXED_INT32, LengthEncoding::VARINT }) {
+        /**
+         * @tc.steps: step1. Encode a large int8 array and feed it to decoder in chunks.
+         * @tc.expected: step1. elements received by the chunk callback are the same as encoded.
+         */
+        std::vector<int8_t> bytes(LARGE_ARRAY_SIZE);
+        for (size_t index = 0; index < bytes.size(); ++index) {
+            bytes[index] = static_cast<int8_t>(index);
+        }
+        std::vector<uint8_t> buffer;
+        StandardCodecBufferWriter writer(buffer, encoding);
+        writer.WriteData(CodecData(bytes));
+
+        uint32_t arrayLength = 0;
+        std::vector<int8_t> received;
+        StandardCodecStreamDecoder decoder(encoding);
+        decoder.SetArrayStartCallback([&arrayLength](BufferDataType type, uint32_t length) {
+            EXPECT_EQ(type, BufferDataType::TYPE_INT8_ARRAY);
+            arrayLength = length;
+        });
+        decoder.SetArrayChunkCallback([&received](const uint8_t* data, size_t size) {
+            received.insert(received.end(), data, data + size);
+        });
+        for (size_t offset = 0; offset < buffer.size(); offset += STREAM_CHUNK_SIZE) {
+            ASSERT_TRUE(decoder.Feed(buffer.data() + offset, std::min(STREAM_CHUNK_SIZE, buffer.size() - offset)));
+        }
+        CodecData result;
+        ASSERT_TRUE(decoder.Finish(result));
+        EXPECT_EQ(arrayLength, LARGE_ARRAY_SIZE);
+        EXPECT_EQ(received, bytes);
+        EXPECT_TRUE(result.IsInt8Array());
+
+        /**
+         * @tc.steps: step2. Feed data after the end of message.
+         * @tc.expected: step2. feed fails.
+         */
+        EXPECT_FALSE(decoder.Feed(buffer.data(), 1));
+    }
+
+    /**
+     * @tc.steps: step3. Feed a string message and a truncated array in chunks.
+     * @tc.expected: step3. the string is decoded in Finish, the truncated array fails.
+     */
+    std::vector<uint8_t> buffer;
+    StandardCodecBufferWriter writer(buffer);
+    writer.WriteData(CodecData(FUNCTION_PARA_STRING_VALUE));
+    StandardCodecStreamDecoder stringDecoder;
+    stringDecoder.SetArrayChunkCallback([](const uint8_t* data, size_t size) {});
+    for (auto byte : buffer) {
+        ASSERT_TRUE(stringDecoder.Feed(&byte, 1));
+    }
+    CodecData result;
+    ASSERT_TRUE(stringDecoder.Finish(result));
+    EXPECT_EQ(result.GetStringValue(), FUNCTION_PARA_STRING_VALUE);
+
+    StandardCodecStreamDecoder truncatedDecoder;
+    truncatedDecoder.SetArrayChunkCallback([](const uint8_t* data, size_t size) {});
+    ASSERT_TRUE(truncatedDecoder.Feed(INT8_ARRAY_ENCODE_RESULT.data() + 13, INT8_ARRAY_ENCODE_RESULT.size() - 14));
+    EXPECT_FALSE(truncatedDecoder.Finish(result));
+}
+
+/**
+ * @tc.name: ZeroCopyCodecTest004
+ * @tc.desc: Buffers released to pool are reused by encoding.
+ * @tc.type: FUNC
+ */
+HWTEST_F(GroupMessageCodecTest, ZeroCopyCodecTest004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Release a buffer and acquire a buffer from pool.
+     * @tc.expected: step1. memory of the released buffer is reused.
+     */
+    CodecBufferPool pool;
+    std::vector<uint8_t> buffer(INT8_ARRAY_ENCODE_RESULT);
+    const uint8_t* data = buffer.data();
+    pool.Release(std::move(buffer));
+    EXPECT_EQ(pool.GetIdleCount(), 1u);
+    auto reused = pool.Acquire();
+    EXPECT_EQ(reused.data(), data);
+    EXPECT_TRUE(reused.empty());
+    EXPECT_EQ(pool.GetIdleCount(), 0u);
+
+    /**
+     * @tc.steps: step2. Encode into the reused buffer.
+     * @tc.expected: step2. encode data is the same as legacy encoding.
+     */
+    FunctionCall functionCall(FUNCTION_NAME_VALUE, { CodecData(FUNCTION_PARA_INT8_ARRAY) });
+    StandardFunctionCodec codec;
+    ASSERT_TRUE(codec.EncodeFunctionCall(functionCall, reused));
+    EXPECT_EQ(reused, INT8_ARRAY_ENCODE_RESULT);
+    EXPECT_EQ(reused.data(), data);
+
+    /**
+     * @tc.steps: step3. Release too large buffers and too many buffers.
+     * @tc.expected: step3. pool does not keep them.
+     */
+    pool.Release(std::vector<uint8_t>(CodecBufferPool::MAX_BUFFER_SIZE + 1));
+    EXPECT_EQ(pool.GetIdleCount(), 0u);
+    for (size_t index = 0; index <= CodecBufferPool::MAX_BUFFER_COUNT; ++index) {
+        pool.Release(std::vector<uint8_t>(1));
+    }
+    EXPECT_EQ(pool.GetIdleCount(), CodecBufferPool::MAX_BUFFER_COUNT);
+}
+
 } // namespace OHOS::Ace::Framework
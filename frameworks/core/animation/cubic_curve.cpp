@@ -15,16 +15,35 @@
 
 #include "core/animation/cubic_curve.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace OHOS::Ace {
 namespace {
 
 constexpr float FRACTION_PARAMETER_MAX = 1.0f;
 constexpr float FRACTION_PARAMETER_MIN = 0.0f;
+constexpr int32_t NEWTON_ITERATIONS = 4;
+constexpr int32_t BISECTION_MAX_ITERATIONS = 16;
+constexpr float SOLVE_PRECISION = 1e-7f;
+// times whose error after Newton-Raphson iterations is bigger than this are solved by bisection.
+constexpr float NEWTON_PRECISION = 1e-5f;
+
+} // namespace
 
-}   // namespace
 CubicCurve::CubicCurve(float x0, float y0, float x1, float y1)
     : x0_(x0), y0_(y0), x1_(x1), y1_(y1)
-{}
+{
+    cx_ = 3.0f * x0_;
+    bx_ = 3.0f * (x1_ - x0_) - cx_;
+    ax_ = 1.0f - cx_ - bx_;
+    cy_ = 3.0f * y0_;
+    by_ = 3.0f * (y1_ - y0_) - cy_;
+    ay_ = 1.0f - cy_ - by_;
+    for (int32_t index = 0; index < SAMPLE_TABLE_SIZE; ++index) {
+        sampleValues_[index] = SampleX(static_cast<float>(index) / (SAMPLE_TABLE_SIZE - 1));
+    }
+}
 
 float CubicCurve::MoveInternal(float time)
 {
@@ -32,23 +51,67 @@ float CubicCurve::MoveInternal(float time)
         LOGE("CubicCurve MoveInternal: time is less than 0 or larger than 1, return 1");
         return FRACTION_PARAMETER_MAX;
     }
-    // let P0 = (0,0), P3 = (1,1)
-    float start = 0.0f;
-    float end = 1.0f;
-    while (true) {
-        float midpoint = (start + end) / 2;
-        float estimate = CalculateCubic(x0_, x1_, midpoint);
+    // P0 and P3 are exact.
+    if (time == FRACTION_PARAMETER_MIN || time == FRACTION_PARAMETER_MAX) {
+        return time;
+    }
+    return SampleY(SolveM(time));
+}
+
+float CubicCurve::GuessM(float time, float& intervalStart) const
+{
+    constexpr float sampleStep = 1.0f / (SAMPLE_TABLE_SIZE - 1);
+    // count of samples passed, without branch.
+    int32_t index = 0;
+    for (int32_t sample = 1; sample < SAMPLE_TABLE_SIZE - 1; ++sample) {
+        index += sampleValues_[sample] <= time ? 1 : 0;
+    }
+    intervalStart = static_cast<float>(index) * sampleStep;
+    float intervalWidth = sampleValues_[index + 1] - sampleValues_[index];
+    if (NearZero(intervalWidth)) {
+        return intervalStart;
+    }
+    return intervalStart + (time - sampleValues_[index]) / intervalWidth * sampleStep;
+}
 
-        if (NearEqual(time, estimate, cubicErrorBound_)) {
-            return CalculateCubic(y0_, y1_, midpoint);
+float CubicCurve::SolveM(float time) const
+{
+    float intervalStart = 0.0f;
+    float m = GuessM(time, intervalStart);
+    if (SampleDerivativeX(m) < NEWTON_MIN_SLOPE) {
+        // the slope is too small for Newton-Raphson.
+        return BisectM(time, intervalStart);
+    }
+    for (int32_t iteration = 0; iteration < NEWTON_ITERATIONS; ++iteration) {
+        if (std::abs(SampleX(m) - time) < SOLVE_PRECISION) {
+            return m;
         }
+        m = NewtonStep(m, time);
+    }
+    if (std::abs(SampleX(m) - time) > NEWTON_PRECISION) {
+        return BisectM(time, intervalStart);
+    }
+    return m;
+}
 
-        if (estimate < time) {
-            start = midpoint;
+float CubicCurve::BisectM(float time, float intervalStart) const
+{
+    float start = intervalStart;
+    float end = std::min(intervalStart + 1.0f / (SAMPLE_TABLE_SIZE - 1), FRACTION_PARAMETER_MAX);
+    float m = start;
+    for (int32_t iteration = 0; iteration < BISECTION_MAX_ITERATIONS; ++iteration) {
+        m = (start + end) / 2.0f;
+        float error = SampleX(m) - time;
+        if (std::abs(error) < SOLVE_PRECISION) {
+            break;
+        }
+        if (error < 0.0f) {
+            start = m;
         } else {
-            end = midpoint;
+            end = m;
         }
     }
+    return m;
 }
 
 const std::string CubicCurve::ToString()
@@ -60,9 +123,4 @@ const std::string CubicCurve::ToString()
     return curveString;
 }
 
-float CubicCurve::CalculateCubic(float a, float b, float m)
-{
-    return 3.0f * a * (1.0f - m) * (1.0f - m) * m + 3.0f * b * (1.0f - m) * m * m + m * m * m;
-}
-
 } // namespace OHOS::Ace
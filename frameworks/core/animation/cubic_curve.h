@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_CUBIC_CURVE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_CUBIC_CURVE_H
 
+#include <algorithm>
+
 #include "core/animation/curve.h"
 
 namespace OHOS::Ace {
@@ -26,7 +28,9 @@ class NativeCurveHelper;
 // where P0 = (0,0), P1 = (x0_, y0_), P2 = (x1_, y1_),  P3 = (1,1)
 // so Bx(m) = 3m(1-m)^2*x0_ + 3m^2*x1_ + m^3
 //    By(m) = 3m(1-m)^2*y0_ + 3m^2*y1_ + m^3
-// in function MoveInternal, assume time as Bx(m), we let Bx(m) approaching time, and we can get m and the output By(m)
+// in function MoveInternal, assume time as Bx(m), we solve m from Bx(m) = time and output By(m). Bx is sampled at
+// construction, the sample table gives the initial m, which is refined by Newton-Raphson iterations, or by bisection
+// in the sample interval when the slope is too small.
 class ACE_EXPORT CubicCurve : public Curve {
     DECLARE_ACE_TYPE(CubicCurve, Curve);
 
@@ -38,15 +42,51 @@ public:
     const std::string ToString() override;
 
 private:
-    // Bx(m) or By(m) = 3m(1-m)^2*a + 3m^2*b + m^3, where a = x0_ ,b = x1_ or a = y0_ ,b = y1_
-    static float CalculateCubic(float a, float b, float m);
+    static constexpr int32_t SAMPLE_TABLE_SIZE = 11;
+    static constexpr float NEWTON_MIN_SLOPE = 0.001f;
+
+    float SampleX(float m) const
+    {
+        return ((ax_ * m + bx_) * m + cx_) * m;
+    }
+
+    float SampleY(float m) const
+    {
+        return ((ay_ * m + by_) * m + cy_) * m;
+    }
+
+    float SampleDerivativeX(float m) const
+    {
+        return (3.0f * ax_ * m + 2.0f * bx_) * m + cx_;
+    }
+
+    // The slope is clamped and m is kept in [0, 1], so the step has no branch.
+    float NewtonStep(float m, float time) const
+    {
+        float slope = std::max(SampleDerivativeX(m), NEWTON_MIN_SLOPE);
+        return std::clamp(m - (SampleX(m) - time) / slope, 0.0f, 1.0f);
+    }
+
+    // Returns the initial m of time from the sample table, and the start of the sample interval.
+    float GuessM(float time, float& intervalStart) const;
+    float SolveM(float time) const;
+    float BisectM(float time, float intervalStart) const;
 
-    float cubicErrorBound_ = 0.001f; // Control curve accuracy
     float x0_;                       // X-axis of the first point (P1)
     float y0_;                       // Y-axis of the first point (P1)
     float x1_;                       // X-axis of the second point (P2)
     float y1_;                       // Y-axis of the second point (P2)
 
+    // polynomial coefficients, Bx(m) = ((ax_ * m + bx_) * m + cx_) * m
+    float ax_ = 0.0f;
+    float bx_ = 0.0f;
+    float cx_ = 0.0f;
+    float ay_ = 0.0f;
+    float by_ = 0.0f;
+    float cy_ = 0.0f;
+    // Bx(m) at m = index / (SAMPLE_TABLE_SIZE - 1)
+    float sampleValues_[SAMPLE_TABLE_SIZE] = { 0.0f };
+
     friend class NativeCurveHelper;
 };
 
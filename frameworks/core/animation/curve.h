@@ -44,6 +44,7 @@ public:
 
     // Each subclass needs to override this method to implement motion in the 0.0 to 1.0 time range.
     virtual float MoveInternal(float time) = 0;
+
     virtual const std::string ToString()
     {
         return "";
@@ -13,6 +13,9 @@
  * limitations under the License.
  */
 
+#include <array>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "adapter/aosp/entrance/java/jni/jni_environment.h"
@@ -69,6 +72,28 @@ constexpr uint32_t PICTURE_ANIMATION_DURATION_MULTIPLE = 2;
 constexpr uint32_t KEYFRAME_ANIMATION_DURATION_MULTIPLE = 2;
 constexpr uint64_t NANO_FRAME_TIME = static_cast<const uint64_t>(1e9 / 60);
 constexpr float CUBIC_ERROR_BOUND = 0.01f;
+constexpr double CUBIC_REFERENCE_ERROR_BOUND = 0.001;
+constexpr int32_t CUBIC_SAMPLE_COUNT = 1001;
+
+// Solve the cubic curve in double by bisection, used as the reference of CubicCurve.
+double ReferenceCubic(double x0, double y0, double x1, double y1, double time)
+{
+    auto calculateCubic = [](double a, double b, double m) {
+        return 3.0 * a * (1.0 - m) * (1.0 - m) * m + 3.0 * b * (1.0 - m) * m * m + m * m * m;
+    };
+    double start = 0.0;
+    double end = 1.0;
+    double midpoint = 0.5;
+    for (int32_t iteration = 0; iteration < 64; ++iteration) {
+        midpoint = (start + end) / 2.0;
+        if (calculateCubic(x0, x1, midpoint) < time) {
+            start = midpoint;
+        } else {
+            end = midpoint;
+        }
+    }
+    return calculateCubic(y0, y1, midpoint);
+}
 
 } // namespace
 
@@ -823,6 +848,36 @@ HWTEST_F(AnimationFrameworkTest, AnimationCurveTest009, TestSize.Level1)
     EXPECT_NEAR(0.0f, complementaryCurve.MoveInternal(testValueSecond), FLT_EPSILON);
 }
 
+/**
+ * @tc.name: AnimationCurveTest010
+ * @tc.desc: Verify the built-in cubic curves against the reference solved in double
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimationFrameworkTest, AnimationCurveTest010, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. solve the built-in cubic curves and the reference at uniform times.
+     * @tc.expected: step1. the results are close to the reference, and the end points are exact.
+     */
+    std::vector<std::pair<RefPtr<CubicCurve>, std::array<double, 4>>> curves = {
+        { Curves::EASE, { 0.25, 0.1, 0.25, 1.0 } }, { Curves::EASE_IN, { 0.42, 0.0, 1.0, 1.0 } },
+        { Curves::EASE_OUT, { 0.0, 0.0, 0.58, 1.0 } }, { Curves::EASE_IN_OUT, { 0.42, 0.0, 0.58, 1.0 } },
+        { Curves::FAST_OUT_SLOW_IN, { 0.4, 0.0, 0.2, 1.0 } }, { Curves::LINEAR_OUT_SLOW_IN, { 0.0, 0.0, 0.2, 1.0 } },
+        { Curves::FAST_OUT_LINEAR_IN, { 0.4, 0.0, 1.0, 1.0 } }, { Curves::FRICTION, { 0.2, 0.0, 0.2, 1.0 } },
+        { Curves::EXTREME_DECELERATION, { 0.0, 0.0, 0.0, 1.0 } }, { Curves::SHARP, { 0.33, 0.0, 0.67, 1.0 } },
+        { Curves::RHYTHM, { 0.7, 0.0, 0.2, 1.0 } }, { Curves::SMOOTH, { 0.4, 0.0, 0.4, 1.0 } },
+        { Curves::MAGNETIC, { 0.8, 0.0, 1.0, 0.6 } } };
+    for (const auto& [curve, points] : curves) {
+        for (int32_t index = 0; index < CUBIC_SAMPLE_COUNT; ++index) {
+            float time = static_cast<float>(index) / (CUBIC_SAMPLE_COUNT - 1);
+            double reference = ReferenceCubic(points[0], points[1], points[2], points[3], time);
+            EXPECT_NEAR(reference, curve->MoveInternal(time), CUBIC_REFERENCE_ERROR_BOUND) << curve->ToString();
+        }
+        EXPECT_NEAR(0.0f, curve->MoveInternal(0.0f), FLT_EPSILON);
+        EXPECT_NEAR(1.0f, curve->MoveInternal(1.0f), FLT_EPSILON);
+    }
+}
+
 /**
  * @tc.name: AnimationListenableTest001
  * @tc.desc: Verify the whether listen the value of animation
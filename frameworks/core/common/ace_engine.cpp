@@ -20,7 +20,9 @@
 
 #include "base/log/dump_log.h"
 #include "base/log/log.h"
+#include "base/memory/fixed_block_pool.h"
 #include "base/memory/memory_monitor.h"
+#include "base/memory/ref_counter.h"
 #include "base/thread/background_task_executor.h"
 #include "core/common/ace_application_info.h"
 #include "core/common/ace_page.h"
@@ -168,6 +170,13 @@ void AceEngine::TriggerGarbageCollection()
 
     auto taskExecutor = copied.begin()->second->GetTaskExecutor();
     taskExecutor->PostTask([] { PurgeMallocCache(); }, TaskExecutor::TaskType::PLATFORM);
+    // Most pooled objects are freed on the ui thread, so its cached blocks are trimmed there.
+    taskExecutor->PostTask(
+        [] {
+            RefCounter::TrimPool();
+            SizeClassPool::Trim();
+        },
+        TaskExecutor::TaskType::UI);
 #if defined(OHOS_PLATFORM) && defined(ENABLE_NATIVE_VIEW)
     // GPU and IO thread is shared while enable native view
     taskExecutor->PostTask([] { PurgeMallocCache(); }, TaskExecutor::TaskType::GPU);
@@ -179,6 +188,8 @@ void AceEngine::TriggerGarbageCollection()
     }
 
     ImageCache::Purge();
+    RefCounter::TrimPool();
+    SizeClassPool::Trim();
     BackgroundTaskExecutor::GetInstance().TriggerGarbageCollection();
     PurgeMallocCache();
 }
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+
+#define private public
+#include "adapter/ohos/entrance/file_asset_provider.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+const std::string FIRST_BASE_PATH = "first/";
+const std::string SECOND_BASE_PATH = "second/";
+
+void WriteFile(const std::string& fileName, const std::string& content)
+{
+    std::FILE* fp = std::fopen(fileName.c_str(), "w");
+    ASSERT_NE(fp, nullptr) << fileName;
+    std::fwrite(content.data(), 1, content.size(), fp);
+    std::fclose(fp);
+}
+
+std::string ReadAsset(const FileAssetProvider& provider, const std::string& assetName)
+{
+    auto mapping = provider.GetAsMapping(assetName);
+    if (!mapping) {
+        return "";
+    }
+    return std::string(reinterpret_cast<const char*>(mapping->GetMapping()), mapping->GetSize());
+}
+
+} // namespace
+
+class FileAssetProviderTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp() {}
+    void TearDown() {}
+
+    static std::string packagePath_;
+};
+
+std::string FileAssetProviderTest::packagePath_;
+
+// Package of two base paths, "common/shared.json" is in both of them.
+void FileAssetProviderTest::SetUpTestCase()
+{
+    char pathTemplate[] = "/tmp/file_asset_provider_test_XXXXXX";
+    ASSERT_NE(mkdtemp(pathTemplate), nullptr);
+    packagePath_ = std::string(pathTemplate) + "/";
+    mkdir((packagePath_ + FIRST_BASE_PATH).c_str(), S_IRWXU);
+    mkdir((packagePath_ + FIRST_BASE_PATH + "common").c_str(), S_IRWXU);
+    mkdir((packagePath_ + SECOND_BASE_PATH).c_str(), S_IRWXU);
+    mkdir((packagePath_ + SECOND_BASE_PATH + "common").c_str(), S_IRWXU);
+    WriteFile(packagePath_ + FIRST_BASE_PATH + "common/shared.json", "first");
+    WriteFile(packagePath_ + SECOND_BASE_PATH + "common/shared.json", "second");
+    mkdir((packagePath_ + SECOND_BASE_PATH + "pages").c_str(), S_IRWXU);
+    WriteFile(packagePath_ + SECOND_BASE_PATH + "pages/index.js", "index");
+}
+
+void FileAssetProviderTest::TearDownTestCase()
+{
+    std::string command = "rm -rf " + packagePath_;
+    system(command.c_str());
+}
+
+/**
+ * @tc.name: FileAssetProviderTest001
+ * @tc.desc: Verify that the index is built on the first lookup, and indexed assets are loaded from the first base
+ *           path which contains them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileAssetProviderTest, FileAssetProviderTest001, TestSize.Level1)
+{
+    FileAssetProvider provider;
+    ASSERT_TRUE(provider.Initialize(packagePath_, { FIRST_BASE_PATH, SECOND_BASE_PATH }));
+    EXPECT_TRUE(provider.assetIndex_.empty());
+
+    EXPECT_EQ(ReadAsset(provider, "common/shared.json"), "first");
+    EXPECT_EQ(ReadAsset(provider, "pages/index.js"), "index");
+    EXPECT_EQ(provider.assetIndex_.size(), 2u);
+    EXPECT_EQ(provider.GetAssetPath("common/shared.json"), packagePath_ + FIRST_BASE_PATH);
+    EXPECT_EQ(provider.GetAssetPath("pages/index.js"), packagePath_ + SECOND_BASE_PATH);
+}
+
+/**
+ * @tc.name: FileAssetProviderTest002
+ * @tc.desc: Verify that assets in none of the base paths are not found.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileAssetProviderTest, FileAssetProviderTest002, TestSize.Level1)
+{
+    FileAssetProvider provider;
+    ASSERT_TRUE(provider.Initialize(packagePath_, { FIRST_BASE_PATH, SECOND_BASE_PATH }));
+    EXPECT_EQ(provider.GetAsMapping("pages/missing.js"), nullptr);
+    EXPECT_EQ(provider.GetAsMapping("common"), nullptr);
+    EXPECT_EQ(provider.GetAssetPath("pages/missing.js"), "");
+}
+
+/**
+ * @tc.name: FileAssetProviderTest003
+ * @tc.desc: Verify that assets missing in the index, such as names not normalized or files added after the index is
+ *           built, are found by probing the base paths.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FileAssetProviderTest, FileAssetProviderTest003, TestSize.Level1)
+{
+    FileAssetProvider provider;
+    ASSERT_TRUE(provider.Initialize(packagePath_, { FIRST_BASE_PATH, SECOND_BASE_PATH }));
+    EXPECT_EQ(ReadAsset(provider, "./pages/index.js"), "index");
+    EXPECT_EQ(provider.assetIndex_.count("./pages/index.js"), 0u);
+
+    WriteFile(packagePath_ + SECOND_BASE_PATH + "pages/added.js", "added");
+    EXPECT_EQ(provider.assetIndex_.count("pages/added.js"), 0u);
+    EXPECT_EQ(ReadAsset(provider, "pages/added.js"), "added");
+    EXPECT_EQ(provider.GetAssetPath("pages/added.js"), packagePath_ + SECOND_BASE_PATH);
+    std::remove((packagePath_ + SECOND_BASE_PATH + "pages/added.js").c_str());
+}
+
+} // namespace OHOS::Ace
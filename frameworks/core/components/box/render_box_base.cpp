@@ -76,11 +76,11 @@ double RenderBoxBase::CalculateHeightPercent(double percent) const
 double RenderBoxBase::ConvertMarginToPx(CalcDimension dimension, bool vertical, bool additional) const
 {
     if (dimension.Unit() == DimensionUnit::CALC) {
-        std::string value = dimension.CalcValue();
         auto node = AceType::Claim(const_cast<RenderBoxBase*>(this));
-        return StringExpression::CalculateExp(value, [vertical, node](const Dimension& dim) -> double {
-            return node->NormalizePercentToPx(dim, vertical, false);
-        });
+        return StringExpression::CalculateExp(
+            dimension.GetCalcProgram(), [vertical, node](const Dimension& dim) -> double {
+                return node->NormalizePercentToPx(dim, vertical, false);
+            });
     } else if (dimension.Unit() == DimensionUnit::PERCENT) {
         double parentLimit = 0.0;
         if (vertical) {
@@ -115,11 +115,11 @@ double RenderBoxBase::ConvertMarginToPx(CalcDimension dimension, bool vertical,
 double RenderBoxBase::ConvertDimensionToPx(CalcDimension dimension, bool vertical, bool defaultZero) const
 {
     if (dimension.Unit() == DimensionUnit::CALC) {
-        std::string value = dimension.CalcValue();
         auto node = AceType::Claim(const_cast<RenderBoxBase*>(this));
-        return StringExpression::CalculateExp(value, [vertical, node](const Dimension& dim) -> double {
-            return node->NormalizePercentToPx(dim, vertical, false);
-        });
+        return StringExpression::CalculateExp(
+            dimension.GetCalcProgram(), [vertical, node](const Dimension& dim) -> double {
+                return node->NormalizePercentToPx(dim, vertical, false);
+            });
     } else if (dimension.Unit() == DimensionUnit::PERCENT) {
         double parentLimit = GetLayoutParam().GetMaxSize().Width();
         if (vertical) {
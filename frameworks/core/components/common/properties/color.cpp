@@ -15,8 +15,10 @@
 
 #include "core/components/common/properties/color.h"
 
+#include <array>
 #include <cmath>
-#include <regex>
+#include <cstdlib>
+#include <functional>
 
 #include "base/utils/linear_map.h"
 #include "base/utils/string_utils.h"
@@ -25,86 +27,163 @@
 namespace OHOS::Ace {
 namespace {
 
-constexpr uint32_t COLOR_STRING_SIZE_STANDARD = 8;
-constexpr uint32_t COLOR_STRING_BASE = 16;
-constexpr uint32_t RGB_SUB_MATCH_SIZE = 4;
-constexpr uint32_t RGBA_SUB_MATCH_SIZE = 5;
-
-const std::regex COLOR_WITH_MAGIC("#[0-9A-Fa-f]{6,8}");
-const std::regex COLOR_WITH_MAGIC_MINI("#[0-9A-Fa-f]{3,4}");
-const std::regex COLOR_WITH_RGB(R"(rgb\(([0-9]{1,3})\,([0-9]{1,3})\,([0-9]{1,3})\))", std::regex::icase);
-const std::regex COLOR_WITH_RGBA(R"(rgba\(([0-9]{1,3})\,([0-9]{1,3})\,([0-9]{1,3})\,(\d+\.?\d*)\))", std::regex::icase);
+constexpr size_t COLOR_STRING_SIZE_STANDARD = 8;
+constexpr size_t COLOR_STRING_SIZE_MIN = 6;
+constexpr size_t COLOR_STRING_SIZE_MINI_STANDARD = 4;
+constexpr size_t COLOR_STRING_SIZE_MINI_MIN = 3;
+constexpr uint32_t DECIMAL_BASE = 10;
+constexpr uint32_t HEX_DIGIT_BITS = 4;
+constexpr size_t MAX_COLOR_COMPONENT_DIGITS = 3;
+constexpr size_t COLOR_CACHE_SIZE = 64;
+constexpr size_t MAX_CACHED_COLOR_STRING_SIZE = 32;
 constexpr double GAMMA_FACTOR = 2.2;
 constexpr float MAX_ALPHA = 255.0f;
 constexpr char HEX[] = "0123456789ABCDEF";
 constexpr uint8_t BIT_LENGTH_INT32 = 8;
 
-} // namespace
-
-const Color Color::TRANSPARENT = Color(0x00000000);
-const Color Color::WHITE = Color(0xffffffff);
-const Color Color::BLACK = Color(0xff000000);
-const Color Color::RED = Color(0xffff0000);
-const Color Color::GREEN = Color(0xff00ff00);
-const Color Color::BLUE = Color(0xff0000ff);
-const Color Color::GRAY = Color(0xffc0c0c0);
-
-Color Color::FromString(std::string colorStr, uint32_t maskAlpha)
+int32_t HexDigitToInt(char ch)
 {
-    if (colorStr.empty()) {
-        // empty string, return transparent
-        return Color::TRANSPARENT;
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
     }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + DECIMAL_BASE;
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + DECIMAL_BASE;
+    }
+    return -1;
+}
 
-    // Remove all " ".
-    colorStr.erase(std::remove(colorStr.begin(), colorStr.end(), ' '), colorStr.end());
+bool IsDigit(char ch)
+{
+    return ch >= '0' && ch <= '9';
+}
 
-    std::smatch matches;
-    // Regex match for #909090 or #90909090.
-    if (std::regex_match(colorStr, matches, COLOR_WITH_MAGIC)) {
-        colorStr.erase(0, 1);
-        auto value = stoul(colorStr, nullptr, COLOR_STRING_BASE);
-        if (colorStr.length() < COLOR_STRING_SIZE_STANDARD) {
-            // no alpha specified, set alpha to 0xff
-            value |= maskAlpha;
-        }
-        return Color(value);
+char ToLower(char ch)
+{
+    return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+}
+
+// Parse #rrggbb, #aarrggbb, #rgb and #argb.
+bool ParseHexColor(const std::string& colorStr, uint32_t maskAlpha, uint32_t& value)
+{
+    size_t length = colorStr.size() - 1;
+    bool isMini = length == COLOR_STRING_SIZE_MINI_MIN || length == COLOR_STRING_SIZE_MINI_STANDARD;
+    if (colorStr[0] != '#' || (!isMini && (length < COLOR_STRING_SIZE_MIN || length > COLOR_STRING_SIZE_STANDARD))) {
+        return false;
     }
-    // Regex match for #rgb or #rgba.
-    if (std::regex_match(colorStr, matches, COLOR_WITH_MAGIC_MINI)) {
-        colorStr.erase(0, 1);
-        std::string newColorStr;
-        // translate #rgb or #rgba to #rrggbb or #rrggbbaa
-        for (auto& c : colorStr) {
-            newColorStr += c;
-            newColorStr += c;
+    value = 0;
+    for (size_t i = 1; i <= length; ++i) {
+        int32_t digit = HexDigitToInt(colorStr[i]);
+        if (digit < 0) {
+            return false;
         }
-        auto value = stoul(newColorStr, nullptr, COLOR_STRING_BASE);
-        if (newColorStr.length() < COLOR_STRING_SIZE_STANDARD) {
-            // no alpha specified, set alpha to 0xff
-            value |= maskAlpha;
+        value = (value << HEX_DIGIT_BITS) | static_cast<uint32_t>(digit);
+        if (isMini) {
+            // translate #rgb or #argb to #rrggbb or #aarrggbb
+            value = (value << HEX_DIGIT_BITS) | static_cast<uint32_t>(digit);
         }
-        return Color(value);
     }
-    // Regex match for rgb(90,254,180).
-    if (std::regex_match(colorStr, matches, COLOR_WITH_RGB)) {
-        if (matches.size() == RGB_SUB_MATCH_SIZE) {
-            auto red = static_cast<uint8_t>(std::stoi(matches[1]));   // red value.
-            auto green = static_cast<uint8_t>(std::stoi(matches[2])); // green value.
-            auto blue = static_cast<uint8_t>(std::stoi(matches[3]));  // blue value.
-            return FromRGB(red, green, blue);
+    if ((isMini ? length * 2 : length) < COLOR_STRING_SIZE_STANDARD) {
+        // no alpha specified, set alpha to 0xff
+        value |= maskAlpha;
+    }
+    return true;
+}
+
+// Skip case insensitive prefix such as "rgb(".
+bool SkipPrefix(const std::string& colorStr, const char* prefix, size_t& pos)
+{
+    for (pos = 0; prefix[pos] != '\0'; ++pos) {
+        if (pos >= colorStr.size() || ToLower(colorStr[pos]) != prefix[pos]) {
+            return false;
         }
     }
-    // Regex match for rgba(90,254,180,0.5).
-    if (std::regex_match(colorStr, matches, COLOR_WITH_RGBA)) {
-        if (matches.size() == RGBA_SUB_MATCH_SIZE) {
-            auto red = static_cast<uint8_t>(std::stoi(matches[1]));
-            auto green = static_cast<uint8_t>(std::stoi(matches[2]));
-            auto blue = static_cast<uint8_t>(std::stoi(matches[3]));
-            auto opacity = static_cast<double>(std::stod(matches[4]));
-            return FromRGBO(red, green, blue, opacity);
+    return true;
+}
+
+// Parse component with 1 to 3 decimal digits followed by the delimiter.
+bool ParseColorComponent(const std::string& colorStr, char delimiter, size_t& pos, uint8_t& component)
+{
+    uint32_t value = 0;
+    size_t start = pos;
+    while (pos < colorStr.size() && IsDigit(colorStr[pos]) && pos - start < MAX_COLOR_COMPONENT_DIGITS) {
+        value = value * DECIMAL_BASE + static_cast<uint32_t>(colorStr[pos] - '0');
+        ++pos;
+    }
+    if (pos == start || pos >= colorStr.size() || colorStr[pos] != delimiter) {
+        return false;
+    }
+    ++pos;
+    component = static_cast<uint8_t>(value);
+    return true;
+}
+
+// Parse opacity matches "\d+\.?\d*" which is the last argument of rgba().
+bool ParseOpacity(const std::string& colorStr, size_t& pos, double& opacity)
+{
+    size_t start = pos;
+    while (pos < colorStr.size() && IsDigit(colorStr[pos])) {
+        ++pos;
+    }
+    if (pos == start) {
+        return false;
+    }
+    if (pos < colorStr.size() && colorStr[pos] == '.') {
+        ++pos;
+        while (pos < colorStr.size() && IsDigit(colorStr[pos])) {
+            ++pos;
         }
     }
+    if (pos + 1 != colorStr.size() || colorStr[pos] != ')') {
+        return false;
+    }
+    // The number is validated and followed by ')', so strtod stops at the end of it.
+    opacity = std::strtod(colorStr.c_str() + start, nullptr);
+    ++pos;
+    return true;
+}
+
+// Parse rgb(90,254,180) and rgba(90,254,180,0.5).
+bool ParseRgbColor(const std::string& colorStr, Color& color)
+{
+    size_t pos = 0;
+    bool hasAlpha = SkipPrefix(colorStr, "rgba(", pos);
+    if (!hasAlpha && !SkipPrefix(colorStr, "rgb(", pos)) {
+        return false;
+    }
+    uint8_t red = 0;
+    uint8_t green = 0;
+    uint8_t blue = 0;
+    if (!ParseColorComponent(colorStr, ',', pos, red) || !ParseColorComponent(colorStr, ',', pos, green)) {
+        return false;
+    }
+    if (!hasAlpha) {
+        if (!ParseColorComponent(colorStr, ')', pos, blue) || pos != colorStr.size()) {
+            return false;
+        }
+        color = Color::FromRGB(red, green, blue);
+        return true;
+    }
+    double opacity = 0.0;
+    if (!ParseColorComponent(colorStr, ',', pos, blue) || !ParseOpacity(colorStr, pos, opacity)) {
+        return false;
+    }
+    color = Color::FromRGBO(red, green, blue, opacity);
+    return true;
+}
+
+Color ParseColorString(const std::string& colorStr, uint32_t maskAlpha)
+{
+    uint32_t value = 0;
+    if (ParseHexColor(colorStr, maskAlpha, value)) {
+        return Color(value);
+    }
+    Color color;
+    if (ParseRgbColor(colorStr, color)) {
+        return color;
+    }
     // match for special string
     static const LinearMapNode<Color> colorTable[] = {
         { "black", Color(0xff000000) },
@@ -129,6 +208,48 @@ Color Color::FromString(std::string colorStr, uint32_t maskAlpha)
     return Color::BLACK;
 }
 
+// Direct mapped cache of parsed color strings, pages and themes use a small set of colors repeatedly.
+struct ColorCacheEntry {
+    std::string colorStr;
+    Color color;
+};
+
+} // namespace
+
+const Color Color::TRANSPARENT = Color(0x00000000);
+const Color Color::WHITE = Color(0xffffffff);
+const Color Color::BLACK = Color(0xff000000);
+const Color Color::RED = Color(0xffff0000);
+const Color Color::GREEN = Color(0xff00ff00);
+const Color Color::BLUE = Color(0xff0000ff);
+const Color Color::GRAY = Color(0xffc0c0c0);
+
+Color Color::FromString(std::string colorStr, uint32_t maskAlpha)
+{
+    if (colorStr.empty()) {
+        // empty string, return transparent
+        return Color::TRANSPARENT;
+    }
+
+    // Remove all " ".
+    colorStr.erase(std::remove(colorStr.begin(), colorStr.end(), ' '), colorStr.end());
+    if (colorStr.empty()) {
+        return Color::BLACK;
+    }
+    if (maskAlpha != COLOR_ALPHA_MASK || colorStr.size() > MAX_CACHED_COLOR_STRING_SIZE) {
+        return ParseColorString(colorStr, maskAlpha);
+    }
+
+    // Cached per thread, so no lock is needed.
+    static thread_local std::array<ColorCacheEntry, COLOR_CACHE_SIZE> colorCache;
+    auto& entry = colorCache[std::hash<std::string>()(colorStr) % COLOR_CACHE_SIZE];
+    if (entry.colorStr != colorStr) {
+        entry.color = ParseColorString(colorStr, maskAlpha);
+        entry.colorStr = std::move(colorStr);
+    }
+    return entry.color;
+}
+
 std::string Color::ColorToString() const
 {
     std::string colorStr;
@@ -1828,7 +1828,8 @@ sk_sp<SkImage> RosenRenderCustomPaint::GetImage(const std::string& src)
         auto rasterizedImage = image->makeRasterImage();
         auto canvasImage = flutter::CanvasImage::Create();
         canvasImage->set_image({ rasterizedImage, renderTaskHolder_->unrefQueue });
-        imageCache_->CacheImage(src, std::make_shared<CachedImage>(canvasImage));
+        auto cachedImage = std::make_shared<CachedImage>(canvasImage);
+        imageCache_->CacheImage(src, cachedImage, cachedImage->GetSize());
         return rasterizedImage;
     }
 
@@ -1054,6 +1054,10 @@ void FlutterRenderImage::DrawSVGImage(const Offset& offset, ScopedCanvas& canvas
     }
     skiaDom_->setContainerSize({ width, height });
     canvas->clipRect(0, 0, width, height, SkClipOp::kIntersect);
+    if (ImageProvider::DrawSvgRaster(
+        canvas.GetSkCanvas(), sourceInfo_, skiaDom_, Size(width, height), GetContext())) {
+        return;
+    }
     skiaDom_->render(canvas.GetSkCanvas());
 }
 
@@ -1142,6 +1142,9 @@ void RosenRenderImage::DrawSVGImage(const Offset& offset, SkCanvas* canvas)
     }
     skiaDom_->setContainerSize({ width, height });
     canvas->clipRect({ 0, 0, width, height }, SkClipOp::kIntersect, true);
+    if (ImageProvider::DrawSvgRaster(canvas, sourceInfo_, skiaDom_, Size(width, height), GetContext())) {
+        return;
+    }
     skiaDom_->render(canvas);
 }
 
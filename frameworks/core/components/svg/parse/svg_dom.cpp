@@ -54,6 +54,8 @@ namespace {
 
 const char DOM_SVG_STYLE[] = "style";
 const char DOM_SVG_CLASS[] = "class";
+// estimated memory of a parsed node with its component and declaration.
+constexpr size_t ESTIMATED_NODE_SIZE = 1024;
 
 } // namespace
 
@@ -148,14 +150,24 @@ RefPtr<SvgDom> SvgDom::CreateSvgDom(SkStream& svgStream, const WeakPtr<PipelineC
 
 bool SvgDom::ParseSvg(SkStream& svgStream)
 {
-    SkDOM xmlDom;
-    if (!xmlDom.build(svgStream)) {
+    auto xmlDom = std::make_shared<SkDOM>();
+    if (!xmlDom->build(svgStream)) {
         return false;
     }
+    xmlDom_ = xmlDom;
+    if (!TranslateXmlDom()) {
+        return false;
+    }
+    parsedSize_ = nodeCount_ * ESTIMATED_NODE_SIZE + (svgStream.hasLength() ? svgStream.getLength() : 0);
+    return true;
+}
+
+bool SvgDom::TranslateXmlDom()
+{
     if (svgContext_ == nullptr) {
         svgContext_ = AceType::MakeRefPtr<SvgContext>();
     }
-    root_ = TranslateSvgNode(xmlDom, xmlDom.getRootNode(), nullptr);
+    root_ = TranslateSvgNode(*xmlDom_, xmlDom_->getRootNode(), nullptr);
     if (root_ == nullptr) {
         return false;
     }
@@ -168,6 +180,21 @@ bool SvgDom::ParseSvg(SkStream& svgStream)
     return true;
 }
 
+RefPtr<SvgDom> SvgDom::Clone() const
+{
+    if (!xmlDom_) {
+        return nullptr;
+    }
+    auto svgDom = AceType::MakeRefPtr<SvgDom>(context_);
+    svgDom->fillColor_ = fillColor_;
+    svgDom->xmlDom_ = xmlDom_;
+    if (!svgDom->TranslateXmlDom()) {
+        return nullptr;
+    }
+    svgDom->parsedSize_ = parsedSize_;
+    return svgDom;
+}
+
 RefPtr<SvgNode> SvgDom::TranslateSvgNode(const SkDOM& dom, const SkDOM::Node* xmlNode,
     const RefPtr<SvgNode>& parent)
 {
@@ -192,6 +219,7 @@ RefPtr<SvgNode> SvgDom::TranslateSvgNode(const SkDOM& dom, const SkDOM::Node* xm
         return nullptr;
     }
     node->SetContext(context_, svgContext_);
+    ++nodeCount_;
     ParseAttrs(dom, xmlNode, node);
     for (auto* child = dom.getFirstChild(xmlNode, nullptr); child; child = dom.getNextSibling(child)) {
         const auto& childNode = TranslateSvgNode(dom, child, node);
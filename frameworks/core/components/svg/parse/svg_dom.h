@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_SVG_PARSE_SVG_DOM_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_SVG_PARSE_SVG_DOM_H
 
+#include <memory>
 #include <unordered_map>
 #include <stack>
 #include "src/xml/SkDOM.h"
@@ -69,6 +70,9 @@ public:
     static RefPtr<SvgDom> CreateSvgDom(SkStream& svgStream, const WeakPtr<PipelineContext>& context,
         const std::optional<Color>& svgThemeColor);
     bool ParseSvg(SkStream& svgStream);
+    // The clone translates the xml dom again, so it has its own svg nodes and context which are changed by rendering,
+    // only the xml parsing is shared.
+    RefPtr<SvgDom> Clone() const;
     void CreateRenderNode(ImageFit imageFit, const SvgRadius& svgRadius, bool useBox = true);
     void UpdateLayout(ImageFit imageFit, const SvgRadius& svgRadius, bool useBox = true);
     void PaintDirectly(RenderContext& context, const Offset& offset);
@@ -119,10 +123,17 @@ public:
         return svgAnimate_;
     }
 
+    // Estimated memory of the xml dom and the svg nodes, which is charged against the svg dom cache.
+    size_t GetParsedSize() const
+    {
+        return parsedSize_;
+    }
+
 private:
     void InitAnimatorGroup(const RefPtr<RenderNode>& node);
     void AddToAnimatorGroup(const RefPtr<RenderNode>& node, RefPtr<AnimatorGroup>& animatorGroup);
 
+    bool TranslateXmlDom();
     RefPtr<SvgNode> TranslateSvgNode(const SkDOM& dom, const SkDOM::Node* xmlNode, const RefPtr<SvgNode>& parent);
     void ParseAttrs(const SkDOM& xmlDom, const SkDOM::Node* xmlNode, const RefPtr<SvgNode>& svgNode);
     void SetAttrValue(const std::string& name, const std::string& value, const RefPtr<SvgNode>& svgNode);
@@ -137,6 +148,8 @@ private:
     void SyncRSNode(const RefPtr<RenderNode>& renderNode);
 
     WeakPtr<PipelineContext> context_;
+    // the xml dom is never changed after it is built, it is shared by the clones.
+    std::shared_ptr<const SkDOM> xmlDom_;
     RefPtr<SvgContext> svgContext_;
     RefPtr<SvgNode> root_;
     RefPtr<RenderNode> renderNode_;
@@ -151,6 +164,8 @@ private:
     PushAttr attrCallback_;
     bool svgAnimate_ = false;
     bool hasClipPath_ = false;
+    size_t nodeCount_ = 0;
+    size_t parsedSize_ = 0;
 };
 
 } // namespace OHOS::Ace
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include "core/components/common/properties/color.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+
+class ColorTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: ColorFromString001
+ * @tc.desc: Parse hex colors, alpha is added when it is not specified.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ColorTest, ColorFromString001, TestSize.Level1)
+{
+    EXPECT_EQ(Color::FromString("#007DFF").GetValue(), 0xff007dffu);
+    EXPECT_EQ(Color::FromString("#99182431").GetValue(), 0x99182431u);
+    EXPECT_EQ(Color::FromString("#1234567").GetValue(), 0xff234567u);
+    EXPECT_EQ(Color::FromString("#abc").GetValue(), 0xffaabbccu);
+    EXPECT_EQ(Color::FromString("#8abc").GetValue(), 0x88aabbccu);
+    EXPECT_EQ(Color::FromString("# 00 7d ff").GetValue(), 0xff007dffu);
+    EXPECT_EQ(Color::FromString("#007DFF", 0).GetValue(), 0x00007dffu);
+    EXPECT_EQ(Color::FromString("#12345").GetValue(), Color::BLACK.GetValue());
+    EXPECT_EQ(Color::FromString("#12345g").GetValue(), Color::BLACK.GetValue());
+}
+
+/**
+ * @tc.name: ColorFromString002
+ * @tc.desc: Parse rgb() and rgba() colors case insensitively.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ColorTest, ColorFromString002, TestSize.Level1)
+{
+    EXPECT_EQ(Color::FromString("rgb(10, 89, 247)").GetValue(), 0xff0a59f7u);
+    EXPECT_EQ(Color::FromString("RGB(10,89,247)").GetValue(), 0xff0a59f7u);
+    EXPECT_EQ(Color::FromString("rgba(0,0,0,0.5)").GetValue(), 0x80000000u);
+    EXPECT_EQ(Color::FromString("rgba(255,255,255,1.)").GetValue(), 0xffffffffu);
+    EXPECT_EQ(Color::FromString("rgba(0,0,0,.5)").GetValue(), Color::BLACK.GetValue());
+    EXPECT_EQ(Color::FromString("rgb(1,2,3,4)").GetValue(), Color::BLACK.GetValue());
+    EXPECT_EQ(Color::FromString("rgb(1000,2,3)").GetValue(), Color::BLACK.GetValue());
+    EXPECT_EQ(Color::FromString("rgb(1,2,3))").GetValue(), Color::BLACK.GetValue());
+}
+
+/**
+ * @tc.name: ColorFromString003
+ * @tc.desc: Parse color names and numbers, repeated strings return the same color from cache.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ColorTest, ColorFromString003, TestSize.Level1)
+{
+    EXPECT_EQ(Color::FromString("").GetValue(), Color::TRANSPARENT.GetValue());
+    EXPECT_EQ(Color::FromString("red").GetValue(), Color::RED.GetValue());
+    EXPECT_EQ(Color::FromString("Red").GetValue(), Color::BLACK.GetValue());
+    EXPECT_EQ(Color::FromString("4278190335").GetValue(), 0xff0000ffu);
+    EXPECT_EQ(Color::FromString("unknown").GetValue(), Color::BLACK.GetValue());
+    for (int32_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(Color::FromString("#33182431").GetValue(), 0x33182431u);
+        EXPECT_EQ(Color::FromString("#182431").GetValue(), 0xff182431u);
+        EXPECT_EQ(Color::FromString("#182431", 0).GetValue(), 0x00182431u);
+    }
+}
+} // namespace OHOS::Ace
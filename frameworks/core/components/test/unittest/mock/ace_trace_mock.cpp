@@ -22,6 +22,11 @@ AceScopedTrace::AceScopedTrace(const char* format, ...)
     traceEnabled_ = false;
 }
 
+AceScopedTrace::AceScopedTrace(TraceSite& site, const char* format, ...)
+{
+    traceEnabled_ = false;
+}
+
 AceScopedTrace::~AceScopedTrace()
 {
 }
@@ -174,7 +174,14 @@ void FrameNode::SwapDirtyLayoutWrapperOnMainThread(const RefPtr<LayoutWrapper>&
 
 void FrameNode::SetGeometryNode(RefPtr<GeometryNode>&& node)
 {
+    bool frameChange = !node || geometryNode_->GetFrame().GetRect() != node->GetFrame().GetRect();
     geometryNode_.Swap(std::move(node));
+    if (frameChange) {
+        auto parent = GetParent();
+        if (parent) {
+            parent->MarkTouchTestIndexDirty();
+        }
+    }
 }
 
 std::optional<UITask> FrameNode::CreateLayoutTask(bool onCreate, bool forceUseMainThread)
@@ -190,8 +197,7 @@ std::optional<UITask> FrameNode::CreateLayoutTask(bool onCreate, bool forceUseMa
     } else {
         layoutWrapper = CreateLayoutWrapperOnCreate();
     }
-    auto task = [layoutWrapper, layoutConstraint = GetLayoutConstraint(), offset = GetParentGlobalOffset(),
-                    forceUseMainThread]() {
+    auto task = [layoutWrapper, layoutConstraint = GetLayoutConstraint(), offset = GetParentGlobalOffset()]() {
         {
             ACE_SCOPED_TRACE("LayoutWrapper::Measure");
             layoutWrapper->Measure(layoutConstraint);
@@ -200,21 +206,21 @@ std::optional<UITask> FrameNode::CreateLayoutTask(bool onCreate, bool forceUseMa
             ACE_SCOPED_TRACE("LayoutWrapper::Layout");
             layoutWrapper->Layout(offset);
         }
-        {
-            ACE_SCOPED_TRACE("LayoutWrapper::MountToHostOnMainThread");
-            if (forceUseMainThread || layoutWrapper->CheckShouldRunOnMain()) {
-                layoutWrapper->MountToHostOnMainThread();
-                return;
-            }
-            auto host = layoutWrapper->GetHostNode();
-            CHECK_NULL_VOID(host);
-            host->PostTask([layoutWrapper]() { layoutWrapper->MountToHostOnMainThread(); });
-        }
+    };
+    auto mountTask = [layoutWrapper]() {
+        ACE_SCOPED_TRACE("LayoutWrapper::MountToHostOnMainThread");
+        layoutWrapper->MountToHostOnMainThread();
     };
     if (forceUseMainThread || layoutWrapper->CheckShouldRunOnMain()) {
-        return UITask(std::move(task), MAIN_TASK);
+        return UITask(
+            [task = std::move(task), mountTask = std::move(mountTask)]() {
+                task();
+                mountTask();
+            },
+            MAIN_TASK);
     }
-    return UITask(std::move(task), layoutWrapper->CanRunOnWhichThread());
+    // Measure and layout can run on background thread, the mount task is committed by UITaskScheduler on main thread.
+    return UITask(std::move(task), layoutWrapper->CanRunOnWhichThread(), std::move(mountTask));
 }
 
 std::optional<UITask> FrameNode::CreateRenderTask(bool forceUseMainThread)
@@ -224,14 +230,23 @@ std::optional<UITask> FrameNode::CreateRenderTask(bool forceUseMainThread)
     }
     ACE_SCOPED_TRACE("CreateRenderTask:PrepareTask");
     auto wrapper = CreatePaintWrapper();
-    auto task = [wrapper]() {
-        ACE_SCOPED_TRACE("FrameNode::RenderTask");
-        wrapper->FlushRender();
-    };
     if (forceUseMainThread || wrapper->CheckShouldRunOnMain()) {
+        auto task = [wrapper]() {
+            ACE_SCOPED_TRACE("FrameNode::RenderTask");
+            wrapper->FlushRender();
+        };
         return UITask(std::move(task), MAIN_TASK);
     }
-    return UITask(std::move(task), wrapper->CanRunOnWhichThread());
+    auto task = [wrapper]() {
+        ACE_SCOPED_TRACE("FrameNode::PrepareRenderTask");
+        wrapper->PrepareRender();
+    };
+    // Recordings are submitted to render context tree by UITaskScheduler on main thread.
+    auto commitTask = [wrapper]() {
+        ACE_SCOPED_TRACE("FrameNode::CommitRenderTask");
+        wrapper->CommitRender();
+    };
+    return UITask(std::move(task), wrapper->CanRunOnWhichThread(), std::move(commitTask));
 }
 
 LayoutConstraintF FrameNode::GetLayoutConstraint() const
@@ -477,20 +492,16 @@ HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& pare
     TouchTestResult newComingTargets;
     const auto localPoint = parentLocalPoint - geometryNode_->GetFrameOffset();
     // TODO: add hit test mode.
-    const auto& children = GetChildren();
-    for (auto iter = children.rbegin(); iter != children.rend(); ++iter) {
-        const auto& child = *iter;
+    VisitTouchTestChildren(localPoint, [&](const RefPtr<UINode>& child) {
         auto childHitResult = child->TouchTest(globalPoint, localPoint, touchRestrict, newComingTargets);
         if (childHitResult == HitTestResult::STOP_BUBBLING) {
             preventBubbling = true;
-            break;
+            return false;
         }
         // In normal process, the node block the brother node.
-        if (childHitResult == HitTestResult::BUBBLING) {
-            // TODO: add hit test mode judge.
-            break;
-        }
-    }
+        // TODO: add hit test mode judge.
+        return childHitResult != HitTestResult::BUBBLING;
+    });
     if (!preventBubbling) {
         auto gestureHub = eventHub_->GetGestureEventHub();
         if (gestureHub) {
@@ -147,6 +147,11 @@ public:
     HitTestResult TouchTest(const PointF& globalPoint, const PointF& parentLocalPoint,
         const TouchRestrict& touchRestrict, TouchTestResult& result) override;
 
+    std::optional<RectF> GetTouchTestRect() const override
+    {
+        return geometryNode_->GetFrame().GetRect();
+    }
+
     bool IsAtomicNode() const override;
 
     void MarkNeedSyncRenderTree() override
@@ -154,6 +159,37 @@ public:
         needSyncRenderTree_ = true;
     }
 
+    bool IsNeedSyncRenderTree() const
+    {
+        return needSyncRenderTree_;
+    }
+
+    bool IsActive() const
+    {
+        return isActive_;
+    }
+
+    // Used by UITaskScheduler to avoid pushing the node into dirty queue repeatedly.
+    bool IsInDirtyLayoutQueue() const
+    {
+        return isInDirtyLayoutQueue_;
+    }
+
+    void SetInDirtyLayoutQueue(bool isInDirtyLayoutQueue)
+    {
+        isInDirtyLayoutQueue_ = isInDirtyLayoutQueue;
+    }
+
+    bool IsInDirtyRenderQueue() const
+    {
+        return isInDirtyRenderQueue_;
+    }
+
+    void SetInDirtyRenderQueue(bool isInDirtyRenderQueue)
+    {
+        isInDirtyRenderQueue_ = isInDirtyRenderQueue;
+    }
+
 private:
     RefPtr<FrameNode> GetAncestorNodeOfFrame() const;
 
@@ -196,6 +232,8 @@ private:
 
     bool isLayoutDirtyMarked_ = false;
     bool isRenderDirtyMarked_ = false;
+    bool isInDirtyLayoutQueue_ = false;
+    bool isInDirtyRenderQueue_ = false;
     bool isMeasureBoundary_ = false;
     bool hasPendingRequest_ = false;
 
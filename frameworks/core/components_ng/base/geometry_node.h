@@ -34,6 +34,9 @@ namespace OHOS::Ace::NG {
 // GeometryNode acts as a physical property of the size and position of the component
 class ACE_EXPORT GeometryNode : public Referenced {
 public:
+    // Cloned for every layout and paint task.
+    DECLARE_POOLED_ALLOCATION();
+
     GeometryNode() = default;
 
     ~GeometryNode() override = default;
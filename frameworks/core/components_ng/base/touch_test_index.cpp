@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "core/components_ng/base/touch_test_index.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace OHOS::Ace::NG {
+namespace {
+
+// rects are enlarged when they are put in cells, since IsInRegion accepts points near the edges.
+constexpr float RECT_TOLERANCE = 1.0f;
+constexpr int32_t MAX_GRID_SIZE = 64;
+// items covering more cells are put in global items, such as the background of a stack.
+constexpr int32_t MAX_CELLS_PER_ITEM = 16;
+
+} // namespace
+
+void TouchTestIndex::Build(std::vector<std::optional<RectF>>&& rects)
+{
+    rects_ = std::move(rects);
+    globalItems_.clear();
+    cellStarts_.clear();
+    cellItems_.clear();
+
+    float left = 0.0f;
+    float top = 0.0f;
+    float right = 0.0f;
+    float bottom = 0.0f;
+    int32_t boundedCount = 0;
+    for (const auto& rect : rects_) {
+        if (!rect) {
+            continue;
+        }
+        left = boundedCount == 0 ? rect->Left() : std::min(left, rect->Left());
+        top = boundedCount == 0 ? rect->Top() : std::min(top, rect->Top());
+        right = boundedCount == 0 ? rect->Right() : std::max(right, rect->Right());
+        bottom = boundedCount == 0 ? rect->Bottom() : std::max(bottom, rect->Bottom());
+        ++boundedCount;
+    }
+    bounds_ = RectF(left - RECT_TOLERANCE, top - RECT_TOLERANCE, right - left + RECT_TOLERANCE * 2,
+        bottom - top + RECT_TOLERANCE * 2);
+    auto gridSize = std::clamp(static_cast<int32_t>(std::ceil(std::sqrt(boundedCount))), 1, MAX_GRID_SIZE);
+    columns_ = gridSize;
+    rows_ = gridSize;
+    cellWidth_ = bounds_.Width() / columns_;
+    cellHeight_ = bounds_.Height() / rows_;
+
+    // count items of every cell, then fill them in the order of items.
+    auto cellCount = columns_ * rows_;
+    std::vector<int32_t> counts(cellCount + 1, 0);
+    std::vector<bool> isGlobal(rects_.size(), false);
+    for (int32_t item = 0; item < static_cast<int32_t>(rects_.size()); ++item) {
+        int32_t cellLeft = 0;
+        int32_t cellTop = 0;
+        int32_t cellRight = 0;
+        int32_t cellBottom = 0;
+        if (!rects_[item] || !GetCellRange(*rects_[item], cellLeft, cellTop, cellRight, cellBottom) ||
+            (cellRight - cellLeft + 1) * (cellBottom - cellTop + 1) > MAX_CELLS_PER_ITEM) {
+            isGlobal[item] = true;
+            globalItems_.emplace_back(item);
+            continue;
+        }
+        for (int32_t row = cellTop; row <= cellBottom; ++row) {
+            for (int32_t column = cellLeft; column <= cellRight; ++column) {
+                ++counts[row * columns_ + column + 1];
+            }
+        }
+    }
+    for (int32_t cell = 0; cell < cellCount; ++cell) {
+        counts[cell + 1] += counts[cell];
+    }
+    cellStarts_ = counts;
+    cellItems_.resize(cellStarts_.back());
+    for (int32_t item = 0; item < static_cast<int32_t>(rects_.size()); ++item) {
+        if (isGlobal[item]) {
+            continue;
+        }
+        int32_t cellLeft = 0;
+        int32_t cellTop = 0;
+        int32_t cellRight = 0;
+        int32_t cellBottom = 0;
+        GetCellRange(*rects_[item], cellLeft, cellTop, cellRight, cellBottom);
+        for (int32_t row = cellTop; row <= cellBottom; ++row) {
+            for (int32_t column = cellLeft; column <= cellRight; ++column) {
+                cellItems_[counts[row * columns_ + column]++] = item;
+            }
+        }
+    }
+}
+
+bool TouchTestIndex::GetCellRange(
+    const RectF& rect, int32_t& left, int32_t& top, int32_t& right, int32_t& bottom) const
+{
+    if (!std::isfinite(rect.Left()) || !std::isfinite(rect.Top()) || !std::isfinite(rect.Right()) ||
+        !std::isfinite(rect.Bottom()) || cellWidth_ <= 0.0f || cellHeight_ <= 0.0f) {
+        return false;
+    }
+    auto toCell = [](float offset, float cellSize, int32_t count) {
+        return std::clamp(static_cast<int32_t>(std::floor(offset / cellSize)), 0, count - 1);
+    };
+    left = toCell(std::min(rect.Left(), rect.Right()) - RECT_TOLERANCE - bounds_.Left(), cellWidth_, columns_);
+    right = toCell(std::max(rect.Left(), rect.Right()) + RECT_TOLERANCE - bounds_.Left(), cellWidth_, columns_);
+    top = toCell(std::min(rect.Top(), rect.Bottom()) - RECT_TOLERANCE - bounds_.Top(), cellHeight_, rows_);
+    bottom = toCell(std::max(rect.Top(), rect.Bottom()) + RECT_TOLERANCE - bounds_.Top(), cellHeight_, rows_);
+    return true;
+}
+
+bool TouchTestIndex::MayContain(int32_t item, const PointF& point) const
+{
+    const auto& rect = rects_[item];
+    return !rect || rect->IsInRegion(point);
+}
+
+void TouchTestIndex::Query(const PointF& point, std::vector<int32_t>& result) const
+{
+    result.clear();
+    const int32_t* cellBegin = nullptr;
+    const int32_t* cellEnd = nullptr;
+    if (!cellStarts_.empty() && cellWidth_ > 0.0f && cellHeight_ > 0.0f && bounds_.IsInRegion(point)) {
+        auto column = std::clamp(
+            static_cast<int32_t>(std::floor((point.GetX() - bounds_.Left()) / cellWidth_)), 0, columns_ - 1);
+        auto row = std::clamp(
+            static_cast<int32_t>(std::floor((point.GetY() - bounds_.Top()) / cellHeight_)), 0, rows_ - 1);
+        auto cell = row * columns_ + column;
+        cellBegin = cellItems_.data() + cellStarts_[cell];
+        cellEnd = cellItems_.data() + cellStarts_[cell + 1];
+    }
+
+    // merge items of the cell and global items from the last one.
+    auto globalIter = globalItems_.rbegin();
+    while (cellBegin != cellEnd || globalIter != globalItems_.rend()) {
+        int32_t item = 0;
+        if (globalIter == globalItems_.rend() || (cellBegin != cellEnd && *(cellEnd - 1) > *globalIter)) {
+            item = *(--cellEnd);
+        } else {
+            item = *(globalIter++);
+        }
+        if (MayContain(item, point)) {
+            result.emplace_back(item);
+        }
+    }
+}
+
+} // namespace OHOS::Ace::NG
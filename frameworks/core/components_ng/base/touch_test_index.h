@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_TOUCH_TEST_INDEX_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_TOUCH_TEST_INDEX_H
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "base/geometry/ng/point_t.h"
+#include "base/geometry/ng/rect_t.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace::NG {
+
+// Uniform grid over the rects of the children of a node, used by touch test to find the children which may contain
+// the point without testing all of them. Items without rect, such as syntax nodes, and items covering many cells are
+// returned for every point.
+class ACE_EXPORT TouchTestIndex final {
+public:
+    // Nodes with less children are tested one by one.
+    static constexpr size_t MIN_ITEM_COUNT = 16;
+
+    TouchTestIndex() = default;
+    ~TouchTestIndex() = default;
+
+    // Index of item is its position in rects, in the paint order of children.
+    void Build(std::vector<std::optional<RectF>>&& rects);
+
+    // Returns the items which contain the point, from the last item to the first one, same as the order of touch test.
+    void Query(const PointF& point, std::vector<int32_t>& result) const;
+
+    size_t GetItemCount() const
+    {
+        return rects_.size();
+    }
+
+private:
+    bool GetCellRange(const RectF& rect, int32_t& left, int32_t& top, int32_t& right, int32_t& bottom) const;
+    bool MayContain(int32_t item, const PointF& point) const;
+
+    std::vector<std::optional<RectF>> rects_;
+    // items returned for every point, in ascending order.
+    std::vector<int32_t> globalItems_;
+    // items of cell i are cellItems_[cellStarts_[i], cellStarts_[i + 1]), in ascending order.
+    std::vector<int32_t> cellStarts_;
+    std::vector<int32_t> cellItems_;
+    RectF bounds_;
+    int32_t columns_ = 0;
+    int32_t rows_ = 0;
+    float cellWidth_ = 0.0f;
+    float cellHeight_ = 0.0f;
+
+    ACE_DISALLOW_COPY_AND_MOVE(TouchTestIndex);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_TOUCH_TEST_INDEX_H
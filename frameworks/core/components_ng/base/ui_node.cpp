@@ -47,6 +47,7 @@ void UINode::AddChild(const RefPtr<UINode>& child, int32_t slot)
     it = children_.begin();
     std::advance(it, slot);
     children_.insert(it, child);
+    MarkTouchTestIndexDirty();
     if (onMainTree_) {
         child->AttachToMainTree();
     }
@@ -59,6 +60,7 @@ void UINode::RemoveChild(const RefPtr<UINode>& child)
     CHECK_NULL_VOID(child);
 
     children_.remove(child);
+    MarkTouchTestIndexDirty();
     if (onMainTree_) {
         child->DetachFromMainTree();
     }
@@ -127,6 +129,7 @@ void UINode::MovePosition(int32_t slot)
         children.remove(self);
     }
     children.insert(it, self);
+    parentNode->MarkTouchTestIndexDirty();
     MarkNeedSyncRenderTree();
 }
 
@@ -212,19 +215,62 @@ HitTestResult UINode::TouchTest(const PointF& globalPoint, const PointF& parentL
     const TouchRestrict& touchRestrict, TouchTestResult& result)
 {
     HitTestResult hitTestResult = HitTestResult::OUT_OF_REGION;
-    for (auto iter = children_.rbegin(); iter != children_.rend(); ++iter) {
-        auto& child = *iter;
+    VisitTouchTestChildren(parentLocalPoint, [&](const RefPtr<UINode>& child) {
         auto hitResult = child->TouchTest(globalPoint, parentLocalPoint, touchRestrict, result);
         if (hitResult == HitTestResult::STOP_BUBBLING) {
-            return HitTestResult::STOP_BUBBLING;
+            hitTestResult = HitTestResult::STOP_BUBBLING;
+            return false;
         }
         if (hitResult == HitTestResult::BUBBLING) {
             hitTestResult = HitTestResult::BUBBLING;
         }
-    }
+        return true;
+    });
     return hitTestResult;
 }
 
+void UINode::VisitTouchTestChildren(
+    const PointF& localPoint, const std::function<bool(const RefPtr<UINode>&)>& visitor)
+{
+    if (children_.size() < TouchTestIndex::MIN_ITEM_COUNT) {
+        for (auto iter = children_.rbegin(); iter != children_.rend(); ++iter) {
+            if (!visitor(*iter)) {
+                return;
+            }
+        }
+        return;
+    }
+    if (!touchTestIndex_) {
+        BuildTouchTestIndex();
+    }
+    std::vector<int32_t> candidates;
+    touchTestIndex_->Query(localPoint, candidates);
+    for (auto index : candidates) {
+        if (!visitor(touchTestChildren_[index])) {
+            return;
+        }
+    }
+}
+
+void UINode::BuildTouchTestIndex()
+{
+    ACE_SCOPED_TRACE("BuildTouchTestIndex");
+    std::vector<std::optional<RectF>> rects;
+    rects.reserve(children_.size());
+    touchTestChildren_.assign(children_.begin(), children_.end());
+    for (const auto& child : touchTestChildren_) {
+        rects.emplace_back(child->GetTouchTestRect());
+    }
+    touchTestIndex_ = std::make_unique<TouchTestIndex>();
+    touchTestIndex_->Build(std::move(rects));
+}
+
+void UINode::MarkTouchTestIndexDirty()
+{
+    touchTestIndex_.reset();
+    touchTestChildren_.clear();
+}
+
 int32_t UINode::FrameCount() const
 {
     return TotalChildCount();
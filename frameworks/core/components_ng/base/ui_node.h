@@ -16,12 +16,17 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_UI_NODE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_UI_NODE_H
 
+#include <functional>
 #include <list>
+#include <memory>
+#include <optional>
 
 #include "base/geometry/ng/point_t.h"
+#include "base/geometry/ng/rect_t.h"
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
+#include "core/components_ng/base/touch_test_index.h"
 #include "core/components_ng/event/gesture_event_hub.h"
 #include "core/components_ng/layout/layout_wrapper.h"
 #include "core/event/touch_event.h"
@@ -134,6 +139,15 @@ public:
     virtual HitTestResult TouchTest(const PointF& globalPoint, const PointF& parentLocalPoint,
         const TouchRestrict& touchRestrict, TouchTestResult& result);
 
+    // Region tested by TouchTest in the coordinates of parent, std::nullopt if the node does not check the region.
+    virtual std::optional<RectF> GetTouchTestRect() const
+    {
+        return std::nullopt;
+    }
+
+    // Called when children or their touch test rects are changed.
+    void MarkTouchTestIndexDirty();
+
     // In the request to re-layout the scene, needs to obtain the changed state of the child node for the creation of
     // parent's layout wrapper
     virtual void UpdateLayoutPropertyFlag();
@@ -152,6 +166,10 @@ public:
     }
 
 protected:
+    // Visit the children which may contain the local point from the top to the bottom, until the visitor returns
+    // false. Children of nodes with many children are found in TouchTestIndex.
+    void VisitTouchTestChildren(const PointF& localPoint, const std::function<bool(const RefPtr<UINode>&)>& visitor);
+
     virtual void OnChildAdded(const RefPtr<UINode>& child) {}
 
     virtual void OnChildRemoved(const RefPtr<UINode>& child) {}
@@ -176,6 +194,13 @@ protected:
     bool isRoot_ = false;
     bool onMainTree_ = false;
 
+private:
+    void BuildTouchTestIndex();
+
+    // built at the first touch test after changes.
+    std::unique_ptr<TouchTestIndex> touchTestIndex_;
+    std::vector<RefPtr<UINode>> touchTestChildren_;
+
     ACE_DISALLOW_COPY_AND_MOVE(UINode);
 };
 
@@ -29,6 +29,7 @@
 #include "core/common/container_scope.h"
 #include "core/common/thread_checker.h"
 #include "core/components_ng/image_provider/adapter/skia_image_data.h"
+#include "core/components_ng/image_provider/adapter/skia_image_decoder.h"
 #include "core/components_ng/image_provider/image_object.h"
 #include "core/components_ng/render/adapter/skia_canvas_image.h"
 #include "core/image/image_loader.h"
@@ -57,74 +58,6 @@ public:
     fml::RefPtr<fml::TaskRunner> ioTaskRunner;
 };
 
-static sk_sp<SkImage> ApplySizeToSkImage(
-    const sk_sp<SkImage>& rawImage, int32_t dstWidth, int32_t dstHeight, const std::string& srcKey)
-{
-    auto scaledImageInfo =
-        SkImageInfo::Make(dstWidth, dstHeight, rawImage->colorType(), rawImage->alphaType(), rawImage->refColorSpace());
-    SkBitmap scaledBitmap;
-    if (!scaledBitmap.tryAllocPixels(scaledImageInfo)) {
-        LOGE("Could not allocate bitmap when attempting to scale. srcKey: %{private}s, destination size: [%{public}d x"
-             " %{public}d], raw image size: [%{public}d x %{public}d]",
-            srcKey.c_str(), dstWidth, dstHeight, rawImage->width(), rawImage->height());
-        return rawImage;
-    }
-#ifdef NG_BUILD
-    if (!rawImage->scalePixels(
-            scaledBitmap.pixmap(), SkSamplingOptions(SkFilterMode::kLinear), SkImage::kDisallow_CachingHint)) {
-#else
-    if (!rawImage->scalePixels(scaledBitmap.pixmap(), kLow_SkFilterQuality, SkImage::kDisallow_CachingHint)) {
-#endif
-        LOGE("Could not scale pixels srcKey: %{private}s, destination size: [%{public}d x"
-             " %{public}d], raw image size: [%{public}d x %{public}d]",
-            srcKey.c_str(), dstWidth, dstHeight, rawImage->width(), rawImage->height());
-        return rawImage;
-    }
-    // Marking this as immutable makes the MakeFromBitmap call share the pixels instead of copying.
-    scaledBitmap.setImmutable();
-    auto scaledImage = SkImage::MakeFromBitmap(scaledBitmap);
-    if (scaledImage) {
-        // TODO: cache
-        return scaledImage;
-    }
-    LOGE("Could not create a scaled image from a scaled bitmap. srcKey: %{private}s, destination size: [%{public}d x"
-         " %{public}d], raw image size: [%{public}d x %{public}d]",
-        srcKey.c_str(), dstWidth, dstHeight, rawImage->width(), rawImage->height());
-    return rawImage;
-}
-
-static sk_sp<SkImage> ResizeSkImage(
-    const sk_sp<SkImage>& rawImage, const std::string& src, const SizeF& resizeTarget, bool forceResize)
-{
-    if (!resizeTarget.IsPositive()) {
-        LOGE("not valid size! resizeTarget: %{public}s, src: %{public}s", resizeTarget.ToString().c_str(), src.c_str());
-        return rawImage;
-    }
-    int32_t dstWidth = static_cast<int32_t>(resizeTarget.Width() + 0.5);
-    int32_t dstHeight = static_cast<int32_t>(resizeTarget.Height() + 0.5);
-
-    bool needResize = false;
-
-    if (!forceResize) {
-        if (rawImage->width() > dstWidth) {
-            needResize = true;
-        } else {
-            dstWidth = rawImage->width();
-        }
-        if (rawImage->height() > dstHeight) {
-            needResize = true;
-        } else {
-            dstHeight = rawImage->height();
-        }
-    }
-
-    if (!needResize && !forceResize) {
-        return rawImage;
-    }
-    return ApplySizeToSkImage(
-        rawImage, dstWidth, dstHeight, ImageObject::GenerateCacheKey(ImageSourceInfo(src), resizeTarget));
-}
-
 } // namespace
 
 RefPtr<ImageEncodedInfo> ImageEncodedInfo::CreateImageEncodedInfo(const RefPtr<NG::ImageData>& data)
@@ -160,7 +93,22 @@ void ImageProvider::MakeCanvasImage(const WeakPtr<ImageObject>& imageObjWp, cons
         CHECK_NULL_VOID(renderTaskHolder);
         auto flutterRenderTaskHolder = DynamicCast<FlutterRenderTaskHolder>(renderTaskHolder);
         CHECK_NULL_VOID(flutterRenderTaskHolder);
-        // TODO: add cache
+        // update canvas image to ImageObject and trigger loadSuccessCallback_
+        auto notifyLoadSuccess = [objWp, loadCallbacks](const RefPtr<CanvasImage>& canvasImage) {
+            auto notifyLoadSuccessTask = [objWp, loadCallbacks, canvasImage] {
+                auto obj = objWp.Upgrade();
+                CHECK_NULL_VOID(obj);
+                obj->SetCanvasImage(canvasImage);
+                loadCallbacks.loadSuccessCallback_(obj->GetSourceInfo());
+            };
+            ImageProvider::WrapTaskAndPostToUI(std::move(notifyLoadSuccessTask));
+        };
+        auto cacheKey = ImageObject::GenerateCacheKey(obj->GetSourceInfo(), resizeTarget);
+        auto cachedImage = ImageProvider::GetCanvasImageFromCache(cacheKey);
+        if (cachedImage) {
+            notifyLoadSuccess(cachedImage);
+            return;
+        }
         // if image object has no skData, reload data.
         std::string errorMessage("");
         if (!obj->GetData()) {
@@ -190,7 +138,10 @@ void ImageProvider::MakeCanvasImage(const WeakPtr<ImageObject>& imageObjWp, cons
         // resize image
         auto skiaImageData = DynamicCast<SkiaImageData>(obj->GetData());
         ACE_DCHECK(skiaImageData);
-        auto rawImage = SkImage::MakeFromEncoded(skiaImageData->GetSkData());
+        auto rawImage = SkiaImageDecoder::DecodeToTargetSize(skiaImageData->GetSkData(), resizeTarget);
+        if (!rawImage) {
+            rawImage = SkImage::MakeFromEncoded(skiaImageData->GetSkData());
+        }
         if (!rawImage) {
             LOGE(
                 "static image MakeFromEncoded fail! source info: %{private}s", obj->GetSourceInfo().ToString().c_str());
@@ -203,7 +154,7 @@ void ImageProvider::MakeCanvasImage(const WeakPtr<ImageObject>& imageObjWp, cons
             return;
         }
         // upload to gpu for render
-        auto image = ResizeSkImage(rawImage, obj->GetSourceInfo().GetSrc(), resizeTarget, false);
+        auto image = SkiaImageDecoder::ResizeImage(rawImage, obj->GetSourceInfo().GetSrc(), resizeTarget, false);
         flutter::SkiaGPUObject<SkImage> skiaGpuObjSkImage({ image, flutterRenderTaskHolder->unrefQueue });
 #ifdef NG_BUILD
         auto canvasImage = CanvasImage::Create();
@@ -216,17 +167,12 @@ void ImageProvider::MakeCanvasImage(const WeakPtr<ImageObject>& imageObjWp, cons
         flutterCanvasImage->set_image(std::move(skiaGpuObjSkImage));
         auto canvasImage = CanvasImage::Create(&flutterCanvasImage);
 #endif
-        auto uploadTask = [objWp, loadCallbacks](RefPtr<CanvasImage> canvasImage) {
-            // when upload success, update canvas image to ImageObject and trigger loadSuccessCallback_
+        auto uploadTask = [objWp, cacheKey, notifyLoadSuccess](RefPtr<CanvasImage> canvasImage) {
+            // when upload success, cache the image and notify ImageObject
             auto obj = objWp.Upgrade();
             CHECK_NULL_VOID(obj);
-            auto notifyLoadSuccessTask = [objWp, loadCallbacks, canvasImage] {
-                auto obj = objWp.Upgrade();
-                CHECK_NULL_VOID(obj);
-                obj->SetCanvasImage(canvasImage);
-                loadCallbacks.loadSuccessCallback_(obj->GetSourceInfo());
-            };
-            ImageProvider::WrapTaskAndPostToUI(std::move(notifyLoadSuccessTask));
+            ImageProvider::CacheCanvasImage(cacheKey, canvasImage);
+            notifyLoadSuccess(canvasImage);
         };
         ImageProvider::UploadImageToGPUForRender(canvasImage, std::move(uploadTask), renderTaskHolder);
     };
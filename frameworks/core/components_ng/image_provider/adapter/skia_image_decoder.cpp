@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/image_provider/adapter/skia_image_decoder.h"
+
+#include <algorithm>
+
+#include "third_party/skia/include/codec/SkCodec.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+#include "base/log/log.h"
+#include "base/utils/utils.h"
+#include "core/components_ng/image_provider/image_object.h"
+
+namespace OHOS::Ace::NG {
+
+sk_sp<SkImage> SkiaImageDecoder::ApplySizeToSkImage(
+    const sk_sp<SkImage>& rawImage, int32_t dstWidth, int32_t dstHeight, const std::string& srcKey)
+{
+    auto scaledImageInfo =
+        SkImageInfo::Make(dstWidth, dstHeight, rawImage->colorType(), rawImage->alphaType(), rawImage->refColorSpace());
+    SkBitmap scaledBitmap;
+    if (!scaledBitmap.tryAllocPixels(scaledImageInfo)) {
+        LOGE("Could not allocate bitmap when attempting to scale. srcKey: %{private}s, destination size: [%{public}d x"
+             " %{public}d], raw image size: [%{public}d x %{public}d]",
+            srcKey.c_str(), dstWidth, dstHeight, rawImage->width(), rawImage->height());
+        return rawImage;
+    }
+#ifdef NG_BUILD
+    if (!rawImage->scalePixels(
+            scaledBitmap.pixmap(), SkSamplingOptions(SkFilterMode::kLinear), SkImage::kDisallow_CachingHint)) {
+#else
+    if (!rawImage->scalePixels(scaledBitmap.pixmap(), kLow_SkFilterQuality, SkImage::kDisallow_CachingHint)) {
+#endif
+        LOGE("Could not scale pixels srcKey: %{private}s, destination size: [%{public}d x"
+             " %{public}d], raw image size: [%{public}d x %{public}d]",
+            srcKey.c_str(), dstWidth, dstHeight, rawImage->width(), rawImage->height());
+        return rawImage;
+    }
+    // Marking this as immutable makes the MakeFromBitmap call share the pixels instead of copying.
+    scaledBitmap.setImmutable();
+    auto scaledImage = SkImage::MakeFromBitmap(scaledBitmap);
+    if (scaledImage) {
+        return scaledImage;
+    }
+    LOGE("Could not create a scaled image from a scaled bitmap. srcKey: %{private}s, destination size: [%{public}d x"
+         " %{public}d], raw image size: [%{public}d x %{public}d]",
+        srcKey.c_str(), dstWidth, dstHeight, rawImage->width(), rawImage->height());
+    return rawImage;
+}
+
+// Halve the image until it is less than twice the destination size before the final scaling. Bilinear sampling at
+// half size averages every 2x2 pixels, while sampling a much smaller size directly skips most of the source pixels.
+sk_sp<SkImage> SkiaImageDecoder::DownsampleByHalves(
+    const sk_sp<SkImage>& rawImage, int32_t dstWidth, int32_t dstHeight, const std::string& srcKey)
+{
+    auto image = rawImage;
+    while (image->width() >= dstWidth * 2 && image->height() >= dstHeight * 2) {
+        auto halfImage = ApplySizeToSkImage(image, image->width() / 2, image->height() / 2, srcKey);
+        if (halfImage == image) {
+            break;
+        }
+        image = halfImage;
+    }
+    return image;
+}
+
+sk_sp<SkImage> SkiaImageDecoder::ResizeImage(
+    const sk_sp<SkImage>& rawImage, const std::string& src, const SizeF& resizeTarget, bool forceResize)
+{
+    if (!resizeTarget.IsPositive()) {
+        LOGE("not valid size! resizeTarget: %{public}s, src: %{public}s", resizeTarget.ToString().c_str(), src.c_str());
+        return rawImage;
+    }
+    int32_t dstWidth = static_cast<int32_t>(resizeTarget.Width() + 0.5);
+    int32_t dstHeight = static_cast<int32_t>(resizeTarget.Height() + 0.5);
+
+    bool needResize = false;
+
+    if (!forceResize) {
+        if (rawImage->width() > dstWidth) {
+            needResize = true;
+        } else {
+            dstWidth = rawImage->width();
+        }
+        if (rawImage->height() > dstHeight) {
+            needResize = true;
+        } else {
+            dstHeight = rawImage->height();
+        }
+    }
+
+    if (!needResize && !forceResize) {
+        return rawImage;
+    }
+    auto srcKey = ImageObject::GenerateCacheKey(ImageSourceInfo(src), resizeTarget);
+    return ApplySizeToSkImage(DownsampleByHalves(rawImage, dstWidth, dstHeight, srcKey), dstWidth, dstHeight, srcKey);
+}
+
+sk_sp<SkImage> SkiaImageDecoder::DecodeToTargetSize(const sk_sp<SkData>& data, const SizeF& resizeTarget)
+{
+    if (!resizeTarget.IsPositive()) {
+        return nullptr;
+    }
+    auto codec = SkCodec::MakeFromData(data);
+    CHECK_NULL_RETURN(codec, nullptr);
+    // Orientation is applied by the full decode path.
+    if (codec->getOrigin() != SkEncodedOrigin::kTopLeft_SkEncodedOrigin) {
+        return nullptr;
+    }
+    auto fullSize = codec->dimensions();
+    float scale = std::max(resizeTarget.Width() / fullSize.width(), resizeTarget.Height() / fullSize.height());
+    if (scale >= 1.0f) {
+        return nullptr;
+    }
+    auto scaledSize = codec->getScaledDimensions(scale);
+    if (scaledSize == fullSize || scaledSize.width() < resizeTarget.Width() ||
+        scaledSize.height() < resizeTarget.Height()) {
+        return nullptr;
+    }
+    auto imageInfo = codec->getInfo().makeWH(scaledSize.width(), scaledSize.height()).makeColorType(kN32_SkColorType);
+    if (imageInfo.alphaType() == kUnpremul_SkAlphaType) {
+        imageInfo = imageInfo.makeAlphaType(kPremul_SkAlphaType);
+    }
+    SkBitmap bitmap;
+    if (!bitmap.tryAllocPixels(imageInfo)) {
+        LOGE("Could not allocate bitmap to decode at [%{public}d x %{public}d]", scaledSize.width(),
+            scaledSize.height());
+        return nullptr;
+    }
+    auto result = codec->getPixels(bitmap.pixmap());
+    if (result != SkCodec::kSuccess && result != SkCodec::kIncompleteInput) {
+        LOGW("Could not decode at [%{public}d x %{public}d], result: %{public}d", scaledSize.width(),
+            scaledSize.height(), static_cast<int32_t>(result));
+        return nullptr;
+    }
+    bitmap.setImmutable();
+    return SkImage::MakeFromBitmap(bitmap);
+}
+
+} // namespace OHOS::Ace::NG
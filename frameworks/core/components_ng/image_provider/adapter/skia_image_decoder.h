@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_ADAPTER_SKIA_IMAGE_DECODER_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_ADAPTER_SKIA_IMAGE_DECODER_H
+
+#include <string>
+
+#include "third_party/skia/include/core/SkData.h"
+#include "third_party/skia/include/core/SkImage.h"
+
+#include "base/geometry/ng/size_t.h"
+
+namespace OHOS::Ace::NG {
+
+// Decodes and resizes static images to the size they are shown at, used on the background threads of image loading.
+class SkiaImageDecoder {
+public:
+    // Decode with the smallest size supported by the codec which still covers the resize target, JPEG is decoded at
+    // n/8 scales and WebP at any scale, so big photos shown as thumbnails are not decoded at full resolution. Returns
+    // nullptr if the codec can not decode a smaller size, then the image is decoded at full size.
+    static sk_sp<SkImage> DecodeToTargetSize(const sk_sp<SkData>& data, const SizeF& resizeTarget);
+
+    // Scale the image down to the resize target, or to the target when forceResize is true.
+    static sk_sp<SkImage> ResizeImage(
+        const sk_sp<SkImage>& rawImage, const std::string& src, const SizeF& resizeTarget, bool forceResize);
+
+private:
+    static sk_sp<SkImage> ApplySizeToSkImage(
+        const sk_sp<SkImage>& rawImage, int32_t dstWidth, int32_t dstHeight, const std::string& srcKey);
+    static sk_sp<SkImage> DownsampleByHalves(
+        const sk_sp<SkImage>& rawImage, int32_t dstWidth, int32_t dstHeight, const std::string& srcKey);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_ADAPTER_SKIA_IMAGE_DECODER_H
@@ -18,6 +18,7 @@
 #include "core/common/container.h"
 #include "core/common/container_scope.h"
 #include "core/components_ng/image_provider/image_object.h"
+#include "core/image/image_cache.h"
 #include "core/image/image_loader.h"
 
 namespace OHOS::Ace::NG {
@@ -47,6 +48,26 @@ WRAP_TASK_AND_POST_TO(UI, UI);
 WRAP_TASK_AND_POST_TO(BACKGROUND, Background);
 WRAP_TASK_AND_POST_TO(IO, IO);
 
+RefPtr<CanvasImage> ImageProvider::GetCanvasImageFromCache(const std::string& key)
+{
+    auto pipelineCtx = PipelineContext::GetCurrentContext();
+    CHECK_NULL_RETURN(pipelineCtx, nullptr);
+    auto imageCache = pipelineCtx->GetImageCache();
+    CHECK_NULL_RETURN(imageCache, nullptr);
+    return AceType::DynamicCast<CanvasImage>(imageCache->GetCacheCanvasImage(key));
+}
+
+void ImageProvider::CacheCanvasImage(const std::string& key, const RefPtr<CanvasImage>& canvasImage)
+{
+    auto pipelineCtx = PipelineContext::GetCurrentContext();
+    CHECK_NULL_VOID(pipelineCtx);
+    auto imageCache = pipelineCtx->GetImageCache();
+    CHECK_NULL_VOID(imageCache);
+    CHECK_NULL_VOID(canvasImage);
+    imageCache->CacheCanvasImage(
+        key, canvasImage, ImageCache::GetPixelsSize(canvasImage->GetWidth(), canvasImage->GetHeight()));
+}
+
 void ImageProvider::CreateImageObject(const ImageSourceInfo& sourceInfo, const LoadCallbacks& loadCallbacks)
 {
     auto createImageObjectTask = [sourceInfo, loadCallbacks] {
@@ -111,6 +111,10 @@ public:
     static void UploadImageToGPUForRender(const RefPtr<CanvasImage>& canvasImage,
         std::function<void(RefPtr<CanvasImage>)>&& callback, const RefPtr<RenderTaskHolder>& renderTaskHolder);
 
+    // Decoded images are shared through the image cache of current pipeline.
+    static RefPtr<CanvasImage> GetCanvasImageFromCache(const std::string& key);
+    static void CacheCanvasImage(const std::string& key, const RefPtr<CanvasImage>& canvasImage);
+
 protected:
     static void WrapTaskAndPostTo(
         std::function<void()>&& task, TaskExecutor::TaskType taskType, const char* taskTypeName);
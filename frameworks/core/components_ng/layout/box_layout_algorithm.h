@@ -32,6 +32,11 @@ public:
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
+    TaskThread CanRunOnWhichThread() override
+    {
+        return BACKGROUND_TASK;
+    }
+
     // Called to perform measure current render node.
     static void PerformMeasureSelf(LayoutWrapper* layoutWrapper);
 
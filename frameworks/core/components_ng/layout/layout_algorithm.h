@@ -73,8 +73,9 @@ protected:
 
 class ACE_EXPORT LayoutAlgorithmWrapper : public LayoutAlgorithm {
     DECLARE_ACE_TYPE(LayoutAlgorithmWrapper, LayoutAlgorithm);
-
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     explicit LayoutAlgorithmWrapper(
         const RefPtr<LayoutAlgorithm>& layoutAlgorithmT, bool skipMeasure = false, bool skipLayout = false)
         : layoutAlgorithm_(layoutAlgorithmT), skipMeasure_(skipMeasure), skipLayout_(skipLayout)
@@ -133,6 +134,14 @@ public:
         return skipLayout_;
     }
 
+    TaskThread CanRunOnWhichThread() override
+    {
+        if (!layoutAlgorithm_) {
+            return BACKGROUND_TASK;
+        }
+        return layoutAlgorithm_->CanRunOnWhichThread();
+    }
+
     const RefPtr<LayoutAlgorithm>& GetLayoutAlgorithm() const
     {
         return layoutAlgorithm_;
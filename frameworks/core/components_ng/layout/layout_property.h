@@ -36,8 +36,9 @@
 namespace OHOS::Ace::NG {
 class ACE_EXPORT LayoutProperty : public Property {
     DECLARE_ACE_TYPE(LayoutProperty, Property);
-
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     LayoutProperty() = default;
 
     ~LayoutProperty() override = default;
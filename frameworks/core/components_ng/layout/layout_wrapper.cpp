@@ -204,6 +204,33 @@ bool LayoutWrapper::SkipMeasureContent() const
     return isContraintNoChanged_;
 }
 
+bool LayoutWrapper::CanReuseLastMeasure(const LayoutConstraintF& parentConstraint) const
+{
+    if (!layoutProperty_ || !geometryNode_ || layoutWrapperBuilder_) {
+        return false;
+    }
+    auto flag = layoutProperty_->GetPropertyChangeFlag();
+    if (CheckMeasureFlag(flag) || CheckLayoutFlag(flag) || CheckPositionFlag(flag)) {
+        return false;
+    }
+    if (geometryNode_->GetParentLayoutConstraint() != parentConstraint) {
+        return false;
+    }
+    auto host = GetHostNode();
+    CHECK_NULL_RETURN(host, false);
+    // inactive node need to measure again when it is added back to the render tree.
+    return host->IsActive() && !host->IsNeedSyncRenderTree();
+}
+
+void LayoutWrapper::SkipMeasureAndLayout()
+{
+    layoutAlgorithm_ = MakeRefPtr<LayoutAlgorithmWrapper>(nullptr, true, true);
+    children_.clear();
+    pendingRender_.clear();
+    layoutWrapperBuilder_.Reset();
+    currentChildCount_ = 0;
+}
+
 std::list<RefPtr<FrameNode>> LayoutWrapper::GetChildrenInRenderArea() const
 {
     std::list<RefPtr<FrameNode>> frameNodes;
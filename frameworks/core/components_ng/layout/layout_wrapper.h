@@ -44,6 +44,9 @@ class FrameNode;
 class LayoutWrapper : public AceType {
     DECLARE_ACE_TYPE(LayoutWrapper, AceType)
 public:
+    // Layout wrappers are created for every layout task.
+    DECLARE_POOLED_ALLOCATION();
+
     LayoutWrapper(WeakPtr<FrameNode> hostNode, RefPtr<GeometryNode> geometryNode, RefPtr<LayoutProperty> layoutProperty)
         : hostNode_(std::move(hostNode)), geometryNode_(std::move(geometryNode)),
           layoutProperty_(std::move(layoutProperty))
@@ -69,6 +72,14 @@ public:
         layoutWrapperBuilder_ = builder;
     }
 
+    // Set the count of lazy items kept in cache out of render area, used by scrollable containers.
+    void SetCacheCount(int32_t cacheCount)
+    {
+        if (layoutWrapperBuilder_) {
+            layoutWrapperBuilder_->SetCacheCount(cacheCount);
+        }
+    }
+
     void SetLayoutAlgorithm(const RefPtr<LayoutAlgorithmWrapper>& layoutAlgorithm)
     {
         layoutAlgorithm_ = layoutAlgorithm;
@@ -150,6 +161,14 @@ public:
 
     bool SkipMeasureContent() const;
 
+    // Whether the size measured in the last frame is still valid under the parent constraint, which means the host and
+    // its children are not changed since the last measure.
+    bool CanReuseLastMeasure(const LayoutConstraintF& parentConstraint) const;
+
+    // Reuse the last layout result of the host, the wrapper and its children will skip measure and layout. The parent
+    // can still update the frame offset of the wrapper.
+    void SkipMeasureAndLayout();
+
     bool IsContraintNoChanged() const
     {
         return isContraintNoChanged_;
@@ -173,8 +192,10 @@ public:
 private:
     // Used to save a persist wrapper created by child, ifElse, ForEach, the map stores [index, Wrapper].
     // The Wrapper Created by LazyForEach stores in the LayoutWrapperBuilder object.
-    std::map<int32_t, RefPtr<LayoutWrapper>> children_;
-    std::map<int32_t, RefPtr<LayoutWrapper>> pendingRender_;
+    using LayoutWrapperMap = std::map<int32_t, RefPtr<LayoutWrapper>, std::less<>,
+        PoolAllocator<std::pair<const int32_t, RefPtr<LayoutWrapper>>>>;
+    LayoutWrapperMap children_;
+    LayoutWrapperMap pendingRender_;
     WeakPtr<FrameNode> hostNode_;
     RefPtr<GeometryNode> geometryNode_;
     RefPtr<LayoutProperty> layoutProperty_;
@@ -50,6 +50,17 @@ public:
         return startIndex_;
     }
 
+    // Count of items kept in cache before and after the items in render area.
+    void SetCacheCount(int32_t cacheCount)
+    {
+        cacheCount_ = cacheCount;
+    }
+
+    int32_t GetCacheCount() const
+    {
+        return cacheCount_;
+    }
+
     void AddCachedItem(int32_t index, const RefPtr<LayoutWrapper>& wrapper)
     {
         auto result = buildItems_.try_emplace(index, wrapper);
@@ -68,6 +79,7 @@ protected:
 
     std::map<int32_t, RefPtr<LayoutWrapper>> buildItems_;
     int32_t startIndex_ = 0;
+    int32_t cacheCount_ = 0;
 };
 
 } // namespace OHOS::Ace::NG
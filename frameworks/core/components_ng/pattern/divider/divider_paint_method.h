@@ -42,6 +42,11 @@ public:
         return [dividerPainter, offset](RSCanvas& canvas) { dividerPainter.DrawLine(canvas, offset); };
     }
 
+    TaskThread CanRunOnWhichThread() override
+    {
+        return BACKGROUND_TASK;
+    }
+
 private:
     float constrainStrokeWidth_;
     float dividerLength_;
@@ -36,6 +36,11 @@ public:
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
+    TaskThread CanRunOnWhichThread() override
+    {
+        return BACKGROUND_TASK;
+    }
+
 private:
     friend class LinearLayoutUtils;
 };
@@ -33,6 +33,8 @@ namespace OHOS::Ace::NG {
 namespace {
 
 constexpr float CACHE_SIZE_RADIO = 0.1;
+constexpr size_t MAX_ITEM_EXTENT_CACHE_SIZE = 1024;
+constexpr int32_t DEFAULT_CACHED_COUNT = 1;
 
 void UpdateListItemConstraint(Axis axis, const SizeF& selfIdealSize, LayoutConstraintF& contentConstraint)
 {
@@ -102,6 +104,7 @@ void ListLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
     UpdateListItemConstraint(axis, idealSize, contentLayoutConstraint);
 
     itemPosition_.clear();
+    layoutWrapper->SetCacheCount(listLayoutProperty->GetCachedCount().value_or(DEFAULT_CACHED_COUNT));
 
     lanes_ = listLayoutProperty->GetLanes();
     if (listLayoutProperty->GetLaneMinLength().has_value()) {
@@ -137,6 +140,67 @@ void ListLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
     if ((preStartIndex_ != startIndex_.value()) || (preEndIndex_ != endIndex_.value())) {
         layoutWrapper->SetForceSyncRenderTree();
     }
+    TrimItemExtentCache();
+}
+
+float ListLayoutAlgorithm::MeasureListItem(
+    const RefPtr<LayoutWrapper>& wrapper, int32_t index, const LayoutConstraintF& layoutConstraint, Axis axis)
+{
+    auto host = wrapper->GetHostNode();
+    auto nodeId = host ? host->GetId() : -1;
+    auto propertyVersion = host ? host->GetLayoutProperty()->GetVersion() : 0;
+    auto iter = itemExtentCache_.find(index);
+    if ((iter != itemExtentCache_.end()) && (iter->second.nodeId == nodeId) &&
+        (iter->second.propertyVersion == propertyVersion) && (iter->second.layoutConstraint == layoutConstraint) &&
+        wrapper->CanReuseLastMeasure(layoutConstraint)) {
+        auto mainSize = GetMainAxisSize(wrapper->GetGeometryNode()->GetFrameSize(), axis);
+        if (NearEqual(mainSize, iter->second.mainSize)) {
+            // only the position of item is changed, such as scrolling, skip measuring the item.
+            wrapper->SkipMeasureAndLayout();
+            return mainSize;
+        }
+    }
+    {
+        ACE_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem");
+        wrapper->Measure(layoutConstraint);
+    }
+    auto mainSize = GetMainAxisSize(wrapper->GetGeometryNode()->GetFrameSize(), axis);
+    itemExtentCache_[index] = { nodeId, mainSize, layoutConstraint, propertyVersion };
+    return mainSize;
+}
+
+std::optional<float> ListLayoutAlgorithm::GetCachedItemMainSize(
+    int32_t index, const LayoutConstraintF& layoutConstraint)
+{
+    auto iter = itemExtentCache_.find(index);
+    if (iter == itemExtentCache_.end()) {
+        return std::nullopt;
+    }
+    // such as rotation or resize of list, the item need to be measured again. The property version of item is checked
+    // when the item is created, changes of items which are not created mark the list dirty and drop the whole cache.
+    if (iter->second.layoutConstraint != layoutConstraint) {
+        itemExtentCache_.erase(iter);
+        return std::nullopt;
+    }
+    return iter->second.mainSize;
+}
+
+void ListLayoutAlgorithm::TrimItemExtentCache()
+{
+    if (itemExtentCache_.size() <= MAX_ITEM_EXTENT_CACHE_SIZE) {
+        return;
+    }
+    // keep the items around the display area.
+    auto radius = static_cast<int32_t>(MAX_ITEM_EXTENT_CACHE_SIZE / 2);
+    auto startIndex = startIndex_.value_or(preStartIndex_) - radius;
+    auto endIndex = endIndex_.value_or(preEndIndex_) + radius;
+    for (auto iter = itemExtentCache_.begin(); iter != itemExtentCache_.end();) {
+        if ((iter->first < startIndex) || (iter->first > endIndex)) {
+            iter = itemExtentCache_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
 }
 
 void ListLayoutAlgorithm::LayoutForward(
@@ -154,23 +218,33 @@ void ListLayoutAlgorithm::LayoutForward(
     float currentStartPos = currentEndPos;
     auto currentIndex = preStartIndex_ - 1;
     float cacheSize = mainSize * CACHE_SIZE_RADIO;
+    // items which are out of display area and not created in this layout.
+    std::unordered_set<int32_t> skippedItems;
     do {
-        auto wrapper = layoutWrapper->GetOrCreateChildByIndex(currentIndex + 1);
-        if (!wrapper) {
-            LOGI("the start %{public}d index wrapper is null", currentIndex + 1);
-            break;
+        float mainLength = 0.0f;
+        auto cachedMainSize = GetCachedItemMainSize(currentIndex + 1, layoutConstraint);
+        if (cachedMainSize && (currentIndex + 1 != preStartIndex_) &&
+            (currentIndex + 1 < layoutWrapper->GetTotalChildCount()) &&
+            LessNotEqual(currentEndPos + cachedMainSize.value(), startMainPos_ - cacheSize)) {
+            ++currentIndex;
+            mainLength = cachedMainSize.value();
+            skippedItems.emplace(currentIndex);
+        } else {
+            auto wrapper = layoutWrapper->GetOrCreateChildByIndex(currentIndex + 1);
+            if (!wrapper) {
+                LOGI("the start %{public}d index wrapper is null", currentIndex + 1);
+                break;
+            }
+            ++currentIndex;
+            mainLength = MeasureListItem(wrapper, currentIndex, layoutConstraint, axis);
         }
-        ++currentIndex;
         currentStartPos = currentEndPos;
-        {
-            ACE_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem");
-            wrapper->Measure(layoutConstraint);
-        }
-        auto mainLength = GetMainAxisSize(wrapper->GetGeometryNode()->GetFrameSize(), axis);
         currentEndPos = currentStartPos + mainLength;
         // out of display area, mark inactive.
         if (LessNotEqual(currentEndPos, startMainPos_ - cacheSize)) {
-            inActiveItems.emplace(currentIndex);
+            if (skippedItems.find(currentIndex) == skippedItems.end()) {
+                inActiveItems.emplace(currentIndex);
+            }
         } else {
             // mark new start index.
             if (!newStartIndex) {
@@ -208,6 +282,12 @@ void ListLayoutAlgorithm::LayoutForward(
                 --startIndex;
                 currentStartPos = item->second.first;
                 inActiveItems.erase(startIndex);
+                if (skippedItems.erase(startIndex) > 0) {
+                    auto wrapper = layoutWrapper->GetOrCreateChildByIndex(startIndex);
+                    if (wrapper) {
+                        MeasureListItem(wrapper, startIndex, layoutConstraint, axis);
+                    }
+                }
             }
             startIndex_ = startIndex;
         }
@@ -234,25 +314,34 @@ void ListLayoutAlgorithm::LayoutBackward(
     float currentEndPos = currentStartPos;
     auto currentIndex = preEndIndex_ + 1;
     float cacheSize = mainSize * CACHE_SIZE_RADIO;
+    // items which are out of display area and not created in this layout.
+    std::unordered_set<int32_t> skippedItems;
     do {
-        auto wrapper = layoutWrapper->GetOrCreateChildByIndex(currentIndex - 1);
-        if (!wrapper) {
-            LOGI("the %{public}d wrapper is null", currentIndex - 1);
-            break;
+        float mainLength = 0.0f;
+        auto cachedMainSize = GetCachedItemMainSize(currentIndex - 1, layoutConstraint);
+        if (cachedMainSize && (currentIndex - 1 != preEndIndex_) && (currentIndex - 1 >= 0) &&
+            GreatNotEqual(currentStartPos - cachedMainSize.value(), endMainPos_ + cacheSize)) {
+            --currentIndex;
+            mainLength = cachedMainSize.value();
+            skippedItems.emplace(currentIndex);
+        } else {
+            auto wrapper = layoutWrapper->GetOrCreateChildByIndex(currentIndex - 1);
+            if (!wrapper) {
+                LOGI("the %{public}d wrapper is null", currentIndex - 1);
+                break;
+            }
+            --currentIndex;
+            mainLength = MeasureListItem(wrapper, currentIndex, layoutConstraint, axis);
         }
-        --currentIndex;
         // the current item end pos is the prev item start pos in backward.
         currentEndPos = currentStartPos;
-        {
-            ACE_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem");
-            wrapper->Measure(layoutConstraint);
-        }
-        auto mainLength = GetMainAxisSize(wrapper->GetGeometryNode()->GetFrameSize(), axis);
         currentStartPos = currentEndPos - mainLength;
 
         // out of display area, mark inactive.
         if (GreatNotEqual(currentStartPos, endMainPos_ + cacheSize)) {
-            inActiveItems.emplace(currentIndex);
+            if (skippedItems.find(currentIndex) == skippedItems.end()) {
+                inActiveItems.emplace(currentIndex);
+            }
         } else {
             // mark new end index.
             if (!newEndIndex) {
@@ -284,6 +373,12 @@ void ListLayoutAlgorithm::LayoutBackward(
             ++endIndex;
             currentEndPos = item->second.second;
             inActiveItems.erase(endIndex);
+            if (skippedItems.erase(endIndex) > 0) {
+                auto wrapper = layoutWrapper->GetOrCreateChildByIndex(endIndex);
+                if (wrapper) {
+                    MeasureListItem(wrapper, endIndex, layoutConstraint, axis);
+                }
+            }
         }
         endIndex_ = endIndex;
     }
@@ -339,6 +434,7 @@ void ListLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper)
             }
         }
         wrapper->GetGeometryNode()->SetFrameOffset(offset);
+        wrapper->GetGeometryNode()->SetParentGlobalOffset(parentOffset);
         wrapper->Layout(parentOffset);
     }
 }
@@ -474,11 +570,7 @@ void ListLayoutAlgorithm::LayoutForwardForLaneList(
                 break;
             }
             ++currentIndex;
-            {
-                ACE_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem");
-                wrapper->Measure(layoutConstraint);
-            }
-            mainLength = GetMainAxisSize(wrapper->GetGeometryNode()->GetFrameSize(), axis);
+            mainLength = MeasureListItem(wrapper, currentIndex, layoutConstraint, axis);
             // out of display area, mark inactive.
             if (LessNotEqual(currentStartPos + mainLength, startMainPos_ - cacheSize)) {
                 inActiveItems.emplace(currentIndex);
@@ -556,11 +648,7 @@ void ListLayoutAlgorithm::LayoutBackwardForLaneList(
                 break;
             }
             --currentIndex;
-            {
-                ACE_SCOPED_TRACE("ListLayoutAlgorithm::MeasureListItem");
-                wrapper->Measure(layoutConstraint);
-            }
-            mainLength = GetMainAxisSize(wrapper->GetGeometryNode()->GetFrameSize(), axis);
+            mainLength = MeasureListItem(wrapper, currentIndex, layoutConstraint, axis);
             // out of display area, mark inactive.
             if (LessNotEqual(currentEndPos - mainLength, startMainPos_ + cacheSize)) {
                 inActiveItems.emplace(currentIndex);
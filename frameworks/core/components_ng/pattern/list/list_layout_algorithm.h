@@ -17,6 +17,7 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_LIST_LIST_LAYOUT_ALGORITHM_H
 
 #include <map>
+#include <unordered_map>
 
 #include "base/geometry/axis.h"
 #include "base/memory/referenced.h"
@@ -34,6 +35,18 @@ class ACE_EXPORT ListLayoutAlgorithm : public LayoutAlgorithm {
 public:
     using PositionMap = std::map<int32_t, std::pair<float, float>>;
 
+    struct ItemExtent {
+        int32_t nodeId = -1;
+        float mainSize = 0.0f;
+        // The constraint the item is measured with and the version of its layout property at that time, the extent is
+        // stale once either of them is changed.
+        LayoutConstraintF layoutConstraint;
+        uint32_t propertyVersion = 0;
+    };
+    // Main axis size of the measured items, keyed by item index. The cache is kept by ListPattern between frames and
+    // dropped once the layout properties of list or items are changed.
+    using ItemExtentCache = std::unordered_map<int32_t, ItemExtent>;
+
     ListLayoutAlgorithm(int32_t startIndex, int32_t endIndex) : preStartIndex_(startIndex), preEndIndex_(endIndex) {}
 
     ~ListLayoutAlgorithm() override = default;
@@ -95,6 +108,16 @@ public:
         return lanes_;
     }
 
+    void SetItemExtentCache(ItemExtentCache&& itemExtentCache)
+    {
+        itemExtentCache_ = std::move(itemExtentCache);
+    }
+
+    ItemExtentCache MoveItemExtentCache()
+    {
+        return std::move(itemExtentCache_);
+    }
+
     void Measure(LayoutWrapper* layoutWrapper) override;
 
     void Layout(LayoutWrapper* layoutWrapper) override;
@@ -109,6 +132,14 @@ public:
     void LayoutBackwardForLaneList(
         LayoutWrapper* layoutWrapper, const LayoutConstraintF& layoutConstraint, Axis axis, float mainSize);
 private:
+    // Measure the item or reuse its last measure result, returns the main axis size of the item.
+    float MeasureListItem(
+        const RefPtr<LayoutWrapper>& wrapper, int32_t index, const LayoutConstraintF& layoutConstraint, Axis axis);
+    // Returns the cached main axis size of the item, which can be used without creating the item. The entry is dropped
+    // if the item is measured with another constraint.
+    std::optional<float> GetCachedItemMainSize(int32_t index, const LayoutConstraintF& layoutConstraint);
+    void TrimItemExtentCache();
+
     std::pair<int32_t, float> LayoutOrRecycleCachedItems(
         LayoutWrapper* layoutWrapper, const LayoutConstraintF& layoutConstraint, Axis axis);
 
@@ -123,6 +154,7 @@ private:
     float CalculateLaneCrossOffset(float crossSize, float childCrossSize);
 
     PositionMap itemPosition_;
+    ItemExtentCache itemExtentCache_;
     float currentOffset_ = 0.0f;
     float startMainPos_ = 0.0f;
     float endMainPos_ = 0.0f;
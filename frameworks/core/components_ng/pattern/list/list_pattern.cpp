@@ -59,6 +59,24 @@ void ListPattern::OnModifyDone()
     gestureHub->AddScrollableEvent(scrollableEvent_);
 }
 
+RefPtr<LayoutAlgorithm> ListPattern::CreateLayoutAlgorithm()
+{
+    auto listLayoutAlgorithm = MakeRefPtr<ListLayoutAlgorithm>(startIndex_, endIndex_);
+    listLayoutAlgorithm->SetCurrentOffset(currentOffset_);
+    currentOffset_ = 0;
+    listLayoutAlgorithm->SetIsInitialized(isInitialized_);
+    // the item extents are still valid if the list is only scrolled.
+    auto host = GetHost();
+    if (host) {
+        auto flag = host->GetLayoutProperty()->GetPropertyChangeFlag();
+        if (((flag & PROPERTY_UPDATE_MEASURE) == PROPERTY_UPDATE_MEASURE) || CheckUpdateByChildRequest(flag)) {
+            itemExtentCache_.clear();
+        }
+    }
+    listLayoutAlgorithm->SetItemExtentCache(std::move(itemExtentCache_));
+    return listLayoutAlgorithm;
+}
+
 bool ListPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dirty, bool skipMeasure, bool skipLayout)
 {
     if (skipMeasure && skipLayout) {
@@ -72,6 +90,7 @@ bool ListPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& dirty, b
     endIndex_ = listLayoutAlgorithm->GetEndIndex();
     isInitialized_ = listLayoutAlgorithm->GetIsInitialized();
     itemPosition_ = listLayoutAlgorithm->GetItemPosition();
+    itemExtentCache_ = listLayoutAlgorithm->MoveItemExtentCache();
     auto host = GetHost();
     if (host == nullptr) {
         return false;
@@ -52,14 +52,7 @@ public:
         return MakeRefPtr<ListLayoutProperty>();
     }
 
-    RefPtr<LayoutAlgorithm> CreateLayoutAlgorithm() override
-    {
-        auto listLayoutAlgorithm = MakeRefPtr<ListLayoutAlgorithm>(startIndex_, endIndex_);
-        listLayoutAlgorithm->SetCurrentOffset(currentOffset_);
-        currentOffset_ = 0;
-        listLayoutAlgorithm->SetIsInitialized(isInitialized_);
-        return listLayoutAlgorithm;
-    }
+    RefPtr<LayoutAlgorithm> CreateLayoutAlgorithm() override;
 
     void UpdateCurrentOffset(float offset);
 
@@ -75,6 +68,7 @@ private:
     float currentOffset_ = 0.0;
 
     ListLayoutAlgorithm::PositionMap itemPosition_;
+    ListLayoutAlgorithm::ItemExtentCache itemExtentCache_;
 };
 } // namespace OHOS::Ace::NG
 
@@ -44,6 +44,11 @@ public:
                    RSCanvas& canvas) { paragraph->Paint(&canvas, paintOffset.GetX(), paintOffset.GetY()); };
     }
 
+    TaskThread CanRunOnWhichThread() override
+    {
+        return BACKGROUND_TASK;
+    }
+
 private:
     std::shared_ptr<RSParagraph> paragraph_;
     float baselineOffset_;
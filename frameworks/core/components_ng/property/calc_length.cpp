@@ -36,9 +36,9 @@ bool CalcLength::NormalizeToPx(
     double vpScale, double fpScale, double lpxScale, double parentLength, double& result) const
 {
     // don't use this function for calc.
-    if (!calcValue_.empty()) {
+    if (calcProgram_) {
         result = StringExpression::CalculateExp(
-            calcValue_, [vpScale, fpScale, lpxScale, parentLength](const Dimension& dim) -> double {
+            *calcProgram_, [vpScale, fpScale, lpxScale, parentLength](const Dimension& dim) -> double {
                 double result = -1.0;
                 dim.NormalizeToPx(vpScale, fpScale, lpxScale, parentLength, result);
                 return result;
@@ -16,8 +16,11 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_COMPONENTS_NG_PROPERTIES_CALC_LENGTH_H
 #define FOUNDATION_ACE_FRAMEWORKS_COMPONENTS_NG_PROPERTIES_CALC_LENGTH_H
 
+#include <memory>
+
 #include "base/geometry/dimension.h"
 #include "base/geometry/ng/size_t.h"
+#include "base/utils/string_expression.h"
 #include "base/utils/utils.h"
 
 namespace OHOS::Ace::NG {
@@ -50,7 +53,10 @@ struct ScaleProperty {
 class CalcLength {
 public:
     CalcLength() = default;
-    explicit CalcLength(const std::string& value) : calcValue_(value) {}
+    explicit CalcLength(const std::string& value)
+    {
+        SetCalcValue(value);
+    }
     ~CalcLength() = default;
 
     explicit CalcLength(double value, DimensionUnit unit = DimensionUnit::PX) : dimension_(value, unit) {};
@@ -59,6 +65,7 @@ public:
     void Reset()
     {
         calcValue_ = "";
+        calcProgram_.reset();
         dimension_.Reset();
     }
 
@@ -70,6 +77,9 @@ public:
     void SetCalcValue(const std::string& value)
     {
         calcValue_ = value;
+        calcProgram_ = value.empty()
+                           ? nullptr
+                           : std::make_shared<const StringExpression::CalcProgram>(StringExpression::CompileExp(value));
     }
 
     bool NormalizeToPx(double vpScale, double fpScale, double lpxScale, double parentLength, double& result) const;
@@ -105,6 +115,8 @@ public:
 
 private:
     std::string calcValue_;
+    // Compiled from calcValue_ and shared by copies, so measure does not parse the expression.
+    std::shared_ptr<const StringExpression::CalcProgram> calcProgram_;
     Dimension dimension_;
 };
 } // namespace OHOS::Ace::NG
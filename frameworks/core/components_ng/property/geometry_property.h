@@ -17,10 +17,13 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PROPERTIES_GEOMETRY_PROPERTY_H
 
 #include "base/geometry/ng/rect_t.h"
+#include "base/memory/fixed_block_pool.h"
 
 namespace OHOS::Ace::NG {
 class GeometryProperty {
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     GeometryProperty() = default;
     ~GeometryProperty() = default;
 
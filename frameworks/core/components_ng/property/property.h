@@ -280,9 +280,18 @@ public:
 
     void CleanDirty()
     {
+        if (propertyChangeFlag_ != PROPERTY_UPDATE_NORMAL) {
+            ++version_;
+        }
         propertyChangeFlag_ = PROPERTY_UPDATE_NORMAL;
     }
 
+    // Increased every time the changes of property are taken by a flush, used to check cached layout results.
+    uint32_t GetVersion() const
+    {
+        return version_;
+    }
+
     void UpdatePropertyChangeFlag(PropertyChangeFlag propertyChangeFlag)
     {
         propertyChangeFlag_ = propertyChangeFlag_ | propertyChangeFlag;
@@ -291,6 +300,9 @@ public:
 protected:
     PropertyChangeFlag propertyChangeFlag_ = PROPERTY_UPDATE_NORMAL;
 
+private:
+    uint32_t version_ = 0;
+
     ACE_DISALLOW_COPY_AND_MOVE(Property);
 };
 } // namespace OHOS::Ace::NG
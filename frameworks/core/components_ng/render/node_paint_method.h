@@ -44,6 +44,12 @@ public:
     {
         return nullptr;
     }
+
+    // Return BACKGROUND_TASK if the draw functions can be created off the main thread.
+    virtual TaskThread CanRunOnWhichThread()
+    {
+        return MAIN_TASK;
+    }
 };
 } // namespace OHOS::Ace::NG
 
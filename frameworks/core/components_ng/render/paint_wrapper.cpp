@@ -32,9 +32,27 @@ PaintWrapper::~PaintWrapper() = default;
 void PaintWrapper::SetNodePaintMethod(const RefPtr<NodePaintMethod>& nodePaintImpl)
 {
     nodePaintImpl_ = nodePaintImpl;
+    CHECK_NULL_VOID(nodePaintImpl_);
+    taskThread_ = nodePaintImpl_->CanRunOnWhichThread();
 }
 
 void PaintWrapper::FlushRender()
+{
+    PrepareRender();
+    CommitRender();
+}
+
+void PaintWrapper::PrepareRender()
+{
+    CHECK_NULL_VOID(nodePaintImpl_);
+
+    // only build the draw functions here, render nodes are not thread safe and are recorded in CommitRender.
+    contentDraw_ = nodePaintImpl_->GetContentDrawFunction(this);
+    foregroundDraw_ = nodePaintImpl_->GetForegroundDrawFunction(this);
+    overlayDraw_ = nodePaintImpl_->GetOverlayDrawFunction(this);
+}
+
+void PaintWrapper::CommitRender()
 {
     CHECK_NULL_VOID(nodePaintImpl_);
 
@@ -44,21 +62,18 @@ void PaintWrapper::FlushRender()
     renderContext->StartRecording();
 
     // first set content paint function.
-    auto contentDraw = nodePaintImpl_->GetContentDrawFunction(this);
-    if (contentDraw) {
-        renderContext->FlushContentDrawFunction(std::move(contentDraw));
+    if (contentDraw_) {
+        renderContext->FlushContentDrawFunction(std::move(contentDraw_));
     }
 
     // then set foreground paint function.
-    auto foregroundDraw = nodePaintImpl_->GetForegroundDrawFunction(this);
-    if (foregroundDraw) {
-        renderContext->FlushForegroundDrawFunction(std::move(foregroundDraw));
+    if (foregroundDraw_) {
+        renderContext->FlushForegroundDrawFunction(std::move(foregroundDraw_));
     }
 
     // at last, set overlay paint function.
-    auto overlayDraw = nodePaintImpl_->GetOverlayDrawFunction(this);
-    if (overlayDraw) {
-        renderContext->FlushOverlayDrawFunction(std::move(overlayDraw));
+    if (overlayDraw_) {
+        renderContext->FlushOverlayDrawFunction(std::move(overlayDraw_));
     }
 
     renderContext->StopRecordingIfNeeded();
@@ -35,8 +35,9 @@ class NodePaintMethod;
 // PaintWrapper are used to flush dirty render task.
 class PaintWrapper : public virtual AceType {
     DECLARE_ACE_TYPE(PaintWrapper, AceType)
-
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     PaintWrapper(
         WeakPtr<RenderContext> renderContext, RefPtr<GeometryNode> geometryNode, RefPtr<PaintProperty> layoutProperty);
     ~PaintWrapper() override;
@@ -50,6 +51,13 @@ public:
 
     void FlushRender();
 
+    // Build the draw functions of paint method, can be called on background thread when the paint method allows. The
+    // render context is not touched.
+    void PrepareRender();
+
+    // Record the draw functions built by PrepareRender into the render context, must be called on main thread.
+    void CommitRender();
+
     TaskThread CanRunOnWhichThread() const
     {
         return taskThread_;
@@ -85,6 +93,10 @@ private:
     RefPtr<GeometryNode> geometryNode_;
     RefPtr<PaintProperty> paintProperty_;
     RefPtr<NodePaintMethod> nodePaintImpl_;
+    // built by PrepareRender and handed over to the render context in CommitRender.
+    CanvasDrawFunction contentDraw_;
+    CanvasDrawFunction foregroundDraw_;
+    CanvasDrawFunction overlayDraw_;
     TaskThread taskThread_ = MAIN_TASK;
 };
 } // namespace OHOS::Ace::NG
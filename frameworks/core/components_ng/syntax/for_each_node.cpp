@@ -91,6 +91,7 @@ void ForEachNode::CompareAndUpdateChildren()
             children_.emplace_back(iter->second);
         }
     }
+    MarkTouchTestIndexDirty();
     tempChildren_.clear();
     tempIds_.clear();
 }
@@ -45,6 +45,7 @@ public:
     {
         std::swap(ids_, tempIds_);
         std::swap(children_, tempChildren_);
+        MarkTouchTestIndexDirty();
     }
 
     void CompareAndUpdateChildren();
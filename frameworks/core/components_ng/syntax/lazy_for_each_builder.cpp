@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/syntax/lazy_for_each_builder.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "base/log/ace_trace.h"
+#include "base/utils/time_util.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+constexpr size_t MAX_DETACHED_ITEM_COUNT = 16;
+// Prefetch the items which will be shown in next frames at current scroll velocity.
+constexpr int32_t PREDICT_FRAME_COUNT = 3;
+constexpr int32_t MAX_PREDICT_COUNT = 16;
+constexpr int64_t TIME_THRESHOLD = 3 * 1000000; // 3 millisecond
+
+} // namespace
+
+RefPtr<UINode> LazyForEachBuilder::GetChildByIndex(int32_t index)
+{
+    auto iter = cachedItems_.find(index);
+    if (iter != cachedItems_.end()) {
+        return iter->second.second;
+    }
+    auto detachedItem = TakeDetachedItem(index);
+    if (detachedItem) {
+        return detachedItem;
+    }
+    {
+        ACE_SCOPED_TRACE("Builder:BuildLazyItem");
+        auto itemInfo = OnGetChildByIndex(index);
+        CHECK_NULL_RETURN(itemInfo.second, nullptr);
+        cachedItems_.emplace(index, itemInfo);
+        return itemInfo.second;
+    }
+}
+
+void LazyForEachBuilder::UpdateCacheWindow(int32_t start, int32_t end, int32_t cacheCount)
+{
+    // count of items scrolled in last frame, which is used to extend the window in scroll direction.
+    int32_t velocity = lastStartIndex_ ? start - lastStartIndex_.value() : 0;
+    lastStartIndex_ = start;
+    int32_t predictCount = std::min(std::abs(velocity) * PREDICT_FRAME_COUNT, MAX_PREDICT_COUNT);
+    cacheCount = std::max(cacheCount, 0);
+    int32_t windowStart = std::max(start - cacheCount - (velocity < 0 ? predictCount : 0), 0);
+    int32_t windowEnd = std::min(end + cacheCount + (velocity > 0 ? predictCount : 0), GetTotalCount() - 1);
+
+    for (auto iter = cachedItems_.begin(); iter != cachedItems_.end();) {
+        if ((iter->first < windowStart) || (iter->first > windowEnd)) {
+            auto item = std::move(iter->second);
+            iter = cachedItems_.erase(iter);
+            DetachItem(std::move(item));
+        } else {
+            ++iter;
+        }
+    }
+
+    prefetchItems_.clear();
+    auto addPrefetchItem = [this](int32_t index) {
+        if (cachedItems_.find(index) == cachedItems_.end()) {
+            prefetchItems_.emplace_back(index);
+        }
+    };
+    auto addForwardItems = [&addPrefetchItem, end, windowEnd]() {
+        for (int32_t index = end + 1; index <= windowEnd; ++index) {
+            addPrefetchItem(index);
+        }
+    };
+    auto addBackwardItems = [&addPrefetchItem, start, windowStart]() {
+        for (int32_t index = start - 1; index >= windowStart; --index) {
+            addPrefetchItem(index);
+        }
+    };
+    if (velocity >= 0) {
+        addForwardItems();
+        addBackwardItems();
+    } else {
+        addBackwardItems();
+        addForwardItems();
+    }
+    LOGD("cache window [%{public}d, %{public}d], cached: %{public}d, detached: %{public}d, prefetch: %{public}d",
+        windowStart, windowEnd, static_cast<int32_t>(cachedItems_.size()), static_cast<int32_t>(detachedItems_.size()),
+        static_cast<int32_t>(prefetchItems_.size()));
+}
+
+void LazyForEachBuilder::DetachAllItems()
+{
+    auto items = std::move(cachedItems_);
+    cachedItems_.clear();
+    for (auto& item : items) {
+        DetachItem(std::move(item.second));
+    }
+    prefetchItems_.clear();
+    lastStartIndex_.reset();
+}
+
+bool LazyForEachBuilder::PrefetchItems(int64_t deadline)
+{
+    auto totalCount = GetTotalCount();
+    while (!prefetchItems_.empty()) {
+        // Stop prefetching less than 3 milliseconds before the next vsync arrives.
+        if (GetSysTimestamp() + TIME_THRESHOLD > deadline) {
+            return false;
+        }
+        auto index = prefetchItems_.front();
+        prefetchItems_.pop_front();
+        if ((index < 0) || (index >= totalCount)) {
+            continue;
+        }
+        ACE_SCOPED_TRACE("Builder:PrefetchLazyItem %d", index);
+        GetChildByIndex(index);
+    }
+    return true;
+}
+
+void LazyForEachBuilder::DetachItem(std::pair<std::string, RefPtr<UINode>>&& item)
+{
+    if (item.first.empty()) {
+        return;
+    }
+    detachedItems_.emplace_front(std::move(item));
+    while (detachedItems_.size() > MAX_DETACHED_ITEM_COUNT) {
+        auto key = std::move(detachedItems_.back().first);
+        detachedItems_.pop_back();
+        ReleaseItem(key);
+    }
+}
+
+RefPtr<UINode> LazyForEachBuilder::TakeDetachedItem(int32_t index)
+{
+    if (detachedItems_.empty()) {
+        return nullptr;
+    }
+    auto key = OnGetKeyByIndex(index);
+    if (key.empty()) {
+        return nullptr;
+    }
+    auto iter = std::find_if(
+        detachedItems_.begin(), detachedItems_.end(), [&key](const auto& item) { return item.first == key; });
+    if (iter == detachedItems_.end()) {
+        return nullptr;
+    }
+    auto node = iter->second;
+    cachedItems_.emplace(index, std::move(*iter));
+    detachedItems_.erase(iter);
+    return node;
+}
+
+void LazyForEachBuilder::ReleaseItem(const std::string& key)
+{
+    // the views are shared by items with the same key.
+    for (const auto& [index, item] : cachedItems_) {
+        if (item.first == key) {
+            return;
+        }
+    }
+    for (const auto& item : detachedItems_) {
+        if (item.first == key) {
+            return;
+        }
+    }
+    ReleaseChildGroupById(key);
+}
+
+} // namespace OHOS::Ace::NG
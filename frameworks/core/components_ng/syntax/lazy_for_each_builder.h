@@ -16,7 +16,10 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_FOREACH_LAZY_FOR_EACH_BUILDER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_FOREACH_LAZY_FOR_EACH_BUILDER_H
 
+#include <list>
 #include <map>
+#include <optional>
+#include <string>
 
 #include "base/log/ace_trace.h"
 #include "core/components_ng/base/ui_node.h"
@@ -24,6 +27,13 @@
 
 namespace OHOS::Ace::NG {
 
+// LazyForEachBuilder builds the lazy items on demand and manages their lifecycle:
+// - items in the cache window around the render area are kept in cachedItems_,
+// - items moved out of the window are kept in a bounded cache of detached items, and attached again instead of being
+//   rebuilt if the item of the same key is requested. Items are not reused for other keys, as the item generators
+//   bind the data while building,
+// - items in the window which are not built yet are prefetched in idle time, the window is extended in scroll
+//   direction by the scroll velocity.
 class ACE_EXPORT LazyForEachBuilder : public virtual AceType, public V2::DataChangeListener {
     DECLARE_ACE_TYPE(NG::LazyForEachBuilder, AceType)
 public:
@@ -35,20 +45,7 @@ public:
         return OnGetTotalCount();
     }
 
-    RefPtr<UINode> GetChildByIndex(int32_t index)
-    {
-        auto iter = cachedItems_.find(index);
-        if (iter != cachedItems_.end()) {
-            return iter->second.second;
-        }
-        {
-            ACE_SCOPED_TRACE("Builder:BuildLazyItem");
-            auto itemInfo = OnGetChildByIndex(index);
-            CHECK_NULL_RETURN(itemInfo.second, nullptr);
-            cachedItems_.emplace(index, itemInfo);
-            return itemInfo.second;
-        }
-    }
+    RefPtr<UINode> GetChildByIndex(int32_t index);
 
     const std::map<int32_t, std::pair<std::string, RefPtr<UINode>>>& GetCacheItems() const
     {
@@ -60,6 +57,20 @@ public:
         return cachedItems_;
     }
 
+    // Update the cache window by the items in render area [start, end] and the count of items cached on each side.
+    void UpdateCacheWindow(int32_t start, int32_t end, int32_t cacheCount);
+
+    // Detach all items into the detached item cache, used when there is no item in render area.
+    void DetachAllItems();
+
+    // Build the items in cache window before deadline, returns true if all items are built.
+    bool PrefetchItems(int64_t deadline);
+
+    bool NeedPrefetch() const
+    {
+        return !prefetchItems_.empty();
+    }
+
     void OnDataReloaded() override {}
     void OnDataAdded(size_t index) override {}
     void OnDataDeleted(size_t index) override {}
@@ -73,11 +84,24 @@ public:
 protected:
     virtual int32_t OnGetTotalCount() = 0;
     virtual std::pair<std::string, RefPtr<UINode>> OnGetChildByIndex(int32_t index) = 0;
+    // Get the key of item without building it, the detached item with the same key can be attached again.
+    virtual std::string OnGetKeyByIndex(int32_t index)
+    {
+        return "";
+    }
 
 private:
-    // TODO: add remove functions.
+    void DetachItem(std::pair<std::string, RefPtr<UINode>>&& item);
+    RefPtr<UINode> TakeDetachedItem(int32_t index);
+    void ReleaseItem(const std::string& key);
+
     // [index : [key, UINode]]
     std::map<int32_t, std::pair<std::string, RefPtr<UINode>>> cachedItems_;
+    // [key, UINode] of detached items, the latest detached item is at the front.
+    std::list<std::pair<std::string, RefPtr<UINode>>> detachedItems_;
+    // Indexes of items to build in idle time, the item closer to render area in scroll direction is at the front.
+    std::list<int32_t> prefetchItems_;
+    std::optional<int32_t> lastStartIndex_;
 };
 } // namespace OHOS::Ace::NG
 
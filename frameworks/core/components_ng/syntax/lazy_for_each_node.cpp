@@ -15,6 +15,8 @@
 
 #include "core/components_ng/syntax/lazy_for_each_node.h"
 
+#include <algorithm>
+
 #include "base/utils/utils.h"
 #include "core/components_ng/syntax/lazy_layout_wrapper_builder.h"
 #include "core/pipeline/base/element_register.h"
@@ -45,7 +47,8 @@ void LazyForEachNode::AdjustLayoutWrapperTree(const RefPtr<LayoutWrapper>& paren
     const auto& cachedItems = builder_->GetCacheItems();
     for (const auto& iter : cachedItems) {
         auto frameNode = DynamicCast<FrameNode>(iter.second.second);
-        if (frameNode) {
+        // the wrappers of items out of render area are created when they are requested.
+        if (frameNode && frameNode->IsActive()) {
             lazyLayoutWrapperBuilder->AddCachedItem(
                 iter.first, frameNode->CreateLayoutWrapper(forceMeasure, forceLayout));
         }
@@ -55,19 +58,43 @@ void LazyForEachNode::AdjustLayoutWrapperTree(const RefPtr<LayoutWrapper>& paren
     parent->SetLayoutWrapperBuilder(lazyLayoutWrapperBuilder);
 }
 
-void LazyForEachNode::UpdateCachedItems(const std::unordered_set<int32_t>& activeIndexes)
+void LazyForEachNode::UpdateCachedItems(const std::unordered_set<int32_t>& activeIndexes, int32_t cacheCount)
 {
     children_.clear();
-    auto& cachedItems = builder_->ModifyCacheItems();
-    for (auto iter = cachedItems.begin(); iter != cachedItems.end();) {
-        if (activeIndexes.count(iter->first) > 0) {
-            AddChild(iter->second.second);
-            ++iter;
-        } else {
-            iter = cachedItems.erase(iter);
+    MarkTouchTestIndexDirty();
+    CHECK_NULL_VOID(builder_);
+    if (activeIndexes.empty()) {
+        builder_->DetachAllItems();
+        return;
+    }
+    auto [start, end] = std::minmax_element(activeIndexes.begin(), activeIndexes.end());
+    builder_->UpdateCacheWindow(*start, *end, cacheCount);
+    for (const auto& [index, item] : builder_->GetCacheItems()) {
+        if (activeIndexes.count(index) > 0) {
+            AddChild(item.second);
         }
     }
-    LOGD("cachedItems size is %{public}d", static_cast<int32_t>(cachedItems.size()));
+    PostPrefetchTask();
+}
+
+void LazyForEachNode::PostPrefetchTask()
+{
+    if (hasPrefetchTask_ || !builder_ || !builder_->NeedPrefetch()) {
+        return;
+    }
+    auto context = PipelineContext::GetCurrentContext();
+    CHECK_NULL_VOID(context);
+    hasPrefetchTask_ = true;
+    context->AddPredictTask([weak = AceType::WeakClaim(this)](int64_t deadline) {
+        auto node = weak.Upgrade();
+        CHECK_NULL_VOID(node);
+        node->hasPrefetchTask_ = false;
+        CHECK_NULL_VOID(node->builder_);
+        ACE_SCOPED_TRACE("LazyForEach::PrefetchItems");
+        if (!node->builder_->PrefetchItems(deadline)) {
+            node->PostPrefetchTask();
+        }
+    });
 }
 
 } // namespace OHOS::Ace::NG
\ No newline at end of file
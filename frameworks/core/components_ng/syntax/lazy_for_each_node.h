@@ -48,10 +48,13 @@ public:
 
     void AdjustLayoutWrapperTree(const RefPtr<LayoutWrapper>& parent, bool forceMeasure, bool forceLayout) override;
 
-    void UpdateCachedItems(const std::unordered_set<int32_t>& activeIndexes);
+    void UpdateCachedItems(const std::unordered_set<int32_t>& activeIndexes, int32_t cacheCount);
 
 private:
+    void PostPrefetchTask();
+
     RefPtr<LazyForEachBuilder> builder_;
+    bool hasPrefetchTask_ = false;
 
     ACE_DISALLOW_COPY_AND_MOVE(LazyForEachNode);
 };
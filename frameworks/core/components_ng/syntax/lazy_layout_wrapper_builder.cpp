@@ -39,7 +39,7 @@ void LazyLayoutWrapperBuilder::SwapDirtyAndUpdateBuildCache()
             child.second->SwapDirtyLayoutWrapperOnMainThread();
         }
     }
-    host->UpdateCachedItems(items);
+    host->UpdateCachedItems(items, cacheCount_);
 }
 
 int32_t LazyLayoutWrapperBuilder::OnGetTotalCount()
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "core/components_ng/base/touch_test_index.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t GRID_COLUMNS = 20;
+constexpr int32_t GRID_ROWS = 50;
+constexpr float ITEM_SIZE = 100.0f;
+constexpr int32_t RANDOM_ITEM_COUNT = 500;
+constexpr int32_t RANDOM_POINT_COUNT = 2000;
+constexpr float RANDOM_AREA_SIZE = 1000.0f;
+constexpr uint32_t RANDOM_SEED = 20220915;
+
+// Expected result, same as testing the children one by one from the last one.
+std::vector<int32_t> QueryAll(const std::vector<std::optional<RectF>>& rects, const PointF& point)
+{
+    std::vector<int32_t> result;
+    for (int32_t index = static_cast<int32_t>(rects.size()) - 1; index >= 0; --index) {
+        if (!rects[index] || rects[index]->IsInRegion(point)) {
+            result.emplace_back(index);
+        }
+    }
+    return result;
+}
+} // namespace
+
+class TouchTestIndexTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: TouchTestIndexTest001
+ * @tc.desc: Query the items of a grid.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchTestIndexTest, TouchTestIndexTest001, TestSize.Level1)
+{
+    std::vector<std::optional<RectF>> rects;
+    for (int32_t row = 0; row < GRID_ROWS; ++row) {
+        for (int32_t column = 0; column < GRID_COLUMNS; ++column) {
+            rects.emplace_back(RectF(column * ITEM_SIZE, row * ITEM_SIZE, ITEM_SIZE, ITEM_SIZE));
+        }
+    }
+    auto expectedRects = rects;
+    TouchTestIndex index;
+    index.Build(std::move(rects));
+    EXPECT_EQ(index.GetItemCount(), static_cast<size_t>(GRID_ROWS * GRID_COLUMNS));
+
+    std::vector<int32_t> result;
+    index.Query(PointF(ITEM_SIZE * 3.5f, ITEM_SIZE * 7.5f), result);
+    EXPECT_EQ(result, std::vector<int32_t>({ 7 * GRID_COLUMNS + 3 }));
+
+    // the point on the edge is in both items, the later item is returned first.
+    index.Query(PointF(ITEM_SIZE * 2.0f, ITEM_SIZE * 0.5f), result);
+    EXPECT_EQ(result, std::vector<int32_t>({ 2, 1 }));
+
+    for (const auto& point : { PointF(ITEM_SIZE * GRID_COLUMNS, 0.0f), PointF(-ITEM_SIZE, 0.0f),
+             PointF(ITEM_SIZE * 0.5f, ITEM_SIZE * GRID_ROWS + 1.0f) }) {
+        index.Query(point, result);
+        EXPECT_EQ(result, QueryAll(expectedRects, point));
+    }
+}
+
+/**
+ * @tc.name: TouchTestIndexTest002
+ * @tc.desc: Items without rect and large items are returned in the order of children.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchTestIndexTest, TouchTestIndexTest002, TestSize.Level1)
+{
+    std::vector<std::optional<RectF>> rects;
+    // background covering all items.
+    rects.emplace_back(RectF(0.0f, 0.0f, ITEM_SIZE * GRID_COLUMNS, ITEM_SIZE * GRID_COLUMNS));
+    for (int32_t column = 0; column < GRID_COLUMNS; ++column) {
+        rects.emplace_back(RectF(column * ITEM_SIZE, column * ITEM_SIZE, ITEM_SIZE, ITEM_SIZE));
+    }
+    // syntax node in the middle.
+    rects.insert(rects.begin() + GRID_COLUMNS / 2, std::nullopt);
+    rects.emplace_back(std::nullopt);
+    auto expectedRects = rects;
+    TouchTestIndex index;
+    index.Build(std::move(rects));
+
+    std::vector<int32_t> result;
+    PointF point(ITEM_SIZE * 15.5f, ITEM_SIZE * 15.5f);
+    index.Query(point, result);
+    EXPECT_EQ(result, std::vector<int32_t>({ GRID_COLUMNS + 2, 17, GRID_COLUMNS / 2, 0 }));
+    EXPECT_EQ(result, QueryAll(expectedRects, point));
+
+    point = PointF(-ITEM_SIZE, -ITEM_SIZE);
+    index.Query(point, result);
+    EXPECT_EQ(result, std::vector<int32_t>({ GRID_COLUMNS + 2, GRID_COLUMNS / 2 }));
+}
+
+/**
+ * @tc.name: TouchTestIndexTest003
+ * @tc.desc: Query random overlapping items, the result is the same as testing all items.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchTestIndexTest, TouchTestIndexTest003, TestSize.Level1)
+{
+    std::mt19937 random(RANDOM_SEED);
+    std::uniform_real_distribution<float> position(-ITEM_SIZE, RANDOM_AREA_SIZE);
+    std::uniform_real_distribution<float> size(0.0f, ITEM_SIZE * 3.0f);
+    std::vector<std::optional<RectF>> rects;
+    for (int32_t item = 0; item < RANDOM_ITEM_COUNT; ++item) {
+        rects.emplace_back(RectF(position(random), position(random), size(random), size(random)));
+    }
+    auto expectedRects = rects;
+    TouchTestIndex index;
+    index.Build(std::move(rects));
+
+    std::vector<int32_t> result;
+    for (int32_t count = 0; count < RANDOM_POINT_COUNT; ++count) {
+        PointF point(position(random), position(random));
+        index.Query(point, result);
+        EXPECT_EQ(result, QueryAll(expectedRects, point));
+    }
+}
+
+/**
+ * @tc.name: TouchTestIndexTest004
+ * @tc.desc: Items with empty or invalid rects.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchTestIndexTest, TouchTestIndexTest004, TestSize.Level1)
+{
+    TouchTestIndex emptyIndex;
+    emptyIndex.Build({});
+    std::vector<int32_t> result;
+    emptyIndex.Query(PointF(), result);
+    EXPECT_TRUE(result.empty());
+
+    // all items at the same point.
+    std::vector<std::optional<RectF>> rects(TouchTestIndex::MIN_ITEM_COUNT, RectF(1.0f, 1.0f, 0.0f, 0.0f));
+    TouchTestIndex index;
+    index.Build(std::move(rects));
+    index.Query(PointF(1.0f, 1.0f), result);
+    EXPECT_EQ(result.size(), TouchTestIndex::MIN_ITEM_COUNT);
+    index.Query(PointF(2.0f, 2.0f), result);
+    EXPECT_TRUE(result.empty());
+}
+} // namespace OHOS::Ace::NG
@@ -52,6 +52,11 @@ const std::vector<Dimension> LIST_LAYOUT_ALGORITHM_SPACE_PXS = {LIST_LAYOUT_ALGO
 constexpr int32_t TEST_SPACE_PX_COUNT = 5;
 
 constexpr int32_t LANES_3 = 3;
+
+constexpr float DISPLAY_START_POS = 1000.0;
+constexpr float DISPLAY_MAIN_SIZE = 400.0;
+constexpr int32_t FIRST_VISIBLE_INDEX = 4;
+constexpr int32_t LAST_VISIBLE_INDEX = 7;
 } // namespace
 
 class ListLayoutTest : public testing::Test {
@@ -248,4 +253,120 @@ HWTEST_F(ListLayoutTest, ListLayoutTest003, TestSize.Level1)
         ASSERT_EQ(listLayoutAlgorithm.itemPosition_[j].first, GEOMETRYNODE_FRAMESIZE * (j / lanes));
     }
 }
+
+/**
+ * @tc.name: ListLayoutTest004
+ * @tc.desc: items out of display area with cached extent are skipped in layout
+ * @tc.type: FUNC
+ */
+HWTEST_F(ListLayoutTest, ListLayoutTest004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create layoutWrapper with children and fill the item extent cache
+     * @tc.steps: step2. scroll the list so that the front items are out of display area
+     * @tc.steps: step3. call LayoutForward function and compare result
+     * @tc.expected: positions of skipped items come from the cache and skipped items are not in render area
+     */
+    auto frameNode = FrameNode::CreateFrameNode(V2::LIST_ETS_TAG, 0, AceType::MakeRefPtr<Pattern>());
+    ViewStackProcessor::GetInstance()->Push(frameNode);
+
+    RefPtr<GeometryNode> geometryNode = AceType::MakeRefPtr<GeometryNode>();
+    geometryNode->SetFrameSize(OHOS::Ace::NG::SizeF(DISPLAY_MAIN_SIZE, DISPLAY_MAIN_SIZE));
+
+    LayoutWrapper layoutWrapper = LayoutWrapper(frameNode, geometryNode, frameNode->GetLayoutProperty());
+    for (int32_t j = START_INDEX; j < END_INDEX; j++) {
+        auto childFrameNode = FrameNode::CreateFrameNode(V2::LIST_ETS_TAG, 0,
+            AceType::MakeRefPtr<Pattern>());
+        ViewStackProcessor::GetInstance()->Push(childFrameNode);
+        RefPtr<GeometryNode> childGeometryNode = AceType::MakeRefPtr<GeometryNode>();
+        childGeometryNode->SetFrameSize(
+            OHOS::Ace::NG::SizeF(GEOMETRYNODE_FRAMESIZE, GEOMETRYNODE_FRAMESIZE));
+        RefPtr<LayoutWrapper> childLayoutWrapper = AceType::MakeRefPtr<LayoutWrapper>(childFrameNode,
+            childGeometryNode, childFrameNode->GetLayoutProperty());
+        layoutWrapper.AppendChild(std::move(childLayoutWrapper));
+    }
+
+    LayoutConstraintF setLayoutConstraint;
+    setLayoutConstraint.Reset();
+
+    auto listLayoutAlgorithm = OHOS::Ace::NG::ListLayoutAlgorithm(START_INDEX, END_INDEX);
+    ListLayoutAlgorithm::ItemExtentCache itemExtentCache;
+    for (int32_t j = START_INDEX; j < END_INDEX; j++) {
+        itemExtentCache[j] = { 0, GEOMETRYNODE_FRAMESIZE, setLayoutConstraint, 0 };
+    }
+    listLayoutAlgorithm.SetItemExtentCache(std::move(itemExtentCache));
+    listLayoutAlgorithm.startMainPos_ = DISPLAY_START_POS;
+    listLayoutAlgorithm.endMainPos_ = DISPLAY_START_POS + DISPLAY_MAIN_SIZE;
+
+    listLayoutAlgorithm.LayoutForward(&layoutWrapper, setLayoutConstraint, Axis::VERTICAL, DISPLAY_MAIN_SIZE);
+
+    ASSERT_EQ(listLayoutAlgorithm.GetStartIndex(), FIRST_VISIBLE_INDEX);
+    ASSERT_EQ(listLayoutAlgorithm.GetEndIndex(), LAST_VISIBLE_INDEX);
+    for (int32_t j = START_INDEX; j <= LAST_VISIBLE_INDEX; j++) {
+        ASSERT_EQ(listLayoutAlgorithm.itemPosition_[j].first, GEOMETRYNODE_FRAMESIZE * j);
+        ASSERT_EQ(layoutWrapper.pendingRender_.count(j) > 0, j >= FIRST_VISIBLE_INDEX);
+    }
+    auto itemExtentCacheAfterLayout = listLayoutAlgorithm.MoveItemExtentCache();
+    ASSERT_EQ(itemExtentCacheAfterLayout.size(), static_cast<size_t>(END_INDEX));
+}
+
+/**
+ * @tc.name: ListLayoutTest005
+ * @tc.desc: cached extents measured with another constraint are not used in layout
+ * @tc.type: FUNC
+ */
+HWTEST_F(ListLayoutTest, ListLayoutTest005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create layoutWrapper with children and fill the item extent cache with a stale constraint
+     * @tc.steps: step2. scroll the list so that the front items are out of display area
+     * @tc.steps: step3. call LayoutForward function and compare result
+     * @tc.expected: stale extents are dropped and the items are measured again
+     */
+    auto frameNode = FrameNode::CreateFrameNode(V2::LIST_ETS_TAG, 0, AceType::MakeRefPtr<Pattern>());
+    ViewStackProcessor::GetInstance()->Push(frameNode);
+
+    RefPtr<GeometryNode> geometryNode = AceType::MakeRefPtr<GeometryNode>();
+    geometryNode->SetFrameSize(OHOS::Ace::NG::SizeF(DISPLAY_MAIN_SIZE, DISPLAY_MAIN_SIZE));
+
+    LayoutWrapper layoutWrapper = LayoutWrapper(frameNode, geometryNode, frameNode->GetLayoutProperty());
+    for (int32_t j = START_INDEX; j < END_INDEX; j++) {
+        auto childFrameNode = FrameNode::CreateFrameNode(V2::LIST_ETS_TAG, 0,
+            AceType::MakeRefPtr<Pattern>());
+        ViewStackProcessor::GetInstance()->Push(childFrameNode);
+        RefPtr<GeometryNode> childGeometryNode = AceType::MakeRefPtr<GeometryNode>();
+        childGeometryNode->SetFrameSize(
+            OHOS::Ace::NG::SizeF(GEOMETRYNODE_FRAMESIZE, GEOMETRYNODE_FRAMESIZE));
+        RefPtr<LayoutWrapper> childLayoutWrapper = AceType::MakeRefPtr<LayoutWrapper>(childFrameNode,
+            childGeometryNode, childFrameNode->GetLayoutProperty());
+        layoutWrapper.AppendChild(std::move(childLayoutWrapper));
+    }
+
+    LayoutConstraintF setLayoutConstraint;
+    setLayoutConstraint.Reset();
+    // the list is measured with another width before, such as rotation.
+    LayoutConstraintF staleLayoutConstraint = setLayoutConstraint;
+    staleLayoutConstraint.maxSize.SetWidth(DISPLAY_MAIN_SIZE);
+
+    auto listLayoutAlgorithm = OHOS::Ace::NG::ListLayoutAlgorithm(START_INDEX, END_INDEX);
+    ListLayoutAlgorithm::ItemExtentCache itemExtentCache;
+    for (int32_t j = START_INDEX; j < END_INDEX; j++) {
+        itemExtentCache[j] = { 0, GEOMETRYNODE_FRAMESIZE / 2, staleLayoutConstraint, 0 };
+    }
+    listLayoutAlgorithm.SetItemExtentCache(std::move(itemExtentCache));
+    listLayoutAlgorithm.startMainPos_ = DISPLAY_START_POS;
+    listLayoutAlgorithm.endMainPos_ = DISPLAY_START_POS + DISPLAY_MAIN_SIZE;
+
+    listLayoutAlgorithm.LayoutForward(&layoutWrapper, setLayoutConstraint, Axis::VERTICAL, DISPLAY_MAIN_SIZE);
+
+    ASSERT_EQ(listLayoutAlgorithm.GetStartIndex(), FIRST_VISIBLE_INDEX);
+    ASSERT_EQ(listLayoutAlgorithm.GetEndIndex(), LAST_VISIBLE_INDEX);
+    for (int32_t j = START_INDEX; j <= LAST_VISIBLE_INDEX; j++) {
+        ASSERT_EQ(listLayoutAlgorithm.itemPosition_[j].first, GEOMETRYNODE_FRAMESIZE * j);
+    }
+    auto itemExtentCacheAfterLayout = listLayoutAlgorithm.MoveItemExtentCache();
+    for (const auto& [index, itemExtent] : itemExtentCacheAfterLayout) {
+        ASSERT_EQ(itemExtent.layoutConstraint, setLayoutConstraint);
+    }
+}
 } // namespace OHOS::Ace
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/utils/time_util.h"
+#include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/pattern/pattern.h"
+#include "core/components_ng/syntax/lazy_for_each_builder.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t TOTAL_COUNT = 100;
+constexpr int64_t ONE_SECOND = 1000 * 1000000;
+
+class FakeLazyForEachBuilder : public LazyForEachBuilder {
+    DECLARE_ACE_TYPE(FakeLazyForEachBuilder, LazyForEachBuilder);
+
+public:
+    FakeLazyForEachBuilder() = default;
+    ~FakeLazyForEachBuilder() override = default;
+
+    void ReleaseChildGroupById(const std::string& id) override
+    {
+        releasedKeys.emplace_back(id);
+    }
+    void RegisterDataChangeListener(const RefPtr<V2::DataChangeListener>& listener) override {}
+    void UnregisterDataChangeListener(const RefPtr<V2::DataChangeListener>& listener) override {}
+
+    int32_t buildCount = 0;
+    std::vector<std::string> releasedKeys;
+
+protected:
+    int32_t OnGetTotalCount() override
+    {
+        return TOTAL_COUNT;
+    }
+
+    std::pair<std::string, RefPtr<UINode>> OnGetChildByIndex(int32_t index) override
+    {
+        ++buildCount;
+        return { OnGetKeyByIndex(index), FrameNode::CreateFrameNode("item", index, AceType::MakeRefPtr<Pattern>()) };
+    }
+
+    std::string OnGetKeyByIndex(int32_t index) override
+    {
+        return std::to_string(index);
+    }
+};
+} // namespace
+
+class LazyForEachBuilderTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: LazyForEachBuilderTest001
+ * @tc.desc: Items scrolled out of the cache window are detached and attached again without rebuilding.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LazyForEachBuilderTest, LazyForEachBuilderTest001, TestSize.Level1)
+{
+    auto builder = AceType::MakeRefPtr<FakeLazyForEachBuilder>();
+    for (int32_t index = 0; index < 4; ++index) {
+        EXPECT_NE(builder->GetChildByIndex(index), nullptr);
+    }
+    EXPECT_EQ(builder->buildCount, 4);
+    auto firstItem = builder->GetChildByIndex(0);
+
+    /**
+     * @tc.steps: step1. scroll to [10, 13], items [0, 3] are detached.
+     */
+    builder->UpdateCacheWindow(0, 3, 0);
+    builder->UpdateCacheWindow(10, 13, 0);
+    EXPECT_TRUE(builder->GetCacheItems().empty());
+
+    /**
+     * @tc.steps: step2. scroll back, the detached item is attached again.
+     */
+    EXPECT_EQ(builder->GetChildByIndex(0), firstItem);
+    EXPECT_EQ(builder->buildCount, 4);
+    EXPECT_TRUE(builder->releasedKeys.empty());
+}
+
+/**
+ * @tc.name: LazyForEachBuilderTest002
+ * @tc.desc: Items in the cache window are prefetched in scroll direction first.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LazyForEachBuilderTest, LazyForEachBuilderTest002, TestSize.Level1)
+{
+    auto builder = AceType::MakeRefPtr<FakeLazyForEachBuilder>();
+    builder->UpdateCacheWindow(10, 13, 1);
+    EXPECT_TRUE(builder->NeedPrefetch());
+
+    /**
+     * @tc.steps: step1. prefetch with expired deadline, nothing is built.
+     */
+    EXPECT_FALSE(builder->PrefetchItems(0));
+    EXPECT_EQ(builder->buildCount, 0);
+
+    /**
+     * @tc.steps: step2. scroll forward by 2 items, the window is extended forward by the velocity.
+     */
+    builder->UpdateCacheWindow(12, 15, 1);
+    EXPECT_TRUE(builder->PrefetchItems(GetSysTimestamp() + ONE_SECOND));
+    EXPECT_FALSE(builder->NeedPrefetch());
+    const auto& items = builder->GetCacheItems();
+    EXPECT_EQ(items.begin()->first, 11);
+    EXPECT_EQ(items.rbegin()->first, 22);
+    EXPECT_EQ(items.count(12), 0);
+}
+
+/**
+ * @tc.name: LazyForEachBuilderTest003
+ * @tc.desc: Items dropped out of the bounded detached item cache are released.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LazyForEachBuilderTest, LazyForEachBuilderTest003, TestSize.Level1)
+{
+    auto builder = AceType::MakeRefPtr<FakeLazyForEachBuilder>();
+    for (int32_t index = 0; index < 40; ++index) {
+        builder->GetChildByIndex(index);
+    }
+    builder->DetachAllItems();
+    EXPECT_TRUE(builder->GetCacheItems().empty());
+    EXPECT_FALSE(builder->releasedKeys.empty());
+    EXPECT_EQ(builder->releasedKeys.front(), "0");
+}
+} // namespace OHOS::Ace::NG
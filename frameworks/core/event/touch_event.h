@@ -67,6 +67,16 @@ struct TouchPoint final {
     bool isPressed = false;
 };
 
+// Raw position of a touch point, kept in the history of an event merged from several samples.
+struct TouchSample final {
+    float x = 0.0f;
+    float y = 0.0f;
+    float screenX = 0.0f;
+    float screenY = 0.0f;
+    // nanosecond time stamp.
+    TimeStamp time;
+};
+
 /**
  * @brief TouchEvent contains the active change point and a list of all touch points.
  */
@@ -89,6 +99,9 @@ struct TouchEvent final {
 
     // all points on the touch screen.
     std::vector<TouchPoint> pointers;
+    // raw samples of this point merged into the event, from the oldest to the latest, when move events are coalesced
+    // or resampled in a frame. Empty if the event itself is the raw sample.
+    std::vector<TouchSample> history;
 
     Offset GetOffset() const
     {
@@ -103,7 +116,7 @@ struct TouchEvent final {
     TouchEvent CreateScalePoint(float scale) const
     {
         if (NearZero(scale)) {
-            return { id, x, y, screenX, screenY, type, time, size, force, deviceId, sourceType, pointers };
+            return { id, x, y, screenX, screenY, type, time, size, force, deviceId, sourceType, pointers, history };
         }
         auto temp = pointers;
         std::for_each(temp.begin(), temp.end(), [scale](auto&& point) {
@@ -112,13 +125,21 @@ struct TouchEvent final {
             point.screenX = point.screenX / scale;
             point.screenY = point.screenY / scale;
         });
+        auto tempHistory = history;
+        std::for_each(tempHistory.begin(), tempHistory.end(), [scale](auto&& sample) {
+            sample.x = sample.x / scale;
+            sample.y = sample.y / scale;
+            sample.screenX = sample.screenX / scale;
+            sample.screenY = sample.screenY / scale;
+        });
         return { id, x / scale, y / scale, screenX / scale, screenY / scale, type, time, size, force, deviceId,
-            sourceType, temp };
+            sourceType, temp, tempHistory };
     }
 
     TouchEvent UpdateScalePoint(float scale, float offsetX, float offsetY, int32_t pointId) const
     {
         auto temp = pointers;
+        auto tempHistory = history;
         if (NearZero(scale)) {
             std::for_each(temp.begin(), temp.end(), [offsetX, offsetY](auto&& point) {
                 point.x = point.x - offsetX;
@@ -126,8 +147,14 @@ struct TouchEvent final {
                 point.screenX = point.screenX - offsetX;
                 point.screenY = point.screenY - offsetY;
             });
+            std::for_each(tempHistory.begin(), tempHistory.end(), [offsetX, offsetY](auto&& sample) {
+                sample.x = sample.x - offsetX;
+                sample.y = sample.y - offsetY;
+                sample.screenX = sample.screenX - offsetX;
+                sample.screenY = sample.screenY - offsetY;
+            });
             return { pointId, x - offsetX, y - offsetY, screenX - offsetX, screenY - offsetY, type, time, size, force,
-                deviceId, sourceType, temp };
+                deviceId, sourceType, temp, tempHistory };
         }
 
         std::for_each(temp.begin(), temp.end(), [scale, offsetX, offsetY](auto&& point) {
@@ -136,8 +163,14 @@ struct TouchEvent final {
             point.screenX = (point.screenX - offsetX) / scale;
             point.screenY = (point.screenY - offsetY) / scale;
         });
+        std::for_each(tempHistory.begin(), tempHistory.end(), [scale, offsetX, offsetY](auto&& sample) {
+            sample.x = (sample.x - offsetX) / scale;
+            sample.y = (sample.y - offsetY) / scale;
+            sample.screenX = (sample.screenX - offsetX) / scale;
+            sample.screenY = (sample.screenY - offsetY) / scale;
+        });
         return { pointId, (x - offsetX) / scale, (y - offsetY) / scale, (screenX - offsetX) / scale,
-            (screenY - offsetY) / scale, type, time, size, force, deviceId, sourceType, temp };
+            (screenY - offsetY) / scale, type, time, size, force, deviceId, sourceType, temp, tempHistory };
     }
 
     TouchEvent UpdatePointers() const
@@ -38,11 +38,23 @@ void VelocityTracker::UpdateTouchPoint(const TouchEvent& event, bool end)
     if (delta_.IsZero() && end && (diffTime.count() < range)) {
         return;
     }
+    // the velocity is fitted with the raw samples, when the event is coalesced or resampled in a frame.
+    if (!event.history.empty()) {
+        for (const auto& sample : event.history) {
+            UpdateAxisPoint(sample.time, sample.x, sample.y);
+        }
+        return;
+    }
+    UpdateAxisPoint(event.time, event.x, event.y);
+}
+
+void VelocityTracker::UpdateAxisPoint(const TimeStamp& time, float x, float y)
+{
     // nanoseconds duration to seconds.
-    std::chrono::duration<double> duration = event.time - firstTrackPoint_.time;
+    std::chrono::duration<double> duration = time - firstTrackPoint_.time;
     auto seconds = duration.count();
-    xAxis_.UpdatePoint(seconds, event.x);
-    yAxis_.UpdatePoint(seconds, event.y);
+    xAxis_.UpdatePoint(seconds, x);
+    yAxis_.UpdatePoint(seconds, y);
 }
 
 void VelocityTracker::UpdateVelocity()
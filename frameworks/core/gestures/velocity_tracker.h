@@ -113,6 +113,7 @@ public:
 
 private:
     void UpdateVelocity();
+    void UpdateAxisPoint(const TimeStamp& time, float x, float y);
 
     Axis mainAxis_ { Axis::FREE };
     TouchEvent firstTrackPoint_;
@@ -15,10 +15,15 @@
 
 #include "core/image/animated_image_player.h"
 
+#include <algorithm>
+#include <atomic>
+#include <unordered_set>
+
 #include "third_party/skia/include/codec/SkCodecAnimation.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
 
 #include "base/log/log.h"
+#include "base/thread/background_task_executor.h"
 #include "core/image/image_provider.h"
 
 #ifdef NG_BUILD
@@ -26,6 +31,89 @@
 #endif
 
 namespace OHOS::Ace {
+namespace {
+
+// frames decoded ahead of the rendering frame.
+constexpr int32_t LOOK_AHEAD_FRAME_COUNT = 3;
+// the rendering frame and its prior frame.
+constexpr size_t MIN_FRAME_SLOT_COUNT = 2;
+// decoded frames of all animated images in look-ahead mode take 32MB at most.
+constexpr size_t FRAME_BUFFER_BUDGET = 32 * 1024 * 1024;
+
+std::atomic<size_t> g_frameBufferBytes = 0;
+
+// players alive, whose frame buffers are released on memory pressure.
+std::mutex g_playersMutex;
+std::unordered_set<AnimatedImagePlayer*> g_players;
+
+bool ReserveFrameBufferBytes(size_t bytes)
+{
+    size_t used = g_frameBufferBytes.load(std::memory_order_relaxed);
+    do {
+        if (bytes > FRAME_BUFFER_BUDGET - used) {
+            return false;
+        }
+    } while (!g_frameBufferBytes.compare_exchange_weak(used, used + bytes, std::memory_order_relaxed));
+    return true;
+}
+
+} // namespace
+
+AnimatedImagePlayer::~AnimatedImagePlayer()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_playersMutex);
+        g_players.erase(this);
+    }
+    g_frameBufferBytes.fetch_sub(reservedFrameBytes_, std::memory_order_relaxed);
+}
+
+void AnimatedImagePlayer::RegisterPlayer(AnimatedImagePlayer* player)
+{
+    std::lock_guard<std::mutex> lock(g_playersMutex);
+    g_players.emplace(player);
+}
+
+void AnimatedImagePlayer::ReleaseFrameBuffers()
+{
+    std::lock_guard<std::mutex> lock(g_playersMutex);
+    LOGI("release frame buffers of %{public}d animated images", static_cast<int32_t>(g_players.size()));
+    for (auto* player : g_players) {
+        player->ReleaseFrameBuffer();
+    }
+}
+
+void AnimatedImagePlayer::ReleaseFrameBuffer()
+{
+    lookAheadCount_ = 0;
+    std::lock_guard<std::mutex> lock(decodeMutex_);
+    if (frameSlots_.size() > MIN_FRAME_SLOT_COUNT) {
+        // the pixels of the frames are freed, frames are decoded again into the slots left.
+        frameSlots_.clear();
+        frameSlots_.resize(MIN_FRAME_SLOT_COUNT);
+        nextFrameSlot_ = 0;
+    }
+    g_frameBufferBytes.fetch_sub(reservedFrameBytes_, std::memory_order_relaxed);
+    reservedFrameBytes_ = 0;
+    // the copies of required frames are made again when the frames are decoded.
+    for (auto& cached : cachedFrame_) {
+        cached.second.reset();
+    }
+}
+
+void AnimatedImagePlayer::InitFrameBuffer()
+{
+    size_t frameBytes = codec_->getInfo().makeColorType(kN32_SkColorType).computeMinByteSize();
+    size_t slotCount = MIN_FRAME_SLOT_COUNT + LOOK_AHEAD_FRAME_COUNT;
+    if (frameCount_ > 1 && ReserveFrameBufferBytes(frameBytes * slotCount)) {
+        reservedFrameBytes_ = frameBytes * slotCount;
+        lookAheadCount_ = std::min(LOOK_AHEAD_FRAME_COUNT, frameCount_ - 1);
+    } else {
+        LOGD("frame buffer budget is used up, decode frames on demand.");
+        slotCount = MIN_FRAME_SLOT_COUNT;
+    }
+    frameSlots_.resize(slotCount);
+}
 
 void AnimatedImagePlayer::Pause()
 {
@@ -55,7 +143,11 @@ void AnimatedImagePlayer::RenderFrame(const int32_t& index)
             auto canvasImage = NG::CanvasImage::Create(nullptr);
 #else
             auto canvasImage = flutter::CanvasImage::Create();
-            sk_sp<SkImage> skImage = player->DecodeFrameImage(index);
+            sk_sp<SkImage> skImage;
+            {
+                std::lock_guard<std::mutex> lock(player->decodeMutex_);
+                skImage = player->DecodeFrameImage(index);
+            }
             if (dstWidth > 0 && dstHeight > 0) {
                 skImage = ImageProvider::ApplySizeToSkImage(skImage, dstWidth, dstHeight);
             }
@@ -69,64 +161,156 @@ void AnimatedImagePlayer::RenderFrame(const int32_t& index)
             taskExecutor->PostTask([callback = player->successCallback_, canvasImage,
                                        source = player->imageSource_] { callback(source, canvasImage); },
                 TaskExecutor::TaskType::UI);
+#ifndef NG_BUILD
+            player->PostLookAheadTask(index);
+#endif
         },
         TaskExecutor::TaskType::IO);
 }
 
-sk_sp<SkImage> AnimatedImagePlayer::DecodeFrameImage(const int32_t& index)
+SkBitmap* AnimatedImagePlayer::FindFrame(int32_t index)
 {
-    // first seek in cache
-    auto iterator = cachedFrame_.find(index);
-    if (iterator != cachedFrame_.end() && iterator->second != nullptr) {
-        LOGD("index %{private}d found in cache.", index);
-        return SkImage::MakeFromBitmap(*iterator->second);
+    for (auto& slot : frameSlots_) {
+        if (slot.index == index) {
+            return &slot.bitmap;
+        }
+    }
+    return nullptr;
+}
+
+AnimatedImagePlayer::FrameSlot* AnimatedImagePlayer::AcquireFrameSlot(
+    int32_t index, const SkImageInfo& info, const SkBitmap* keptFrame)
+{
+    if (frameSlots_.empty()) {
+        return nullptr;
+    }
+    // replace the oldest frame, except the prior frame of the decoding one.
+    auto* slot = &frameSlots_[nextFrameSlot_];
+    nextFrameSlot_ = (nextFrameSlot_ + 1) % frameSlots_.size();
+    if (&slot->bitmap == keptFrame) {
+        slot = &frameSlots_[nextFrameSlot_];
+        nextFrameSlot_ = (nextFrameSlot_ + 1) % frameSlots_.size();
+    }
+    slot->index = -1;
+    if (slot->bitmap.info() != info || !slot->bitmap.getPixels()) {
+        slot->bitmap.reset();
+        if (!slot->bitmap.tryAllocPixels(info)) {
+            LOGW("Could not allocate pixels for frame %{public}d", index);
+            return nullptr;
+        }
     }
+    slot->index = index;
+    return slot;
+}
 
-    SkBitmap bitmap;
+SkBitmap* AnimatedImagePlayer::DecodeFrame(int32_t index)
+{
+    auto* frame = FindFrame(index);
+    if (frame) {
+        return frame;
+    }
     SkImageInfo info = codec_->getInfo().makeColorType(kN32_SkColorType);
-    bitmap.allocPixels(info);
-    SkCodec::Options options;
-    options.fFrameIndex = index;
+    const SkBitmap* priorFrame = nullptr;
     const int32_t requiredFrame = frameInfos_[index].fRequiredFrame;
     if (requiredFrame != SkCodec::kNoFrame) {
-        if (requiredFrame == lastRequiredFrameIndex_ && lastRequiredBitmap_ && lastRequiredBitmap_->getPixels() &&
-            CopyTo(&bitmap, lastRequiredBitmap_->colorType(), *lastRequiredBitmap_)) {
-            options.fPriorFrame = requiredFrame;
-        } else if (requiredFrame != lastRequiredFrameIndex_) {
+        priorFrame = FindFrame(requiredFrame);
+        if (!priorFrame) {
             // find requiredFrame in cached frame.
             auto iter = cachedFrame_.find(requiredFrame);
-            if (iter != cachedFrame_.end() && iter->second != nullptr &&
-                CopyTo(&bitmap, iter->second->colorType(), *iter->second)) {
-                options.fPriorFrame = requiredFrame;
+            if (iter != cachedFrame_.end() && iter->second != nullptr) {
+                priorFrame = iter->second.get();
             }
         }
     }
-
-    if (SkCodec::kSuccess != codec_->getPixels(info, bitmap.getPixels(), bitmap.rowBytes(), &options)) {
+    auto* slot = AcquireFrameSlot(index, info, priorFrame);
+    if (!slot) {
+        return nullptr;
+    }
+    frame = &slot->bitmap;
+    SkCodec::Options options;
+    options.fFrameIndex = index;
+    // without prior frame, codec decodes the required frames by itself.
+    if (priorFrame && priorFrame->readPixels(frame->pixmap())) {
+        options.fPriorFrame = requiredFrame;
+    }
+    if (SkCodec::kSuccess != codec_->getPixels(info, frame->getPixels(), frame->rowBytes(), &options)) {
         LOGW("Could not getPixels for frame %{public}d:", index);
+        slot->index = -1;
         return nullptr;
     }
 
-    if (frameInfos_[index].fDisposalMethod != SkCodecAnimation::DisposalMethod::kRestorePrevious) {
-        lastRequiredBitmap_ = std::make_unique<SkBitmap>(bitmap);
-        lastRequiredFrameIndex_ = index;
+    auto iterator = cachedFrame_.find(index);
+    if (iterator != cachedFrame_.end() && iterator->second == nullptr) {
+        // copy the pixels, because the memory of frame slot is reused.
+        auto bitmap = std::make_unique<SkBitmap>();
+        if (CopyTo(bitmap.get(), frame->colorType(), *frame)) {
+            LOGD("index %{private}d cached.", index);
+            iterator->second = std::move(bitmap);
+        }
     }
+    return frame;
+}
 
-    if (iterator != cachedFrame_.end() && iterator->second == nullptr) {
-        LOGD("index %{private}d cached.", index);
-        iterator->second = std::make_unique<SkBitmap>(bitmap);
+void AnimatedImagePlayer::PostLookAheadTask(int32_t index)
+{
+    if (lookAheadCount_ == 0 || lookAheadPosted_.exchange(true)) {
+        return;
+    }
+    // The codec decodes on background threads, so the io thread is free to upload the rendering frames.
+    auto posted = BackgroundTaskExecutor::GetInstance().PostTask([weak = AceType::WeakClaim(this), index] {
+        auto player = weak.Upgrade();
+        if (!player) {
+            return;
+        }
+        player->DecodeLookAheadFrames(index);
+        player->lookAheadPosted_ = false;
+    });
+    if (!posted) {
+        lookAheadPosted_ = false;
+    }
+}
+
+void AnimatedImagePlayer::DecodeLookAheadFrames(int32_t index)
+{
+    for (int32_t step = 1;; ++step) {
+        int32_t nextIndex = (index + step) % frameCount_;
+        // lock each frame, so the io thread waits for one frame at most to render.
+        std::lock_guard<std::mutex> lock(decodeMutex_);
+        // checked under lock, as the frame buffer may be released while waiting for the lock.
+        if (step > lookAheadCount_) {
+            return;
+        }
+        if (!FindFrame(nextIndex) && !DecodeFrame(nextIndex)) {
+            return;
+        }
+    }
+}
+
+sk_sp<SkImage> AnimatedImagePlayer::DecodeFrameImage(const int32_t& index)
+{
+    // first seek in cache
+    auto iterator = cachedFrame_.find(index);
+    if (iterator != cachedFrame_.end() && iterator->second != nullptr) {
+        LOGD("index %{private}d found in cache.", index);
+        return SkImage::MakeFromBitmap(*iterator->second);
+    }
+
+    auto* frame = DecodeFrame(index);
+    if (!frame) {
+        return nullptr;
     }
+    // Bitmaps of frame slots are mutable, the images below copy the pixels, so the slots can be reused.
 #ifndef GPU_DISABLED
     // weak reference of io manager must be check and used on io thread, because io manager is created on io thread.
     if (ioManager_) {
         auto resourceContext = ioManager_->GetResourceContext();
         if (resourceContext) {
-            SkPixmap pixmap(bitmap.info(), bitmap.pixelRef()->pixels(), bitmap.pixelRef()->rowBytes());
+            SkPixmap pixmap(frame->info(), frame->pixelRef()->pixels(), frame->pixelRef()->rowBytes());
             return SkImage::MakeCrossContextFromPixmap(resourceContext.get(), pixmap, true, pixmap.colorSpace());
         }
     }
 #endif
-    return SkImage::MakeFromBitmap(bitmap);
+    return SkImage::MakeFromBitmap(*frame);
 }
 
 bool AnimatedImagePlayer::CopyTo(SkBitmap* dst, SkColorType dstColorType, const SkBitmap& src)
@@ -16,7 +16,10 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_ANIMATED_IMAGE_PLAYER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_ANIMATED_IMAGE_PLAYER_H
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "flutter/fml/memory/ref_counted.h"
 #ifdef NG_BUILD
@@ -54,6 +57,8 @@ public:
           dstWidth_(dstWidth), dstHeight_(dstHeight)
     {
         LOGD("animated image frameCount_ : %{public}d, repetitionCount_ : %{public}d", frameCount_, repetitionCount_);
+        InitFrameBuffer();
+        RegisterPlayer(this);
         auto context = context_.Upgrade();
         if (context) {
             animator_ = AceType::MakeRefPtr<Animator>(context);
@@ -102,7 +107,7 @@ public:
         }
     }
 
-    ~AnimatedImagePlayer() override = default;
+    ~AnimatedImagePlayer() override;
 
     void Pause();
     void Resume();
@@ -114,7 +119,24 @@ public:
         dstHeight_ = height;
     }
 
+    // On memory pressure, drops the frames decoded ahead by all players, which decode frames on demand from then on.
+    static void ReleaseFrameBuffers();
+
 private:
+    // Decoded frame kept in the frame buffer, the pixel memory is reused by the frames decoded later.
+    struct FrameSlot {
+        int32_t index = -1;
+        SkBitmap bitmap;
+    };
+
+    static void RegisterPlayer(AnimatedImagePlayer* player);
+    void InitFrameBuffer();
+    void ReleaseFrameBuffer();
+    SkBitmap* FindFrame(int32_t index);
+    FrameSlot* AcquireFrameSlot(int32_t index, const SkImageInfo& info, const SkBitmap* keptFrame);
+    SkBitmap* DecodeFrame(int32_t index);
+    void PostLookAheadTask(int32_t index);
+    void DecodeLookAheadFrames(int32_t index);
     sk_sp<SkImage> DecodeFrameImage(const int32_t& index);
     static bool CopyTo(SkBitmap* dst, SkColorType dstColorType, const SkBitmap& src);
 
@@ -138,9 +160,19 @@ private:
     // used to cache required frame.
     std::unordered_map<int32_t, std::unique_ptr<SkBitmap>> cachedFrame_;
 
-    // used to cache last required frame. this will be reset during looping.
-    std::unique_ptr<SkBitmap> lastRequiredBitmap_;
-    int32_t lastRequiredFrameIndex_ = -1;
+    // Guards the codec, the cached frames and the frame ring, which are used by the io thread to render frames and by
+    // background threads to decode frames ahead.
+    std::mutex decodeMutex_;
+    std::atomic<bool> lookAheadPosted_ { false };
+
+    // Ring of recently decoded frames. Frames after the rendering one are decoded ahead on background threads when the
+    // bytes of the ring are reserved from the budget shared by all players, otherwise the ring keeps the rendering
+    // frame and its prior frame only and frames are decoded on demand.
+    std::vector<FrameSlot> frameSlots_;
+    size_t nextFrameSlot_ = 0;
+    size_t reservedFrameBytes_ = 0;
+    // set to 0 without lock when the frame buffer is released, so pending look-ahead stops before the next frame.
+    std::atomic<int32_t> lookAheadCount_ { 0 };
 };
 
 } // namespace OHOS::Ace
@@ -26,11 +26,7 @@ RefPtr<ImageCache> ImageCache::Create()
 
 void FlutterImageCache::Clear()
 {
-    std::scoped_lock clearLock(cacheListMutex_, imageCacheMutex_, dataCacheListMutex_, imageDataCacheMutex_);
-    cacheList_.clear();
-    imageCache_.clear();
-    dataCacheList_.clear();
-    imageDataCache_.clear();
+    ClearMemoryCache();
 }
 
 RefPtr<CachedImageData> FlutterImageCache::GetDataFromCacheFile(const std::string& filePath)
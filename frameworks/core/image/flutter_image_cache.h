@@ -22,6 +22,7 @@
 #else
 #include "flutter/lib/ui/painting/image.h"
 #endif
+#include "third_party/skia/include/core/SkImage.h"
 
 #include "core/image/image_cache.h"
 #include "core/image/image_object.h"
@@ -36,6 +37,35 @@ struct CachedImage {
     explicit CachedImage(const fml::RefPtr<flutter::CanvasImage>& image) : imagePtr(image) {}
     fml::RefPtr<flutter::CanvasImage> imagePtr;
 #endif
+
+    // Size of decoded pixels in bytes, which is charged against the image cache.
+    size_t GetSize() const
+    {
+        if (!imagePtr) {
+            return 0;
+        }
+#ifdef NG_BUILD
+        return ImageCache::GetPixelsSize(imagePtr->GetWidth(), imagePtr->GetHeight());
+#else
+        auto image = imagePtr->image();
+        if (!image) {
+            return 0;
+        }
+        return static_cast<size_t>(image->width()) * static_cast<size_t>(image->height()) *
+               static_cast<size_t>(image->imageInfo().bytesPerPixel());
+#endif
+    }
+};
+
+// Svg drawn into a raster image, which is drawn instead of the svg dom while the size and fill color are the same.
+struct CachedSvgRaster {
+    explicit CachedSvgRaster(const sk_sp<SkImage>& image) : image(image) {}
+    sk_sp<SkImage> image;
+
+    size_t GetSize() const
+    {
+        return image ? ImageCache::GetPixelsSize(image->width(), image->height()) : 0;
+    }
 };
 
 struct SkiaCachedImageData : public CachedImageData {
@@ -22,6 +22,16 @@
 #include "core/image/image_object.h"
 
 namespace OHOS::Ace {
+namespace {
+
+constexpr size_t DEFAULT_IMAGE_SIZE_LIMIT = 100 * 1024 * 1024; // decoded images take 100MB at most.
+constexpr size_t IMAGE_OBJECT_CAPACITY = 2000;
+constexpr size_t SVG_DOM_CAPACITY = 500;
+constexpr size_t DEFAULT_SVG_DOM_SIZE_LIMIT = 8 * 1024 * 1024;
+constexpr size_t SVG_RASTER_CAPACITY = 500;
+constexpr size_t DEFAULT_SVG_RASTER_SIZE_LIMIT = 16 * 1024 * 1024;
+
+} // namespace
 
 std::shared_mutex ImageCache::cacheFilePathMutex_;
 std::string ImageCache::cacheFilePath_;
@@ -56,39 +66,20 @@ RefPtr<ImageCache> ImageCache::Create()
 void ImageCache::Purge() {}
 #endif
 
-template<typename T>
-void ImageCache::CacheWithCountLimitLRU(const std::string& key, const T& cacheObj, std::list<CacheNode<T>>& cacheList,
-    std::unordered_map<std::string, typename std::list<CacheNode<T>>::iterator>& cache,
-    const std::atomic<size_t>& capacity)
+ImageCache::ImageCache()
 {
-    auto iter = cache.find(key);
-    if (iter == cache.end()) {
-        if (cache.size() == capacity) {
-            cache.erase(cacheList.back().cacheKey);
-            cacheList.pop_back();
-        }
-        cacheList.emplace_front(key, cacheObj);
-        cache.emplace(key, cacheList.begin());
-    } else {
-        iter->second->cacheObj = cacheObj;
-        cacheList.splice(cacheList.begin(), cacheList, iter->second);
-        iter->second = cacheList.begin();
-    }
+    // by default memory cache can store 0 images.
+    imageCache_.SetCountLimit(0);
+    imageCache_.SetSizeLimit(DEFAULT_IMAGE_SIZE_LIMIT);
+    dataCache_.SetSizeLimit(dataSizeLimit_);
+    imgObjCache_.SetCountLimit(IMAGE_OBJECT_CAPACITY);
+    svgDomCache_.SetCountLimit(SVG_DOM_CAPACITY);
+    svgDomCache_.SetSizeLimit(DEFAULT_SVG_DOM_SIZE_LIMIT);
+    svgRasterCache_.SetCountLimit(SVG_RASTER_CAPACITY);
+    svgRasterCache_.SetSizeLimit(DEFAULT_SVG_RASTER_SIZE_LIMIT);
 }
 
-template<typename T>
-T ImageCache::GetCacheObjWithCountLimitLRU(const std::string& key, std::list<CacheNode<T>>& cacheList,
-    std::unordered_map<std::string, typename std::list<CacheNode<T>>::iterator>& cache)
-{
-    auto iter = cache.find(key);
-    if (iter != cache.end()) {
-        cacheList.splice(cacheList.begin(), cacheList, iter->second);
-        iter->second = cacheList.begin();
-        return iter->second->cacheObj;
-    } else {
-        return nullptr;
-    }
-}
+ImageCache::~ImageCache() = default;
 
 bool ImageCache::GetFromCacheFile(const std::string& filePath)
 {
@@ -108,34 +99,98 @@ bool ImageCache::GetFromCacheFileInner(const std::string& filePath)
     return true;
 }
 
-void ImageCache::CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image)
+void ImageCache::CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image, size_t size)
 {
-    if (key.empty() || capacity_ == 0) {
+    if (key.empty() || !image) {
         return;
     }
-    std::scoped_lock lock(imageCacheMutex_, cacheListMutex_);
-    CacheWithCountLimitLRU<std::shared_ptr<CachedImage>>(key, image, cacheList_, imageCache_, capacity_);
+    imageCache_.Put(key, image, size);
 }
 
 std::shared_ptr<CachedImage> ImageCache::GetCacheImage(const std::string& key)
 {
-    std::scoped_lock lock(imageCacheMutex_, cacheListMutex_);
-    return GetCacheObjWithCountLimitLRU<std::shared_ptr<CachedImage>>(key, cacheList_, imageCache_);
+    auto image = imageCache_.Get(key);
+    auto cachedImage = std::get_if<std::shared_ptr<CachedImage>>(&image);
+    return cachedImage ? *cachedImage : nullptr;
+}
+
+void ImageCache::CacheCanvasImage(const std::string& key, const RefPtr<AceType>& image, size_t size)
+{
+    if (key.empty() || !image) {
+        return;
+    }
+    imageCache_.Put(key, image, size);
+}
+
+RefPtr<AceType> ImageCache::GetCacheCanvasImage(const std::string& key)
+{
+    auto image = imageCache_.Get(key);
+    auto canvasImage = std::get_if<RefPtr<AceType>>(&image);
+    return canvasImage ? *canvasImage : nullptr;
+}
+
+void ImageCache::SetCapacity(size_t capacity)
+{
+    LOGI("Set Capacity : %{public}d", static_cast<int32_t>(capacity));
+    imageCache_.SetCountLimit(capacity);
+}
+
+void ImageCache::SetImageSizeLimit(size_t sizeLimit)
+{
+    LOGI("Set image size cache limit : %{public}zu", sizeLimit);
+    imageCache_.SetSizeLimit(sizeLimit);
 }
 
 void ImageCache::CacheImgObj(const std::string& key, const RefPtr<ImageObject>& imgObj)
 {
-    if (key.empty() || imgObjCapacity_ == 0) {
+    if (key.empty()) {
         return;
     }
-    std::scoped_lock lock(cacheImgObjListMutex_, imgObjCacheMutex_);
-    CacheWithCountLimitLRU<RefPtr<ImageObject>>(key, imgObj, cacheImgObjList_, imgObjCache_, imgObjCapacity_);
+    // Image object keeps the size of image only, limited by count.
+    imgObjCache_.Put(key, imgObj, 0);
 }
 
 RefPtr<ImageObject> ImageCache::GetCacheImgObj(const std::string& key)
 {
-    std::scoped_lock lock(cacheImgObjListMutex_, imgObjCacheMutex_);
-    return GetCacheObjWithCountLimitLRU<RefPtr<ImageObject>>(key, cacheImgObjList_, imgObjCache_);
+    return imgObjCache_.Get(key);
+}
+
+void ImageCache::SetSvgDomSizeLimit(size_t sizeLimit)
+{
+    LOGI("Set svg dom size cache limit : %{public}zu", sizeLimit);
+    svgDomCache_.SetSizeLimit(sizeLimit);
+}
+
+void ImageCache::SetSvgRasterSizeLimit(size_t sizeLimit)
+{
+    LOGI("Set svg raster size cache limit : %{public}zu", sizeLimit);
+    svgRasterCache_.SetSizeLimit(sizeLimit);
+}
+
+void ImageCache::CacheSvgDom(const std::string& key, const RefPtr<SvgDom>& svgDom)
+{
+    if (key.empty() || !svgDom) {
+        return;
+    }
+    svgDomCache_.Put(key, svgDom, svgDom->GetParsedSize());
+}
+
+RefPtr<SvgDom> ImageCache::GetCacheSvgDom(const std::string& key)
+{
+    return svgDomCache_.Get(key);
+}
+
+void ImageCache::CacheSvgRaster(const std::string& key, const std::shared_ptr<CachedSvgRaster>& raster)
+{
+    if (key.empty() || !raster) {
+        return;
+    }
+    svgRasterCache_.Put(key, raster, raster->GetSize());
+}
+
+std::shared_ptr<CachedSvgRaster> ImageCache::GetCacheSvgRaster(const std::string& key)
+{
+    return svgRasterCache_.Get(key);
 }
 
 void ImageCache::CacheImageData(const std::string& key, const RefPtr<CachedImageData>& imageData)
@@ -143,59 +198,26 @@ void ImageCache::CacheImageData(const std::string& key, const RefPtr<CachedImage
     if (key.empty() || !imageData || dataSizeLimit_ == 0) {
         return;
     }
-    std::scoped_lock lock(dataCacheListMutex_, imageDataCacheMutex_);
     auto dataSize = imageData->GetSize();
     if (dataSize > (dataSizeLimit_ >> 1)) { // if data is longer than half limit, do not cache it.
         LOGW("data is %{public}d, bigger than half limit %{public}d, do not cache it", static_cast<int32_t>(dataSize),
             static_cast<int32_t>(dataSizeLimit_ >> 1));
         return;
     }
-    auto iter = imageDataCache_.find(key);
-    if (iter == imageDataCache_.end()) {
-        if (!processImageDataCacheInner(dataSize)) {
-            return;
-        }
-        dataCacheList_.emplace_front(key, imageData);
-        imageDataCache_.emplace(key, dataCacheList_.begin());
-    } else {
-        auto oldSize = iter->second->imageDataPtr->GetSize();
-        if (oldSize != dataSize) {
-            curDataSize_ -= oldSize;
-            if (!processImageDataCacheInner(dataSize)) {
-                return;
-            }
-        }
-        iter->second->imageDataPtr = imageData;
-        dataCacheList_.splice(dataCacheList_.begin(), dataCacheList_, iter->second);
-        iter->second = dataCacheList_.begin();
-    }
+    dataCache_.Put(key, imageData, dataSize);
 }
 
-bool ImageCache::processImageDataCacheInner(size_t dataSize)
+RefPtr<CachedImageData> ImageCache::GetCacheImageData(const std::string& key)
 {
-    while (dataSize + curDataSize_ > dataSizeLimit_ && !dataCacheList_.empty()) {
-        curDataSize_ -= dataCacheList_.back().imageDataPtr->GetSize();
-        imageDataCache_.erase(dataCacheList_.back().imageDataKey);
-        dataCacheList_.pop_back();
-    }
-    if (dataSize + curDataSize_ > dataSizeLimit_) {
-        return false;
-    }
-    curDataSize_ += dataSize;
-    return true;
+    return dataCache_.Get(key);
 }
 
-RefPtr<CachedImageData> ImageCache::GetCacheImageData(const std::string& key)
+void ImageCache::ClearMemoryCache()
 {
-    std::scoped_lock lock(dataCacheListMutex_, imageDataCacheMutex_);
-    auto iter = imageDataCache_.find(key);
-    if (iter != imageDataCache_.end()) {
-        dataCacheList_.splice(dataCacheList_.begin(), dataCacheList_, iter->second);
-        iter->second = dataCacheList_.begin();
-        return iter->second->imageDataPtr;
-    } else {
-        return nullptr;
-    }
+    imageCache_.Clear();
+    dataCache_.Clear();
+    svgDomCache_.Clear();
+    svgRasterCache_.Clear();
 }
 
 void ImageCache::WriteCacheFile(const std::string& url, const void* const data, const size_t size)
@@ -18,27 +18,23 @@
 
 #include <algorithm>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
-#include <unordered_map>
+#include <variant>
 #include <vector>
 
 #include "base/log/log.h"
 #include "base/memory/ace_type.h"
 #include "base/utils/macros.h"
+#include "core/image/sharded_clock_cache.h"
 
 namespace OHOS::Ace {
 
 struct CachedImage;
+struct CachedSvgRaster;
 class ImageObject;
-template<typename T>
-struct CacheNode {
-    CacheNode(const std::string& key, const T& obj)
-        : cacheKey(key), cacheObj(obj)
-    {}
-    std::string cacheKey;
-    T cacheObj;
-};
+class SvgDom;
 
 struct CachedImageData : public AceType {
     DECLARE_ACE_TYPE(CachedImageData, AceType);
@@ -49,14 +45,6 @@ public:
     virtual const uint8_t* GetData() = 0;
 };
 
-struct CacheImageDataNode {
-    CacheImageDataNode(const std::string& key, const RefPtr<CachedImageData>& imageData)
-        : imageDataKey(key), imageDataPtr(imageData)
-    {}
-    std::string imageDataKey;
-    RefPtr<CachedImageData> imageDataPtr;
-};
-
 struct FileInfo {
     FileInfo(const std::string& path, size_t size, time_t time)
         : filePath(path), fileSize(size), accessTime(time)
@@ -77,41 +65,105 @@ class ACE_EXPORT ImageCache : public AceType {
 
 public:
     static RefPtr<ImageCache> Create();
-    ImageCache() = default;
-    virtual ~ImageCache() = default;
-    void CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image);
+    ImageCache();
+    ~ImageCache() override;
+    // Size is the bytes of decoded pixels charged against the limit, see GetPixelsSize.
+    void CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image, size_t size);
     std::shared_ptr<CachedImage> GetCacheImage(const std::string& key);
 
+    // Canvas images of NG image provider, in the same cache as CacheImage under the same count and size limits.
+    void CacheCanvasImage(const std::string& key, const RefPtr<AceType>& image, size_t size);
+    RefPtr<AceType> GetCacheCanvasImage(const std::string& key);
+
     void CacheImageData(const std::string& key, const RefPtr<CachedImageData>& imageData);
     RefPtr<CachedImageData> GetCacheImageData(const std::string& key);
 
     void CacheImgObj(const std::string& key, const RefPtr<ImageObject>& imgObj);
     RefPtr<ImageObject> GetCacheImgObj(const std::string& key);
 
+    // Parsed svg doms are never rendered, svg images of the same source and fill color render clones of them.
+    void CacheSvgDom(const std::string& key, const RefPtr<SvgDom>& svgDom);
+    RefPtr<SvgDom> GetCacheSvgDom(const std::string& key);
+
+    // Svg rendered into pixels at the size of the image component.
+    void CacheSvgRaster(const std::string& key, const std::shared_ptr<CachedSvgRaster>& raster);
+    std::shared_ptr<CachedSvgRaster> GetCacheSvgRaster(const std::string& key);
+
     static void SetCacheFileInfo();
     static void WriteCacheFile(const std::string& url, const void * const data, const size_t size);
 
-    void SetCapacity(size_t capacity)
+    void SetCapacity(size_t capacity);
+
+    // Limit of decoded pixels in bytes, a big image takes as much of the cache as many small icons.
+    void SetImageSizeLimit(size_t sizeLimit);
+
+    void SetSvgDomSizeLimit(size_t sizeLimit);
+    void SetSvgRasterSizeLimit(size_t sizeLimit);
+
+    size_t GetSvgRasterSizeLimit() const
     {
-        LOGI("Set Capacity : %{public}d", static_cast<int32_t>(capacity));
-        capacity_ = capacity;
+        return svgRasterCache_.GetSizeLimit();
     }
 
     void SetDataCacheLimit(size_t sizeLimit)
     {
         LOGI("Set data size cache limit : %{public}d", static_cast<int32_t>(sizeLimit));
         dataSizeLimit_ = sizeLimit;
+        dataCache_.SetSizeLimit(sizeLimit);
     }
 
     size_t GetCapacity() const
     {
-        return capacity_;
+        return imageCache_.GetCountLimit();
+    }
+
+    size_t GetImageSizeLimit() const
+    {
+        return imageCache_.GetSizeLimit();
     }
 
     size_t GetCachedImageCount() const
     {
-        std::lock_guard<std::mutex> lock(cacheListMutex_);
-        return cacheList_.size();
+        return imageCache_.GetCount();
+    }
+
+    size_t GetCachedImageSize() const
+    {
+        return imageCache_.GetSize();
+    }
+
+    size_t GetCachedDataSize() const
+    {
+        return dataCache_.GetSize();
+    }
+
+    ImageCacheStats GetImageCacheStats() const
+    {
+        return imageCache_.GetStats();
+    }
+
+    ImageCacheStats GetDataCacheStats() const
+    {
+        return dataCache_.GetStats();
+    }
+
+    ImageCacheStats GetSvgDomCacheStats() const
+    {
+        return svgDomCache_.GetStats();
+    }
+
+    ImageCacheStats GetSvgRasterCacheStats() const
+    {
+        return svgRasterCache_.GetStats();
+    }
+
+    // Decoded images are charged as RGBA pixels.
+    static size_t GetPixelsSize(int32_t width, int32_t height)
+    {
+        if (width <= 0 || height <= 0) {
+            return 0;
+        }
+        return static_cast<size_t>(width) * static_cast<size_t>(height) * BYTES_PER_PIXEL;
     }
 
     static void SetImageCacheFilePath(const std::string& cacheFilePath)
@@ -171,48 +223,26 @@ public:
     static void Purge();
 
 protected:
-    static void ClearCacheFile(const std::vector<std::string>& removeFiles);
+    static constexpr size_t BYTES_PER_PIXEL = 4;
 
-    template<typename T>
-    static void CacheWithCountLimitLRU(
-        const std::string& key,
-        const T& cacheObj,
-        std::list<CacheNode<T>>& cacheList,
-        std::unordered_map<std::string, typename std::list<CacheNode<T>>::iterator>& cache,
-        const std::atomic<size_t>& capacity);
-
-    template<typename T>
-    static T GetCacheObjWithCountLimitLRU(
-        const std::string& key,
-        std::list<CacheNode<T>>& cacheList,
-        std::unordered_map<std::string, typename std::list<CacheNode<T>>::iterator>& cache);
+    static void ClearCacheFile(const std::vector<std::string>& removeFiles);
 
     static bool GetFromCacheFileInner(const std::string& filePath);
 
-    bool processImageDataCacheInner(size_t dataSize);
-
-    mutable std::mutex cacheListMutex_;
-    std::list<CacheNode<std::shared_ptr<CachedImage>>> cacheList_;
-
-    std::mutex imageCacheMutex_;
-    std::unordered_map<std::string, std::list<CacheNode<std::shared_ptr<CachedImage>>>::iterator> imageCache_;
-
-    std::atomic<size_t> capacity_ = 0; // by default memory cache can store 0 images.
+    // Release all cached images and data.
+    void ClearMemoryCache();
 
-    mutable std::mutex dataCacheListMutex_;
-    std::list<CacheImageDataNode> dataCacheList_;
+    // Decoded image of the old pipeline or canvas image of NG.
+    using DecodedImage = std::variant<std::shared_ptr<CachedImage>, RefPtr<AceType>>;
+    ShardedClockCache<DecodedImage> imageCache_;
 
-    std::mutex imageDataCacheMutex_;
-    std::unordered_map<std::string, std::list<CacheImageDataNode>::iterator> imageDataCache_;
+    std::atomic<size_t> dataSizeLimit_ = 0; // by default, image data before decoded cache is 0 MB.
+    ShardedClockCache<RefPtr<CachedImageData>> dataCache_;
 
-    std::atomic<size_t> dataSizeLimit_ = 0; // by default, image data before decoded cache is 0 MB.;
-    std::atomic<size_t> curDataSize_ = 0;
+    ShardedClockCache<RefPtr<ImageObject>> imgObjCache_; // imgObj is cached after clear image data.
 
-    std::mutex cacheImgObjListMutex_;
-    std::list<CacheNode<RefPtr<ImageObject>>> cacheImgObjList_;
-    std::mutex imgObjCacheMutex_;
-    std::unordered_map<std::string, std::list<CacheNode<RefPtr<ImageObject>>>::iterator> imgObjCache_;
-    std::atomic<size_t> imgObjCapacity_ = 2000; // imgObj is cached after clear image data.
+    ShardedClockCache<RefPtr<SvgDom>> svgDomCache_;
+    ShardedClockCache<std::shared_ptr<CachedSvgRaster>> svgRasterCache_;
 
     static std::shared_mutex cacheFilePathMutex_;
     static std::string cacheFilePath_;
@@ -34,6 +34,44 @@ std::string ImageObject::GenerateCacheKey(const ImageSourceInfo& srcInfo, Size t
            std::to_string(static_cast<int32_t>(targetImageSize.Height()));
 }
 
+std::string ImageObject::GenerateSvgCacheKey(const ImageSourceInfo& srcInfo, const Size& targetSize)
+{
+    // data of memory source can be updated with the same uri.
+    if (!srcInfo.IsSvg() || srcInfo.GetSrcType() == SrcType::MEMORY) {
+        return "";
+    }
+    auto key = srcInfo.ToString();
+    auto fillColor = srcInfo.GetFillColor();
+    if (fillColor.has_value()) {
+        key += "fill" + fillColor.value().ColorToString();
+    }
+    if (targetSize.IsValid() && !targetSize.IsInfinite()) {
+        key += "size" + std::to_string(static_cast<int32_t>(targetSize.Width())) + "x" +
+               std::to_string(static_cast<int32_t>(targetSize.Height()));
+    }
+    return key;
+}
+
+RefPtr<ImageObject> ImageObject::QuerySvgImageObjectFromCache(
+    const ImageSourceInfo& source, const RefPtr<PipelineBase>& context)
+{
+#ifdef NG_BUILD
+    return nullptr;
+#else
+    auto key = GenerateSvgCacheKey(source);
+    if (key.empty() || !context) {
+        return nullptr;
+    }
+    auto imageCache = context->GetImageCache();
+    if (!imageCache) {
+        return nullptr;
+    }
+    auto parsedDom = imageCache->GetCacheSvgDom(key);
+    auto svgDom = parsedDom ? parsedDom->Clone() : nullptr;
+    return svgDom ? MakeRefPtr<SvgImageObject>(source, Size(), 1, svgDom) : nullptr;
+#endif
+}
+
 RefPtr<ImageObject> ImageObject::BuildImageObject(
     ImageSourceInfo source, const RefPtr<PipelineBase> context, const sk_sp<SkData>& skData, bool useSkiaSvg)
 {
@@ -49,7 +87,21 @@ RefPtr<ImageObject> ImageObject::BuildImageObject(
         auto color = source.GetFillColor();
         if (!useSkiaSvg) {
             auto svgDom = SvgDom::CreateSvgDom(*svgStream, DynamicCast<PipelineContext>(context), color);
-            return svgDom ? MakeRefPtr<SvgImageObject>(source, Size(), 1, svgDom) : nullptr;
+            if (!svgDom) {
+                return nullptr;
+            }
+            // the parsed dom is kept in cache and never rendered, animated svg is not shared as animators of the
+            // nodes are started by the render tree.
+            auto imageCache = context ? context->GetImageCache() : nullptr;
+            auto key = GenerateSvgCacheKey(source);
+            if (imageCache && !key.empty() && !svgDom->HasAnimate()) {
+                auto clonedDom = svgDom->Clone();
+                if (clonedDom) {
+                    imageCache->CacheSvgDom(key, svgDom);
+                    svgDom = clonedDom;
+                }
+            }
+            return MakeRefPtr<SvgImageObject>(source, Size(), 1, svgDom);
         } else {
             uint64_t colorValue = 0;
             if (color.has_value()) {
@@ -186,7 +238,8 @@ void StaticImageObject::UploadToGpuForRender(const WeakPtr<PipelineBase>& contex
 #endif
             if (imageCache) {
                 LOGD("cache image key: %{public}s", key.c_str());
-                imageCache->CacheImage(key, std::make_shared<CachedImage>(canvasImage));
+                auto cachedImage = std::make_shared<CachedImage>(canvasImage);
+                imageCache->CacheImage(key, cachedImage, cachedImage->GetSize());
             }
             ImageProvider::ProccessUploadResult(taskExecutor, imageSource, imageSize, canvasImage);
         };
@@ -48,6 +48,11 @@ public:
     virtual ~ImageObject() = default;
 
     static std::string GenerateCacheKey(const ImageSourceInfo& srcInfo, Size targetSize);
+    // Key of svg caches, the size is added for the raster of svg. Returns empty key if the svg can't be cached.
+    static std::string GenerateSvgCacheKey(const ImageSourceInfo& srcInfo, const Size& targetSize = Size());
+    // Returns svg image object which shares the parsed svg dom of the same source, nullptr if it is not parsed yet.
+    static RefPtr<ImageObject> QuerySvgImageObjectFromCache(
+        const ImageSourceInfo& source, const RefPtr<PipelineBase>& context);
 
     Size GetImageSize()
     {
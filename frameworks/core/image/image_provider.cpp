@@ -15,11 +15,15 @@
 
 #include "core/image/image_provider.h"
 
+#include <cmath>
+
 #ifndef NG_BUILD
 #include "experimental/svg/model/SkSVGDOM.h"
 #endif
+#include "third_party/skia/include/core/SkCanvas.h"
 #include "third_party/skia/include/core/SkGraphics.h"
 #include "third_party/skia/include/core/SkStream.h"
+#include "third_party/skia/include/core/SkSurface.h"
 
 #include "base/thread/background_task_executor.h"
 #include "core/common/container.h"
@@ -234,6 +238,13 @@ RefPtr<ImageObject> ImageProvider::QueryImageObjectFromCache(
 RefPtr<ImageObject> ImageProvider::GeneratorAceImageObject(
     const ImageSourceInfo& imageInfo, const RefPtr<PipelineBase> context, bool useSkiaSvg)
 {
+    if (imageInfo.IsSvg() && !useSkiaSvg) {
+        // svg of the same source has been parsed, skip loading and parsing the data again.
+        auto svgImageObject = ImageObject::QuerySvgImageObjectFromCache(imageInfo, context);
+        if (svgImageObject) {
+            return svgImageObject;
+        }
+    }
     auto imageData = LoadImageRawData(imageInfo, context);
 
     if (!imageData) {
@@ -361,6 +372,55 @@ void ImageProvider::GetSVGImageDOMAsyncFromData(const sk_sp<SkData>& skData,
     }
     BackgroundTaskExecutor::GetInstance().PostTask(cancelableTask);
 }
+
+bool ImageProvider::DrawSvgRaster(SkCanvas* canvas, const ImageSourceInfo& imageInfo,
+    const sk_sp<SkSVGDOM>& skiaDom, const Size& size, const WeakPtr<PipelineBase>& context)
+{
+    auto pipelineContext = context.Upgrade();
+    if (!canvas || !skiaDom || !pipelineContext) {
+        return false;
+    }
+    // a scaled, rotated or flipped raster would be resampled, the svg is drawn as vectors then.
+    const auto& matrix = canvas->getTotalMatrix();
+    if (!matrix.isTranslate()) {
+        return false;
+    }
+    auto imageCache = pipelineContext->GetImageCache();
+    // the canvas is only translated, so the size is in device pixels.
+    auto width = static_cast<int32_t>(std::ceil(size.Width()));
+    auto height = static_cast<int32_t>(std::ceil(size.Height()));
+    auto key = ImageObject::GenerateSvgCacheKey(imageInfo, Size(width, height));
+    if (!imageCache || key.empty()) {
+        return false;
+    }
+    sk_sp<SkImage> image;
+    auto raster = imageCache->GetCacheSvgRaster(key);
+    if (raster) {
+        image = raster->image;
+    } else {
+        // a big svg would be rendered again and again as its raster is evicted soon.
+        if (ImageCache::GetPixelsSize(width, height) > (imageCache->GetSvgRasterSizeLimit() >> 1)) {
+            return false;
+        }
+        auto surface = SkSurface::MakeRasterN32Premul(width, height);
+        if (!surface) {
+            LOGW("create surface failed, svg raster size: %{public}d x %{public}d", width, height);
+            return false;
+        }
+        skiaDom->setContainerSize({ size.Width(), size.Height() });
+        skiaDom->render(surface->getCanvas());
+        image = surface->makeImageSnapshot();
+        if (!image) {
+            return false;
+        }
+        imageCache->CacheSvgRaster(key, std::make_shared<CachedSvgRaster>(image));
+    }
+    // align the raster to the pixel grid of device.
+    auto dx = std::round(matrix.getTranslateX()) - matrix.getTranslateX();
+    auto dy = std::round(matrix.getTranslateY()) - matrix.getTranslateY();
+    canvas->drawImage(image, dx, dy);
+    return true;
+}
 #endif
 
 void ImageProvider::UploadImageToGPUForRender(const sk_sp<SkImage>& image,
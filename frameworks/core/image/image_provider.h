@@ -37,6 +37,7 @@
 #include "core/components_ng/render/canvas_image.h"
 #endif
 
+class SkCanvas;
 class SkSVGDOM;
 namespace OHOS::Ace {
 
@@ -106,6 +107,12 @@ public:
         const WeakPtr<PipelineBase> context,
         uint64_t svgThemeColor = 0,
         OnPostBackgroundTask onBackgroundTaskPostCallback = nullptr);
+
+    // Draw the raster of svg at the size from cache, the svg is rendered and cached if it is missed. The raster is
+    // keyed by device pixels and only drawn when the canvas is translated, returns false if it is not drawn, the svg
+    // should be drawn as vectors then.
+    static bool DrawSvgRaster(SkCanvas* canvas, const ImageSourceInfo& imageInfo, const sk_sp<SkSVGDOM>& skiaDom,
+        const Size& size, const WeakPtr<PipelineBase>& context);
 #endif
 
     // upload image data to gpu context for painting asynchronously.
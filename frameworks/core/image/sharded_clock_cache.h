@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_SHARDED_CLOCK_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_SHARDED_CLOCK_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+struct ImageCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t insertions = 0;
+    uint64_t evictions = 0;
+    size_t count = 0;
+    size_t size = 0;
+};
+
+// Thread safe cache limited by both total size in bytes and item count. Items are spread over shards by the hash of
+// the key, so threads loading different images rarely contend, and each call takes only one shard lock.
+// Items are evicted by CLOCK: a hit marks the item as referenced, the clock hand of a shard skips and clears
+// referenced items. New items are inserted unreferenced, so a single pass over a long list of images evicts the new
+// images first instead of the images which are shown again and again.
+template<typename T>
+class ShardedClockCache final {
+public:
+    ShardedClockCache() = default;
+    ~ShardedClockCache() = default;
+
+    void SetSizeLimit(size_t sizeLimit)
+    {
+        sizeLimit_ = sizeLimit;
+        Trim();
+    }
+
+    size_t GetSizeLimit() const
+    {
+        return sizeLimit_;
+    }
+
+    void SetCountLimit(size_t countLimit)
+    {
+        countLimit_ = countLimit;
+        Trim();
+    }
+
+    size_t GetCountLimit() const
+    {
+        return countLimit_;
+    }
+
+    // Insert or replace the item of key, returns false if the item is bigger than the size limit.
+    bool Put(const std::string& key, const T& value, size_t size)
+    {
+        if (countLimit_ == 0 || size > sizeLimit_) {
+            return false;
+        }
+        T oldValue {};
+        {
+            auto& shard = shards_[GetShardIndex(key)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto iter = shard.index.find(key);
+            if (iter != shard.index.end()) {
+                auto& entry = shard.entries[iter->second];
+                oldValue = std::move(entry.value);
+                entry.value = value;
+                size_ += size;
+                size_ -= entry.size;
+                entry.size = size;
+                entry.referenced = true;
+            } else {
+                size_t slot = shard.AllocateSlot();
+                auto& entry = shard.entries[slot];
+                entry.key = key;
+                entry.value = value;
+                entry.size = size;
+                entry.referenced = false;
+                entry.occupied = true;
+                shard.index.emplace(key, slot);
+                size_ += size;
+                ++count_;
+                ++shard.insertions;
+            }
+        }
+        Trim();
+        return true;
+    }
+
+    // Returns default value of T if the key is not cached.
+    T Get(const std::string& key)
+    {
+        auto& shard = shards_[GetShardIndex(key)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.index.find(key);
+        if (iter == shard.index.end()) {
+            ++shard.misses;
+            return T {};
+        }
+        ++shard.hits;
+        auto& entry = shard.entries[iter->second];
+        entry.referenced = true;
+        return entry.value;
+    }
+
+    void Clear()
+    {
+        for (auto& shard : shards_) {
+            // Release the items out of lock.
+            std::vector<Entry> entries;
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                for (const auto& entry : shard.entries) {
+                    if (entry.occupied) {
+                        size_ -= entry.size;
+                        --count_;
+                    }
+                }
+                entries.swap(shard.entries);
+                shard.index.clear();
+                shard.freeSlots.clear();
+                shard.hand = 0;
+            }
+        }
+    }
+
+    size_t GetCount() const
+    {
+        return count_;
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+    ImageCacheStats GetStats() const
+    {
+        ImageCacheStats stats;
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            stats.hits += shard.hits;
+            stats.misses += shard.misses;
+            stats.insertions += shard.insertions;
+            stats.evictions += shard.evictions;
+        }
+        stats.count = count_;
+        stats.size = size_;
+        return stats;
+    }
+
+private:
+    static constexpr size_t SHARD_COUNT = 8;
+
+    struct Entry {
+        std::string key;
+        T value {};
+        size_t size = 0;
+        bool referenced = false;
+        bool occupied = false;
+    };
+
+    struct Shard {
+        size_t AllocateSlot()
+        {
+            if (freeSlots.empty()) {
+                entries.emplace_back();
+                return entries.size() - 1;
+            }
+            size_t slot = freeSlots.back();
+            freeSlots.pop_back();
+            return slot;
+        }
+
+        mutable std::mutex mutex;
+        std::vector<Entry> entries;
+        std::vector<size_t> freeSlots;
+        std::unordered_map<std::string, size_t> index;
+        size_t hand = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t insertions = 0;
+        uint64_t evictions = 0;
+    };
+
+    static size_t GetShardIndex(const std::string& key)
+    {
+        return std::hash<std::string> {}(key) % SHARD_COUNT;
+    }
+
+    bool OverLimit() const
+    {
+        return size_ > sizeLimit_ || count_ > countLimit_;
+    }
+
+    // Evict items from shards in turn until the cache is under limit. The shard cursor is shared, so the items just
+    // inserted are not always the first victims when the shards are small. A shard whose items are all referenced is
+    // skipped with its referenced bits cleared, so the second round over the shards always finds a victim.
+    void Trim()
+    {
+        size_t idleShards = 0;
+        while (OverLimit() && idleShards < SHARD_COUNT * 2) {
+            T evicted {};
+            if (EvictOne(shards_[trimCursor_++ % SHARD_COUNT], evicted)) {
+                idleShards = 0;
+            } else {
+                ++idleShards;
+            }
+        }
+    }
+
+    // Sweep the clock hand of the shard for one round at most, returns false if every item is referenced.
+    bool EvictOne(Shard& shard, T& evicted)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.index.empty() || !OverLimit()) {
+            return false;
+        }
+        size_t slotCount = shard.entries.size();
+        for (size_t step = 0; step < slotCount; ++step) {
+            size_t slot = shard.hand;
+            auto& entry = shard.entries[slot];
+            shard.hand = (slot + 1) % slotCount;
+            if (!entry.occupied) {
+                continue;
+            }
+            if (entry.referenced) {
+                entry.referenced = false;
+                continue;
+            }
+            evicted = std::move(entry.value);
+            entry.value = T {};
+            shard.index.erase(entry.key);
+            entry.key.clear();
+            entry.occupied = false;
+            shard.freeSlots.emplace_back(slot);
+            size_ -= entry.size;
+            --count_;
+            ++shard.evictions;
+            return true;
+        }
+        return false;
+    }
+
+    std::array<Shard, SHARD_COUNT> shards_;
+    std::atomic<size_t> sizeLimit_ = SIZE_MAX;
+    std::atomic<size_t> countLimit_ = SIZE_MAX;
+    std::atomic<size_t> size_ = 0;
+    std::atomic<size_t> count_ = 0;
+    std::atomic<size_t> trimCursor_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ShardedClockCache);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_SHARDED_CLOCK_CACHE_H
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkData.h"
+
+#define private public
+#include "core/image/animated_image_player.h"
+#undef private
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t FRAME_COUNT = 6;
+constexpr uint16_t SMALL_SCREEN_SIZE = 1;
+// frames of this screen take more bytes than the budget of look-ahead.
+constexpr uint16_t LARGE_SCREEN_SIZE = 4096;
+constexpr std::chrono::seconds LOOK_AHEAD_TIMEOUT(5);
+
+void AppendShort(std::vector<uint8_t>& data, uint16_t value)
+{
+    data.emplace_back(static_cast<uint8_t>(value & 0xff));
+    data.emplace_back(static_cast<uint8_t>(value >> 8));
+}
+
+// Gif of the screen size which loops forever, every frame is a single black pixel at the origin shown for 100ms.
+sk_sp<SkData> CreateAnimatedGif(uint16_t screenSize, int32_t frameCount)
+{
+    std::vector<uint8_t> gif = { 'G', 'I', 'F', '8', '9', 'a' };
+    AppendShort(gif, screenSize);
+    AppendShort(gif, screenSize);
+    // global color table of 2 colors, black and white.
+    gif.insert(gif.end(), { 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff });
+    gif.insert(gif.end(), { 0x21, 0xff, 0x0b, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0', 0x03, 0x01,
+                              0x00, 0x00, 0x00 });
+    for (int32_t index = 0; index < frameCount; ++index) {
+        // graphic control extension with the delay in 10ms.
+        gif.insert(gif.end(), { 0x21, 0xf9, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00 });
+        // image descriptor of 1 x 1 at the origin, and the pixel compressed by LZW.
+        gif.insert(gif.end(), { 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00 });
+        gif.insert(gif.end(), { 0x02, 0x02, 0x44, 0x01, 0x00 });
+    }
+    gif.emplace_back(0x3b);
+    return SkData::MakeWithCopy(gif.data(), gif.size());
+}
+
+RefPtr<AnimatedImagePlayer> CreatePlayer(uint16_t screenSize)
+{
+    auto codec = SkCodec::MakeFromData(CreateAnimatedGif(screenSize, FRAME_COUNT));
+    if (!codec) {
+        return nullptr;
+    }
+    // without pipeline, the player does not animate, frames are decoded by the tests.
+    return AceType::MakeRefPtr<AnimatedImagePlayer>(ImageSourceInfo(), nullptr, WeakPtr<PipelineBase>(),
+        fml::WeakPtr<flutter::IOManager>(), nullptr, std::move(codec));
+}
+
+void WaitForLookAhead(const RefPtr<AnimatedImagePlayer>& player)
+{
+    auto deadline = std::chrono::steady_clock::now() + LOOK_AHEAD_TIMEOUT;
+    while (player->lookAheadPosted_ && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_FALSE(player->lookAheadPosted_);
+}
+
+} // namespace
+
+class AnimatedImagePlayerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() {}
+    void TearDown() {}
+};
+
+/**
+ * @tc.name: FrameBuffer001
+ * @tc.desc: decoded frames are kept in a ring, the oldest frame is replaced when the ring is full.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatedImagePlayerTest, FrameBuffer001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a player of small frames.
+     * @tc.expected: the ring has slots for the rendering frame, its prior frame and the frames decoded ahead.
+     */
+    auto player = CreatePlayer(SMALL_SCREEN_SIZE);
+    ASSERT_NE(player, nullptr);
+    ASSERT_EQ(player->frameSlots_.size(), 5u);
+    ASSERT_EQ(player->lookAheadCount_.load(), 3);
+
+    /**
+     * @tc.steps: step2. decode every frame once.
+     * @tc.expected: the first frame is replaced by the last one, and the ring wraps to its second slot.
+     */
+    std::lock_guard<std::mutex> lock(player->decodeMutex_);
+    for (int32_t index = 0; index < FRAME_COUNT; ++index) {
+        ASSERT_NE(player->DecodeFrame(index), nullptr) << "index = " << index;
+    }
+    EXPECT_EQ(player->FindFrame(0), nullptr);
+    for (int32_t index = 1; index < FRAME_COUNT; ++index) {
+        EXPECT_NE(player->FindFrame(index), nullptr) << "index = " << index;
+    }
+    EXPECT_EQ(player->nextFrameSlot_, 1u);
+}
+
+/**
+ * @tc.name: FrameBuffer002
+ * @tc.desc: frames are decoded on demand when the budget is used up or the frame buffers are released.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatedImagePlayerTest, FrameBuffer002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a player of frames bigger than the budget.
+     * @tc.expected: no bytes are reserved, and the ring keeps the rendering frame and its prior frame only.
+     */
+    auto largePlayer = CreatePlayer(LARGE_SCREEN_SIZE);
+    ASSERT_NE(largePlayer, nullptr);
+    EXPECT_EQ(largePlayer->reservedFrameBytes_, 0u);
+    EXPECT_EQ(largePlayer->lookAheadCount_.load(), 0);
+    EXPECT_EQ(largePlayer->frameSlots_.size(), 2u);
+
+    /**
+     * @tc.steps: step2. decode frames of a player of small frames, then release the frame buffers.
+     * @tc.expected: the decoded frames and the reserved bytes are dropped, look-ahead is off.
+     */
+    auto player = CreatePlayer(SMALL_SCREEN_SIZE);
+    ASSERT_NE(player, nullptr);
+    ASSERT_GT(player->reservedFrameBytes_, 0u);
+    {
+        std::lock_guard<std::mutex> lock(player->decodeMutex_);
+        for (int32_t index = 0; index < 3; ++index) {
+            ASSERT_NE(player->DecodeFrame(index), nullptr);
+        }
+    }
+    AnimatedImagePlayer::ReleaseFrameBuffers();
+    EXPECT_EQ(player->reservedFrameBytes_, 0u);
+    EXPECT_EQ(player->lookAheadCount_.load(), 0);
+    ASSERT_EQ(player->frameSlots_.size(), 2u);
+
+    /**
+     * @tc.steps: step3. decode frames after the release.
+     * @tc.expected: frames are still decoded, and only the last two are kept.
+     */
+    std::lock_guard<std::mutex> lock(player->decodeMutex_);
+    EXPECT_EQ(player->FindFrame(2), nullptr);
+    for (int32_t index = 3; index < FRAME_COUNT; ++index) {
+        ASSERT_NE(player->DecodeFrame(index), nullptr) << "index = " << index;
+    }
+    EXPECT_EQ(player->FindFrame(3), nullptr);
+    EXPECT_NE(player->FindFrame(4), nullptr);
+    EXPECT_NE(player->FindFrame(5), nullptr);
+}
+
+/**
+ * @tc.name: LookAhead001
+ * @tc.desc: frames after the rendering one are decoded on background threads, and a pending look-ahead stops when
+ *           look-ahead is turned off.
+ * @tc.type: FUNC
+ */
+HWTEST_F(AnimatedImagePlayerTest, LookAhead001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. post look-ahead of frame 0.
+     * @tc.expected: frames 1 to 3 are decoded.
+     */
+    auto player = CreatePlayer(SMALL_SCREEN_SIZE);
+    ASSERT_NE(player, nullptr);
+    player->PostLookAheadTask(0);
+    WaitForLookAhead(player);
+    {
+        std::lock_guard<std::mutex> lock(player->decodeMutex_);
+        for (int32_t index = 1; index <= 3; ++index) {
+            EXPECT_NE(player->FindFrame(index), nullptr) << "index = " << index;
+        }
+    }
+
+    /**
+     * @tc.steps: step2. post look-ahead of frame 3 while the frames are locked, and turn look-ahead off before it gets
+     *            the lock, as the frame buffers are released.
+     * @tc.expected: the pending look-ahead decodes no frame, the frames decoded before are kept.
+     */
+    std::unique_lock<std::mutex> lock(player->decodeMutex_);
+    player->PostLookAheadTask(3);
+    EXPECT_TRUE(player->lookAheadPosted_);
+    player->lookAheadCount_ = 0;
+    lock.unlock();
+    WaitForLookAhead(player);
+    lock.lock();
+    for (int32_t index = 1; index <= 3; ++index) {
+        EXPECT_NE(player->FindFrame(index), nullptr) << "index = " << index;
+    }
+    EXPECT_EQ(player->FindFrame(4), nullptr);
+    EXPECT_EQ(player->FindFrame(5), nullptr);
+}
+
+} // namespace OHOS::Ace
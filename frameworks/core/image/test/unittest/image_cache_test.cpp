@@ -15,7 +15,10 @@
 
 #include "core/image/test/unittest/image_cache_test.h"
 
+#include <thread>
+
 #include "gtest/gtest.h"
+#include "third_party/skia/include/core/SkSurface.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -37,34 +40,35 @@ public:
 
 /**
  * @tc.name: MemoryCache001
- * @tc.desc: new image success insert into cache with LRU.
+ * @tc.desc: new image success insert into cache, cache the same key again replaces the image.
  * @tc.type: FUNC
  */
 HWTEST_F(ImageCacheTest, MemoryCache001, TestSize.Level1)
 {
     /**
      * @tc.steps: step1. cache images one by one.
-     * @tc.expected: new item should at begin of cacheList_ and imagCache has right iters.
+     * @tc.expected: every image can be found by its key.
      */
     for (size_t i = 0; i < CACHE_FILES.size(); i++) {
-        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
-        std::string frontKey = (imageCache->cacheList_).front().cacheKey;
-        ASSERT_EQ(frontKey, FILE_KEYS[i]);
-        ASSERT_EQ(frontKey, imageCache->imageCache_[FILE_KEYS[i]]->cacheKey);
+        auto image = std::make_shared<CachedImage>(flutter::CanvasImage::Create());
+        imageCache->CacheImage(FILE_KEYS[i], image, image->GetSize());
+        ASSERT_EQ(imageCache->GetCachedImageCount(), i + 1);
+        ASSERT_EQ(imageCache->GetCacheImage(FILE_KEYS[i]), image);
     }
 
     /**
      * @tc.steps: step2. cache a image already in cache for example FILE_KEYS[3] e.t. "key4".
-     * @tc.expected: the cached item should at begin of cacheList_ and imagCache has right iters.
+     * @tc.expected: the cached image is replaced and count is not changed.
      */
-    imageCache->CacheImage(FILE_KEYS[3], std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
-    ASSERT_EQ(imageCache->cacheList_.front().cacheKey, FILE_KEYS[3]);
-    ASSERT_EQ(imageCache->imageCache_[FILE_KEYS[3]]->cacheKey, FILE_KEYS[3]);
+    auto newImage = std::make_shared<CachedImage>(flutter::CanvasImage::Create());
+    imageCache->CacheImage(FILE_KEYS[3], newImage, newImage->GetSize());
+    ASSERT_EQ(imageCache->GetCacheImage(FILE_KEYS[3]), newImage);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), CACHE_FILES.size());
 }
 
 /**
  * @tc.name: MemoryCache002
- * @tc.desc: get image success in cache with LRU.
+ * @tc.desc: get image success in cache, hits and misses are counted.
  * @tc.type: FUNC
  */
 HWTEST_F(ImageCacheTest, MemoryCache002, TestSize.Level1)
@@ -73,26 +77,25 @@ HWTEST_F(ImageCacheTest, MemoryCache002, TestSize.Level1)
      * @tc.steps: step1. cache images one by one.
      */
     for (size_t i = 0; i < CACHE_FILES.size(); i++) {
-        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(flutter::CanvasImage::Create()));
-        std::string frontKey = (imageCache->cacheList_).front().cacheKey;
+        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(flutter::CanvasImage::Create()), 0);
     }
     /**
      * @tc.steps: step2. find a image already in cache for example FILE_KEYS[2] e.t. "key3".
-     * @tc.expected: the cached iterator should not at end() of cacheList_ and imagCache.
-     *              after GetImageCache(), the item should at begin() of cacheList_.
+     * @tc.expected: the image is found and counted as a hit.
      */
-    auto iter = (imageCache->imageCache_).find(FILE_KEYS[2]);
-    ASSERT_NE(iter, imageCache->imageCache_.end());
-    imageCache->GetCacheImage(FILE_KEYS[2]);
-    ASSERT_EQ(imageCache->cacheList_.front().cacheKey, FILE_KEYS[2]);
-    ASSERT_EQ(imageCache->imageCache_[FILE_KEYS[2]]->cacheKey, FILE_KEYS[2]);
+    ASSERT_NE(imageCache->GetCacheImage(FILE_KEYS[2]), nullptr);
 
     /**
      * @tc.steps: step3. find a image not in cache for example "key8".
-     * @tc.expected: return null.
+     * @tc.expected: return null and counted as a miss.
      */
     auto image = imageCache->GetCacheImage("key8");
     ASSERT_EQ(image, nullptr);
+    auto stats = imageCache->GetImageCacheStats();
+    ASSERT_EQ(stats.hits, 1u);
+    ASSERT_EQ(stats.misses, 1u);
+    ASSERT_EQ(stats.insertions, CACHE_FILES.size());
+    ASSERT_EQ(stats.count, CACHE_FILES.size());
 }
 
 /**
@@ -107,12 +110,23 @@ HWTEST_F(ImageCacheTest, MemoryCache003, TestSize.Level1)
      * @tc.expected: capacity set to 1000.
      */
     imageCache->SetCapacity(1000);
-    ASSERT_EQ(static_cast<int32_t>(imageCache->capacity_), 1000);
+    ASSERT_EQ(static_cast<int32_t>(imageCache->GetCapacity()), 1000);
+
+    /**
+     * @tc.steps: step2. cache more images than capacity 2.
+     * @tc.expected: images are evicted to the capacity.
+     */
+    imageCache->SetCapacity(2);
+    for (size_t i = 0; i < CACHE_FILES.size(); i++) {
+        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(flutter::CanvasImage::Create()), 0);
+    }
+    ASSERT_EQ(imageCache->GetCachedImageCount(), 2u);
+    ASSERT_EQ(imageCache->GetImageCacheStats().evictions, CACHE_FILES.size() - 2);
 }
 
 /**
  * @tc.name: MemoryCache004
- * @tc.desc: memory cache of image data.
+ * @tc.desc: memory cache of image data is limited by bytes.
  * @tc.type: FUNC
  */
 HWTEST_F(ImageCacheTest, MemoryCache004, TestSize.Level1)
@@ -121,28 +135,28 @@ HWTEST_F(ImageCacheTest, MemoryCache004, TestSize.Level1)
      * @tc.steps: step1. set data limit to 10 bytes, cache some data.check result
      * @tc.expected: result is right.
      */
-    imageCache->dataSizeLimit_ = 10;
+    imageCache->SetDataCacheLimit(10);
 
     // create 3 bytes data, cache it, current size is 3
     const uint8_t data1[] = {'a', 'b', 'c' };
     sk_sp<SkData> skData1 = SkData::MakeWithCopy(data1, 3);
     auto cachedData1 = AceType::MakeRefPtr<SkiaCachedImageData>(skData1);
     imageCache->CacheImageData(KEY_1, cachedData1);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
+    ASSERT_EQ(imageCache->GetCachedDataSize(), 3u);
 
     // create 2 bytes data, cache it, current size is 5. {abc} {de}
     const uint8_t data2[] = {'d', 'e' };
     sk_sp<SkData> skData2 = SkData::MakeWithCopy(data2, 2);
     auto cachedData2 = AceType::MakeRefPtr<SkiaCachedImageData>(skData2);
     imageCache->CacheImageData(KEY_2, cachedData2);
-    ASSERT_EQ(imageCache->curDataSize_, 5u);
+    ASSERT_EQ(imageCache->GetCachedDataSize(), 5u);
 
-    // create 7 bytes data, cache it, current size is 5. new data not cached.
+    // create 7 bytes data, bigger than half limit, current size is 5. new data not cached.
     const uint8_t data3[] = { 'f', 'g', 'h', 'i', 'j', 'k', 'l' };
     sk_sp<SkData> skData3 = SkData::MakeWithCopy(data3, 7);
     auto cachedData3 = AceType::MakeRefPtr<SkiaCachedImageData>(skData3);
     imageCache->CacheImageData(KEY_3, cachedData3);
-    ASSERT_EQ(imageCache->curDataSize_, 5u);
+    ASSERT_EQ(imageCache->GetCachedDataSize(), 5u);
     auto data = imageCache->GetCacheImageData(KEY_3);
     ASSERT_EQ(data, nullptr);
 
@@ -151,49 +165,237 @@ HWTEST_F(ImageCacheTest, MemoryCache004, TestSize.Level1)
     sk_sp<SkData> skData4 = SkData::MakeWithCopy(data4, 5);
     auto cachedData4 = AceType::MakeRefPtr<SkiaCachedImageData>(skData4);
     imageCache->CacheImageData(KEY_4, cachedData4);
-    ASSERT_EQ(imageCache->curDataSize_, 10u);
+    ASSERT_EQ(imageCache->GetCachedDataSize(), 10u);
 
-    // create 2 bytes data, cache it, current size is 9 {de}{mnopq}{rs}
+    // use {abc} and {mnopq}, then cache 2 bytes, {de} or the new data is evicted, current size is 10.
+    ASSERT_NE(imageCache->GetCacheImageData(KEY_1), nullptr);
+    ASSERT_NE(imageCache->GetCacheImageData(KEY_4), nullptr);
     const uint8_t data5[] = { 'r', 's' };
     sk_sp<SkData> skData5 = SkData::MakeWithCopy(data5, 2);
     auto cachedData5 = AceType::MakeRefPtr<SkiaCachedImageData>(skData5);
     imageCache->CacheImageData(KEY_5, cachedData5);
-    ASSERT_EQ(imageCache->curDataSize_, 9u);
+    ASSERT_EQ(imageCache->GetCachedDataSize(), 10u);
+    ASSERT_NE(imageCache->GetCacheImageData(KEY_1), nullptr);
+    ASSERT_NE(imageCache->GetCacheImageData(KEY_4), nullptr);
+    ASSERT_EQ(imageCache->GetDataCacheStats().evictions, 1u);
 
-    // create 5 bytes, cache it, current size is 7 {rs}{tuvwx}
-    const uint8_t data6[] = { 't', 'u', 'v', 'w', 'x' };
-    sk_sp<SkData> skData6 = SkData::MakeWithCopy(data6, 5);
+    // cache data witch is already cached, current size is 6.
+    const uint8_t data6[] = { 'y' };
+    sk_sp<SkData> skData6 = SkData::MakeWithCopy(data6, 1);
     auto cachedData6 = AceType::MakeRefPtr<SkiaCachedImageData>(skData6);
-    imageCache->CacheImageData(KEY_6, cachedData6);
-    ASSERT_EQ(imageCache->curDataSize_, 7u);
-
-    // cache data witch is already cached. {rs}{y}
-    const uint8_t data7[] = { 'y' };
-    sk_sp<SkData> skData7 = SkData::MakeWithCopy(data7, 1);
-    auto cachedData7 = AceType::MakeRefPtr<SkiaCachedImageData>(skData7);
-    imageCache->CacheImageData(KEY_6, cachedData7);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
-
-    // cache data witch is already cached. {y}{fg}
-    const uint8_t data8[] = { 'f', 'g' };
-    sk_sp<SkData> skData8 = SkData::MakeWithCopy(data8, 2);
-    auto cachedData8 = AceType::MakeRefPtr<SkiaCachedImageData>(skData8);
-    imageCache->CacheImageData(KEY_5, cachedData8);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
-    auto dataFront = imageCache->dataCacheList_.front().imageDataPtr->GetData();
-    for (int i = 0; i < 2; ++i) {
-        ASSERT_EQ(dataFront[i], data8[i]);
+    imageCache->CacheImageData(KEY_4, cachedData6);
+    ASSERT_EQ(imageCache->GetCachedDataSize(), 6u);
+    auto dataKey4 = imageCache->GetCacheImageData(KEY_4);
+    ASSERT_EQ(dataKey4->GetData()[0], 'y');
+
+    /**
+     * @tc.steps: step2. clear the cache.
+     * @tc.expected: no data is cached.
+     */
+    imageCache->Clear();
+    ASSERT_EQ(imageCache->GetCachedDataSize(), 0u);
+    ASSERT_EQ(imageCache->GetCacheImageData(KEY_1), nullptr);
+}
+
+/**
+ * @tc.name: MemoryCache005
+ * @tc.desc: raster of svg is limited by bytes of pixels.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, MemoryCache005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set svg raster limit to 2 rasters of 10 x 10, cache 2 rasters.
+     * @tc.expected: both rasters are cached and charged by the size of pixels.
+     */
+    const int32_t rasterSize = 10;
+    auto rasterBytes = ImageCache::GetPixelsSize(rasterSize, rasterSize);
+    imageCache->SetSvgRasterSizeLimit(rasterBytes * 2);
+    auto surface = SkSurface::MakeRasterN32Premul(rasterSize, rasterSize);
+    ASSERT_NE(surface, nullptr);
+    imageCache->CacheSvgRaster(KEY_1, std::make_shared<CachedSvgRaster>(surface->makeImageSnapshot()));
+    imageCache->CacheSvgRaster(KEY_2, std::make_shared<CachedSvgRaster>(surface->makeImageSnapshot()));
+    ASSERT_NE(imageCache->GetCacheSvgRaster(KEY_1), nullptr);
+    ASSERT_EQ(imageCache->GetSvgRasterCacheStats().size, rasterBytes * 2);
+
+    /**
+     * @tc.steps: step2. cache the third raster.
+     * @tc.expected: the raster which is not used again is evicted.
+     */
+    imageCache->CacheSvgRaster(KEY_3, std::make_shared<CachedSvgRaster>(surface->makeImageSnapshot()));
+    auto stats = imageCache->GetSvgRasterCacheStats();
+    ASSERT_EQ(stats.count, 2u);
+    ASSERT_EQ(stats.evictions, 1u);
+    ASSERT_NE(imageCache->GetCacheSvgRaster(KEY_1), nullptr);
+
+    /**
+     * @tc.steps: step3. clear the cache.
+     * @tc.expected: no raster is cached.
+     */
+    imageCache->Clear();
+    ASSERT_EQ(imageCache->GetSvgRasterCacheStats().size, 0u);
+    ASSERT_EQ(imageCache->GetCacheSvgRaster(KEY_1), nullptr);
+}
+
+/**
+ * @tc.name: MemoryCache006
+ * @tc.desc: decoded images and canvas images of NG share one count limit and one size limit.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, MemoryCache006, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set the size limit to 3 images of 10 x 10, cache a decoded image and a canvas image.
+     * @tc.expected: both are cached and charged against the same size.
+     */
+    auto imageBytes = ImageCache::GetPixelsSize(10, 10);
+    imageCache->SetImageSizeLimit(imageBytes * 3);
+    auto image = std::make_shared<CachedImage>(flutter::CanvasImage::Create());
+    imageCache->CacheImage(KEY_1, image, imageBytes);
+    // canvas images are cached as AceType, any AceType stands for them.
+    RefPtr<AceType> canvasImage = AceType::MakeRefPtr<SkiaCachedImageData>(SkData::MakeEmpty());
+    imageCache->CacheCanvasImage(KEY_2, canvasImage, imageBytes);
+    ASSERT_EQ(imageCache->GetCacheImage(KEY_1), image);
+    ASSERT_EQ(imageCache->GetCacheCanvasImage(KEY_2), canvasImage);
+    ASSERT_EQ(imageCache->GetCacheImage(KEY_2), nullptr);
+    ASSERT_EQ(imageCache->GetCachedImageSize(), imageBytes * 2);
+
+    /**
+     * @tc.steps: step2. cache two more canvas images.
+     * @tc.expected: one image is evicted to keep both kinds under the size limit.
+     */
+    imageCache->CacheCanvasImage(KEY_3, AceType::MakeRefPtr<SkiaCachedImageData>(SkData::MakeEmpty()), imageBytes);
+    imageCache->CacheCanvasImage(KEY_4, AceType::MakeRefPtr<SkiaCachedImageData>(SkData::MakeEmpty()), imageBytes);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), 3u);
+    ASSERT_EQ(imageCache->GetCachedImageSize(), imageBytes * 3);
+
+    /**
+     * @tc.steps: step3. set the capacity to 1.
+     * @tc.expected: only one image of both kinds is kept.
+     */
+    imageCache->SetCapacity(1);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), 1u);
+    ASSERT_EQ(imageCache->GetCachedImageSize(), imageBytes);
+}
+
+/**
+ * @tc.name: ShardedClockCache001
+ * @tc.desc: cache is limited by bytes, big items take as much of the cache as many small items.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, ShardedClockCache001, TestSize.Level1)
+{
+    constexpr size_t sizeLimit = 10000;
+    ShardedClockCache<std::shared_ptr<std::string>> cache;
+    cache.SetSizeLimit(sizeLimit);
+
+    /**
+     * @tc.steps: step1. cache 100 thumbnails of 1000 bytes.
+     * @tc.expected: only 10 thumbnails are cached.
+     */
+    for (int32_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(cache.Put("thumbnail" + std::to_string(i), std::make_shared<std::string>("thumbnail"), 1000));
+        ASSERT_LE(cache.GetSize(), sizeLimit);
+    }
+    ASSERT_EQ(cache.GetCount(), 10u);
+    ASSERT_EQ(cache.GetStats().evictions, 90u);
+
+    /**
+     * @tc.steps: step2. clear the cache and cache 1000 icons of 10 bytes.
+     * @tc.expected: all icons are cached.
+     */
+    cache.Clear();
+    for (int32_t i = 0; i < 1000; ++i) {
+        cache.Put("icon" + std::to_string(i), std::make_shared<std::string>("icon"), 10);
+    }
+    ASSERT_EQ(cache.GetCount(), 1000u);
+    ASSERT_EQ(cache.GetSize(), sizeLimit);
+    for (int32_t i = 0; i < 1000; ++i) {
+        ASSERT_NE(cache.Get("icon" + std::to_string(i)), nullptr);
+    }
+
+    /**
+     * @tc.steps: step3. cache a item bigger than the limit.
+     * @tc.expected: item is not cached.
+     */
+    ASSERT_FALSE(cache.Put("big", std::make_shared<std::string>("big"), sizeLimit + 1));
+    ASSERT_EQ(cache.Get("big"), nullptr);
+}
+
+/**
+ * @tc.name: ShardedClockCache002
+ * @tc.desc: items in use are kept when a long list of items is cached once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, ShardedClockCache002, TestSize.Level1)
+{
+    ShardedClockCache<std::shared_ptr<std::string>> cache;
+    cache.SetCountLimit(8);
+    const std::vector<std::string> hotKeys = { "hot0", "hot1", "hot2", "hot3" };
+    for (const auto& key : hotKeys) {
+        cache.Put(key, std::make_shared<std::string>(key), 1);
+    }
+
+    /**
+     * @tc.steps: step1. cache 200 items once, and use hot items between them.
+     * @tc.expected: hot items are not evicted.
+     */
+    for (int32_t i = 0; i < 200; ++i) {
+        cache.Put("scan" + std::to_string(i), std::make_shared<std::string>("scan"), 1);
+        for (const auto& key : hotKeys) {
+            ASSERT_NE(cache.Get(key), nullptr);
+        }
+    }
+    ASSERT_EQ(cache.GetCount(), 8u);
+
+    /**
+     * @tc.steps: step2. reduce count limit to 0.
+     * @tc.expected: all items are evicted.
+     */
+    cache.SetCountLimit(0);
+    ASSERT_EQ(cache.GetCount(), 0u);
+    ASSERT_EQ(cache.GetSize(), 0u);
+}
+
+/**
+ * @tc.name: ShardedClockCache003
+ * @tc.desc: cache is accessed by several threads.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageCacheTest, ShardedClockCache003, TestSize.Level1)
+{
+    constexpr size_t sizeLimit = 4096;
+    constexpr int32_t threadCount = 4;
+    constexpr int32_t loopCount = 2000;
+    ShardedClockCache<std::shared_ptr<std::string>> cache;
+    cache.SetSizeLimit(sizeLimit);
+
+    /**
+     * @tc.steps: step1. put and get items from several threads.
+     * @tc.expected: size of cache is under limit and every get is counted.
+     */
+    std::vector<std::thread> threads;
+    for (int32_t id = 0; id < threadCount; ++id) {
+        threads.emplace_back([&cache, id]() {
+            for (int32_t i = 0; i < loopCount; ++i) {
+                auto key = std::to_string((i * (id + 1)) % 300);
+                if (!cache.Get(key)) {
+                    cache.Put(key, std::make_shared<std::string>(key), 16 + key.size());
+                }
+            }
+        });
     }
-    auto dataKey5 = imageCache->GetCacheImageData(KEY_5);
-    auto dataRaw5 = dataKey5->GetData();
-    ASSERT_EQ(dataFront, dataRaw5);
-
-    // Get key6
-    auto dataKey6 = imageCache->GetCacheImageData(KEY_6);
-    auto dataRaw6 = dataKey6->GetData();
-    ASSERT_EQ(dataRaw6[0], 'y');
-    dataFront = imageCache->dataCacheList_.front().imageDataPtr->GetData();
-    ASSERT_EQ(dataFront, dataRaw6);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto stats = cache.GetStats();
+    ASSERT_LE(stats.size, sizeLimit);
+    ASSERT_EQ(stats.hits + stats.misses, static_cast<uint64_t>(threadCount * loopCount));
+    ASSERT_EQ(stats.insertions - stats.evictions, stats.count);
+
+    cache.Clear();
+    ASSERT_EQ(cache.GetCount(), 0u);
+    ASSERT_EQ(cache.GetSize(), 0u);
 }
 
 /**
@@ -21,6 +21,10 @@ DeviceType SystemProperties::deviceType_ = DeviceType::UNKNOWN;
 bool SystemProperties::isHookModeEnabled_ = false;
 bool SystemProperties::rosenBackendEnabled_ = true;
 bool SystemProperties::windowAnimationEnabled_ = true;
+bool SystemProperties::parallelLayoutEnabled_ = false;
+bool SystemProperties::parallelRenderEnabled_ = false;
+bool SystemProperties::touchCoalesceEnabled_ = true;
+bool SystemProperties::touchResampleEnabled_ = false;
 double SystemProperties::resolution_ = 0.0;
 
 float SystemProperties::GetFontWeightScale()
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/pipeline/frame_statistics.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <utility>
+
+#include "base/log/dump_log.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr uint64_t NANOSECONDS_PER_MICROSECOND = 1000;
+constexpr uint64_t NANOSECONDS_PER_MILLISECOND = 1000000;
+// intervals of vsync out of the range are not consecutive vsyncs of a display.
+constexpr uint64_t MIN_VSYNC_PERIOD = 4000000;
+constexpr uint64_t MAX_VSYNC_PERIOD = 50000000;
+// the period is updated to the shortest interval in the window, so it follows changes of the refresh rate.
+constexpr uint32_t VSYNC_PERIOD_WINDOW = 120;
+constexpr double PERCENTILE_MAX = 100.0;
+constexpr size_t LINE_BUFFER_SIZE = 256;
+
+const char* const PHASE_NAMES[] = { "animation", "build", "touch", "layout", "render", "frame" };
+
+uint32_t GetExponent(uint64_t value)
+{
+    uint32_t exponent = 0;
+    while (value >>= 1) {
+        ++exponent;
+    }
+    return exponent;
+}
+
+void PrintHistogram(const char* name, const FrameHistogram& histogram)
+{
+    constexpr double p50 = 50.0;
+    constexpr double p90 = 90.0;
+    constexpr double p99 = 99.0;
+    char line[LINE_BUFFER_SIZE];
+    int32_t length = snprintf(line, sizeof(line),
+        "  %-10s count: %" PRIu64 ", mean: %" PRIu64 ", p50: %" PRIu64 ", p90: %" PRIu64 ", p99: %" PRIu64
+        ", max: %" PRIu64,
+        name, histogram.GetCount(), histogram.GetMean(), histogram.GetPercentile(p50), histogram.GetPercentile(p90),
+        histogram.GetPercentile(p99), histogram.GetMax());
+    if (length > 0) {
+        DumpLog::GetInstance().Print(std::string(line, std::min<size_t>(length, sizeof(line) - 1)));
+    }
+}
+
+} // namespace
+
+size_t FrameHistogram::GetBucketIndex(uint64_t value)
+{
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+    auto exponent = GetExponent(value);
+    if (exponent > MAX_EXPONENT) {
+        return BUCKET_COUNT - 1;
+    }
+    // the highest bit is always set, the following bits select the sub bucket.
+    auto subBucket = (value >> (exponent - SUB_BUCKET_BITS + 1)) & (HALF_SUB_BUCKET_COUNT - 1);
+    return SUB_BUCKET_COUNT + (exponent - SUB_BUCKET_BITS) * HALF_SUB_BUCKET_COUNT + subBucket;
+}
+
+uint64_t FrameHistogram::GetBucketMaxValue(size_t index)
+{
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    if (index >= BUCKET_COUNT - 1) {
+        return UINT64_MAX;
+    }
+    auto offset = index - SUB_BUCKET_COUNT;
+    uint32_t exponent = offset / HALF_SUB_BUCKET_COUNT + SUB_BUCKET_BITS;
+    uint64_t subBucket = offset % HALF_SUB_BUCKET_COUNT;
+    uint32_t shift = exponent - SUB_BUCKET_BITS + 1;
+    return ((HALF_SUB_BUCKET_COUNT + subBucket + 1) << shift) - 1;
+}
+
+void FrameHistogram::Record(uint64_t value)
+{
+    ++buckets_[GetBucketIndex(value)];
+    ++count_;
+    sum_ += value;
+    max_ = std::max(max_, value);
+}
+
+void FrameHistogram::Reset()
+{
+    buckets_.fill(0);
+    count_ = 0;
+    sum_ = 0;
+    max_ = 0;
+}
+
+uint64_t FrameHistogram::GetPercentile(double percentile) const
+{
+    if (count_ == 0) {
+        return 0;
+    }
+    percentile = std::clamp(percentile, 0.0, PERCENTILE_MAX);
+    auto target = static_cast<uint64_t>(std::ceil(percentile / PERCENTILE_MAX * static_cast<double>(count_)));
+    target = std::max<uint64_t>(target, 1);
+    uint64_t total = 0;
+    for (size_t index = 0; index < BUCKET_COUNT; ++index) {
+        total += buckets_[index];
+        if (total >= target) {
+            return std::min(GetBucketMaxValue(index), max_);
+        }
+    }
+    return max_;
+}
+
+void FrameStatistics::Window::Reset()
+{
+    for (auto& histogram : phases) {
+        histogram.Reset();
+    }
+    for (auto& histogram : dirtyNodes) {
+        histogram.Reset();
+    }
+    beginTime = 0;
+    endTime = 0;
+    jankCount = 0;
+    missedVsyncCount = 0;
+}
+
+void FrameStatistics::BeginFrame(uint64_t vsyncTime)
+{
+    UpdateVsyncPeriod(vsyncTime);
+    UpdateWindow(vsyncTime);
+    frameBeginTime_ = GetMicroTickCount();
+}
+
+void FrameStatistics::EndFrame()
+{
+    if (frameBeginTime_ == 0) {
+        return;
+    }
+    auto duration = static_cast<uint64_t>(GetMicroTickCount() - frameBeginTime_);
+    frameBeginTime_ = 0;
+    RecordPhase(FramePhase::FRAME, duration);
+    auto durationNs = duration * NANOSECONDS_PER_MICROSECOND;
+    if (durationNs > vsyncPeriod_) {
+        ++current_.jankCount;
+        current_.missedVsyncCount += durationNs / vsyncPeriod_;
+    }
+}
+
+void FrameStatistics::RecordPhase(FramePhase phase, uint64_t durationUs)
+{
+    if (phase >= FramePhase::COUNT) {
+        return;
+    }
+    current_.phases[static_cast<size_t>(phase)].Record(durationUs);
+}
+
+void FrameStatistics::RecordDirtyNodes(FramePhase phase, size_t count)
+{
+    if (phase >= FramePhase::COUNT) {
+        return;
+    }
+    current_.dirtyNodes[static_cast<size_t>(phase)].Record(count);
+}
+
+void FrameStatistics::UpdateVsyncPeriod(uint64_t vsyncTime)
+{
+    if (lastVsyncTime_ != 0 && vsyncTime > lastVsyncTime_) {
+        auto interval = vsyncTime - lastVsyncTime_;
+        if (interval >= MIN_VSYNC_PERIOD && interval <= MAX_VSYNC_PERIOD) {
+            minVsyncInterval_ = std::min(minVsyncInterval_, interval);
+            if (++vsyncIntervalCount_ >= VSYNC_PERIOD_WINDOW) {
+                vsyncPeriod_ = minVsyncInterval_;
+                minVsyncInterval_ = UINT64_MAX;
+                vsyncIntervalCount_ = 0;
+            }
+        }
+    }
+    lastVsyncTime_ = vsyncTime;
+}
+
+void FrameStatistics::UpdateWindow(uint64_t vsyncTime)
+{
+    if (current_.beginTime == 0 || vsyncTime < current_.beginTime) {
+        current_.beginTime = vsyncTime;
+        return;
+    }
+    if (vsyncTime - current_.beginTime < windowPeriod_) {
+        return;
+    }
+    current_.endTime = vsyncTime;
+    std::swap(current_, completed_);
+    current_.Reset();
+    current_.beginTime = vsyncTime;
+}
+
+void FrameStatistics::Dump() const
+{
+    // before the first window is completed, the current one is better than nothing.
+    bool isCompleted = completed_.endTime != 0;
+    const auto& window = isCompleted ? completed_ : current_;
+    auto windowTime = (isCompleted ? window.endTime : lastVsyncTime_) - window.beginTime;
+    char line[LINE_BUFFER_SIZE];
+    int32_t length = snprintf(line, sizeof(line),
+        "%s window(ms): %" PRIu64 ", frames: %" PRIu64 ", jank: %" PRIu64 ", missed vsync: %" PRIu64
+        ", vsync period(us): %" PRIu64,
+        isCompleted ? "completed" : "current", windowTime / NANOSECONDS_PER_MILLISECOND,
+        window.phases[static_cast<size_t>(FramePhase::FRAME)].GetCount(), window.jankCount, window.missedVsyncCount,
+        vsyncPeriod_ / NANOSECONDS_PER_MICROSECOND);
+    if (length > 0) {
+        DumpLog::GetInstance().Print(std::string(line, std::min<size_t>(length, sizeof(line) - 1)));
+    }
+    DumpLog::GetInstance().Print("duration(us):");
+    for (size_t index = 0; index < PHASE_COUNT; ++index) {
+        PrintHistogram(PHASE_NAMES[index], window.phases[index]);
+    }
+    DumpLog::GetInstance().Print("dirty nodes:");
+    for (size_t index = 0; index < PHASE_COUNT; ++index) {
+        if (window.dirtyNodes[index].GetCount() > 0) {
+            PrintHistogram(PHASE_NAMES[index], window.dirtyNodes[index]);
+        }
+    }
+}
+
+void FrameStatistics::Reset()
+{
+    current_.Reset();
+    completed_.Reset();
+}
+
+} // namespace OHOS::Ace
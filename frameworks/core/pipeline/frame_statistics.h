@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_FRAME_STATISTICS_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_FRAME_STATISTICS_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+#include "base/utils/time_util.h"
+
+namespace OHOS::Ace {
+
+enum class FramePhase : uint8_t {
+    ANIMATION = 0,
+    BUILD,
+    TOUCH,
+    LAYOUT,
+    RENDER,
+    // whole work of the frame on ui thread.
+    FRAME,
+    COUNT,
+};
+
+// Histogram with fixed memory, values are put into buckets of about 6% width, so percentiles are kept with the same
+// relative precision from 1us to seconds, like HdrHistogram with 2 significant digits.
+class ACE_EXPORT FrameHistogram final {
+public:
+    FrameHistogram() = default;
+    ~FrameHistogram() = default;
+
+    void Record(uint64_t value);
+    void Reset();
+
+    // Returns the highest value of the bucket where the percentile (0 - 100) is reached, 0 if nothing is recorded.
+    uint64_t GetPercentile(double percentile) const;
+
+    uint64_t GetCount() const
+    {
+        return count_;
+    }
+
+    uint64_t GetMax() const
+    {
+        return max_;
+    }
+
+    uint64_t GetMean() const
+    {
+        return count_ == 0 ? 0 : sum_ / count_;
+    }
+
+    static size_t GetBucketIndex(uint64_t value);
+    static uint64_t GetBucketMaxValue(size_t index);
+
+private:
+    // values below 2^SUB_BUCKET_BITS have their own buckets, every power of 2 above is split to 2^(BITS - 1) buckets.
+    static constexpr uint32_t SUB_BUCKET_BITS = 5;
+    static constexpr uint32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+    static constexpr uint32_t HALF_SUB_BUCKET_COUNT = SUB_BUCKET_COUNT / 2;
+    // largest exponent of values, larger values are put into the last bucket.
+    static constexpr uint32_t MAX_EXPONENT = 26;
+    static constexpr size_t BUCKET_COUNT =
+        SUB_BUCKET_COUNT + (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * HALF_SUB_BUCKET_COUNT;
+
+    std::array<uint32_t, BUCKET_COUNT> buckets_ {};
+    uint64_t count_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t max_ = 0;
+};
+
+// Per window statistics of frames: durations of every phase in microseconds, count of dirty nodes of every phase and
+// frames which take longer than the vsync period. It only reads the clock at the phase boundaries, so it is always on
+// and the data can be dumped from devices in production. Frames are recorded to the current window, which is rotated
+// to the completed window by the vsync time once the window period has passed.
+class ACE_EXPORT FrameStatistics final {
+public:
+    static constexpr size_t PHASE_COUNT = static_cast<size_t>(FramePhase::COUNT);
+    static constexpr uint64_t DEFAULT_WINDOW_PERIOD = 10000000000;
+
+    struct Window {
+        void Reset();
+
+        std::array<FrameHistogram, PHASE_COUNT> phases;
+        std::array<FrameHistogram, PHASE_COUNT> dirtyNodes;
+        // vsync time stamps in nanoseconds of the first frame in the window and the frame rotating it.
+        uint64_t beginTime = 0;
+        uint64_t endTime = 0;
+        uint64_t jankCount = 0;
+        uint64_t missedVsyncCount = 0;
+    };
+
+    FrameStatistics() = default;
+    ~FrameStatistics() = default;
+
+    // Called at the beginning and end of the vsync task, vsyncTime is the time stamp of vsync in nanoseconds.
+    void BeginFrame(uint64_t vsyncTime);
+    void EndFrame();
+    void RecordPhase(FramePhase phase, uint64_t durationUs);
+    void RecordDirtyNodes(FramePhase phase, size_t count);
+
+    // Write the statistics of the last completed window to DumpLog, or of the current one before any is completed.
+    void Dump() const;
+    void Reset();
+
+    // Statistics of the current window.
+    const FrameHistogram& GetPhaseHistogram(FramePhase phase) const
+    {
+        return current_.phases[static_cast<size_t>(phase)];
+    }
+
+    const FrameHistogram& GetDirtyNodeHistogram(FramePhase phase) const
+    {
+        return current_.dirtyNodes[static_cast<size_t>(phase)];
+    }
+
+    uint64_t GetJankCount() const
+    {
+        return current_.jankCount;
+    }
+
+    uint64_t GetMissedVsyncCount() const
+    {
+        return current_.missedVsyncCount;
+    }
+
+    const Window& GetCompletedWindow() const
+    {
+        return completed_;
+    }
+
+    uint64_t GetVsyncPeriod() const
+    {
+        return vsyncPeriod_;
+    }
+
+    // Period of the window in nanoseconds, UINT64_MAX keeps all frames in the current window.
+    void SetWindowPeriod(uint64_t windowPeriod)
+    {
+        windowPeriod_ = windowPeriod;
+    }
+
+private:
+    void UpdateVsyncPeriod(uint64_t vsyncTime);
+    void UpdateWindow(uint64_t vsyncTime);
+
+    static constexpr uint64_t DEFAULT_VSYNC_PERIOD = 16666667;
+
+    Window current_;
+    Window completed_;
+    uint64_t windowPeriod_ = DEFAULT_WINDOW_PERIOD;
+    int64_t frameBeginTime_ = 0;
+    uint64_t lastVsyncTime_ = 0;
+    uint64_t vsyncPeriod_ = DEFAULT_VSYNC_PERIOD;
+    uint64_t minVsyncInterval_ = UINT64_MAX;
+    uint32_t vsyncIntervalCount_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(FrameStatistics);
+};
+
+// Record the duration of a phase when the scope ends.
+class FramePhaseScope final {
+public:
+    FramePhaseScope(FrameStatistics& statistics, FramePhase phase)
+        : statistics_(statistics), phase_(phase), beginTime_(GetMicroTickCount())
+    {}
+
+    ~FramePhaseScope()
+    {
+        statistics_.RecordPhase(phase_, static_cast<uint64_t>(GetMicroTickCount() - beginTime_));
+    }
+
+private:
+    FrameStatistics& statistics_;
+    FramePhase phase_;
+    int64_t beginTime_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(FramePhaseScope);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_FRAME_STATISTICS_H
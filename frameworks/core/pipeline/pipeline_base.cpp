@@ -19,6 +19,7 @@
 
 #include "base/log/dump_log.h"
 #include "base/log/event_report.h"
+#include "base/log/trace_recorder.h"
 #include "core/common/ace_application_info.h"
 #include "core/common/container.h"
 #include "core/common/font_manager.h"
@@ -332,6 +333,24 @@ void PipelineBase::DumpInfo(const std::vector<std::string>& params, std::vector<
     }
 }
 
+void PipelineBase::DumpTraceRecorder(const std::vector<std::string>& params) const
+{
+    auto& recorder = TraceRecorder::GetInstance();
+    const auto& command = params.size() > 1 ? params[1] : "";
+    if (command == "-start") {
+        recorder.Start();
+        DumpLog::GetInstance().Print("Trace recorder started");
+    } else if (command == "-stop") {
+        recorder.Stop();
+        DumpLog::GetInstance().Print("Trace recorder stopped");
+    } else if (command == "-clear") {
+        recorder.Clear();
+        DumpLog::GetInstance().Print("Trace recorder cleared");
+    } else {
+        DumpLog::GetInstance().Print(recorder.Export());
+    }
+}
+
 bool PipelineBase::Dump(const std::vector<std::string>& params) const
 {
     if (params.empty()) {
@@ -357,6 +376,14 @@ bool PipelineBase::Dump(const std::vector<std::string>& params) const
         EventReport::SendEvent(eventInfo);
         return true;
     }
+    if (params[0] == "-framestats") {
+        frameStatistics_.Dump();
+        return true;
+    }
+    if (params[0] == "-tracerecorder") {
+        DumpTraceRecorder(params);
+        return true;
+    }
     return OnDumpInfo(params);
 }
 
@@ -39,6 +39,7 @@
 #include "core/event/touch_event.h"
 #include "core/gestures/gesture_info.h"
 #include "core/image/image_cache.h"
+#include "core/pipeline/frame_statistics.h"
 
 namespace OHOS::Ace {
 
@@ -451,6 +452,11 @@ public:
         return isRebuildFinished_;
     }
 
+    FrameStatistics& GetFrameStatistics()
+    {
+        return frameStatistics_;
+    }
+
     void RequestFrame();
 
     void RegisterFont(const std::string& familyName, const std::string& familySrc);
@@ -477,6 +483,7 @@ protected:
     virtual void FlushPipelineWithoutAnimation() = 0;
     virtual void FlushMessages() = 0;
     void UpdateRootSizeAndScale(int32_t width, int32_t height);
+    void DumpTraceRecorder(const std::vector<std::string>& params) const;
 
     bool isRebuildFinished_ = false;
     bool isJsCard_ = false;
@@ -509,6 +516,7 @@ protected:
     FinishEventHandler finishEventHandler_;
     StartAbilityHandler startAbilityHandler_;
     ActionEventHandler actionEventHandler_;
+    FrameStatistics frameStatistics_;
 
 private:
     StatusBarEventHandler statusBarBgColorEventHandler_;
@@ -206,6 +206,8 @@ void PipelineContext::FlushBuild()
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FramePhaseScope phaseScope(frameStatistics_, FramePhase::BUILD);
+    frameStatistics_.RecordDirtyNodes(FramePhase::BUILD, dirtyElements_.size());
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushBuild();
@@ -514,6 +516,8 @@ void PipelineContext::FlushLayout()
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FramePhaseScope phaseScope(frameStatistics_, FramePhase::LAYOUT);
+    frameStatistics_.RecordDirtyNodes(FramePhase::LAYOUT, dirtyLayoutNodes_.size());
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushLayout();
@@ -601,6 +605,9 @@ void PipelineContext::FlushRender()
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FramePhaseScope phaseScope(frameStatistics_, FramePhase::RENDER);
+    frameStatistics_.RecordDirtyNodes(
+        FramePhase::RENDER, dirtyRenderNodes_.size() + dirtyRenderNodesInOverlay_.size());
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushRender();
@@ -703,6 +710,7 @@ void PipelineContext::FlushAnimation(uint64_t nanoTimestamp)
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACK();
     ACE_FUNCTION_TRACE();
+    FramePhaseScope phaseScope(frameStatistics_, FramePhase::ANIMATION);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushAnimation();
@@ -1673,6 +1681,7 @@ void PipelineContext::FlushTouchEvents()
         LOGE("root element is nullptr");
         return;
     }
+    FramePhaseScope phaseScope(frameStatistics_, FramePhase::TOUCH);
     {
         eventManager_->FlushTouchEventsBegin(touchEvents_);
         std::unordered_set<int32_t> moveEventIds;
@@ -1992,11 +2001,13 @@ void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
     }
 #endif
     if (isSurfaceReady_) {
+        frameStatistics_.BeginFrame(nanoTimestamp);
         FlushTouchEvents();
         FlushAnimation(GetTimeFromExternalTimer());
         FlushPipelineWithoutAnimation();
         FlushAnimationTasks();
         hasIdleTasks_ = false;
+        frameStatistics_.EndFrame();
     } else {
         LOGW("the surface is not ready, waiting");
     }
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "base/log/dump_log.h"
+#include "core/pipeline/frame_statistics.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr uint64_t VSYNC_PERIOD_120HZ = 8333333;
+constexpr int32_t VSYNC_COUNT = 200;
+// window of 100 frames at 120Hz.
+constexpr uint64_t WINDOW_PERIOD = 100 * VSYNC_PERIOD_120HZ;
+// relative error of the value of bucket.
+constexpr double MAX_RELATIVE_ERROR = 1.0 / 16;
+
+} // namespace
+
+class FrameStatisticsTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: FrameStatisticsTest001
+ * @tc.desc: Every value is in a bucket whose max value is not less than it, within the relative error.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameStatisticsTest, FrameStatisticsTest001, TestSize.Level1)
+{
+    size_t lastIndex = 0;
+    for (uint64_t value = 0; value < (1 << 20); value += 1 + value / 64) {
+        auto index = FrameHistogram::GetBucketIndex(value);
+        EXPECT_GE(index, lastIndex);
+        lastIndex = index;
+        auto maxValue = FrameHistogram::GetBucketMaxValue(index);
+        EXPECT_GE(maxValue, value);
+        EXPECT_LE(static_cast<double>(maxValue - value), static_cast<double>(value) * MAX_RELATIVE_ERROR) << value;
+        if (index > 0) {
+            EXPECT_LT(FrameHistogram::GetBucketMaxValue(index - 1), value);
+        }
+    }
+    // large values are put into the last bucket.
+    EXPECT_EQ(FrameHistogram::GetBucketIndex(UINT64_MAX), FrameHistogram::GetBucketIndex(1ULL << 40));
+}
+
+/**
+ * @tc.name: FrameStatisticsTest002
+ * @tc.desc: Percentiles, mean and max of recorded values.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameStatisticsTest, FrameStatisticsTest002, TestSize.Level1)
+{
+    FrameHistogram histogram;
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0u);
+    for (uint64_t value = 1; value <= 1000; ++value) {
+        histogram.Record(value);
+    }
+    EXPECT_EQ(histogram.GetCount(), 1000u);
+    EXPECT_EQ(histogram.GetMax(), 1000u);
+    EXPECT_EQ(histogram.GetMean(), 500u);
+    auto p50 = histogram.GetPercentile(50.0);
+    EXPECT_GE(p50, 500u);
+    EXPECT_LE(p50, 500u + 500u * MAX_RELATIVE_ERROR);
+    auto p99 = histogram.GetPercentile(99.0);
+    EXPECT_GE(p99, 990u);
+    EXPECT_LE(p99, 1000u);
+    EXPECT_EQ(histogram.GetPercentile(100.0), 1000u);
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetPercentile(99.0), 0u);
+}
+
+/**
+ * @tc.name: FrameStatisticsTest003
+ * @tc.desc: Vsync period follows the interval of vsync time stamps.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameStatisticsTest, FrameStatisticsTest003, TestSize.Level1)
+{
+    FrameStatistics statistics;
+    uint64_t vsyncTime = VSYNC_PERIOD_120HZ;
+    for (int32_t index = 0; index < VSYNC_COUNT; ++index) {
+        statistics.BeginFrame(vsyncTime);
+        statistics.EndFrame();
+        // skip a vsync sometimes, which does not change the period.
+        vsyncTime += (index % 3 == 0) ? 2 * VSYNC_PERIOD_120HZ : VSYNC_PERIOD_120HZ;
+    }
+    EXPECT_EQ(statistics.GetVsyncPeriod(), VSYNC_PERIOD_120HZ);
+    EXPECT_EQ(statistics.GetPhaseHistogram(FramePhase::FRAME).GetCount(), static_cast<uint64_t>(VSYNC_COUNT));
+}
+
+/**
+ * @tc.name: FrameStatisticsTest004
+ * @tc.desc: Phases and dirty nodes are written to dump log.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameStatisticsTest, FrameStatisticsTest004, TestSize.Level1)
+{
+    FrameStatistics statistics;
+    statistics.RecordPhase(FramePhase::LAYOUT, 1200);
+    statistics.RecordDirtyNodes(FramePhase::BUILD, 3);
+    {
+        FramePhaseScope phaseScope(statistics, FramePhase::RENDER);
+    }
+    EXPECT_EQ(statistics.GetPhaseHistogram(FramePhase::RENDER).GetCount(), 1u);
+    EXPECT_EQ(statistics.GetDirtyNodeHistogram(FramePhase::BUILD).GetMax(), 3u);
+
+    DumpLog::GetInstance().SetDumpFile(std::make_unique<std::ostringstream>());
+    statistics.Dump();
+    auto* stream = static_cast<std::ostringstream*>(DumpLog::GetInstance().GetDumpFile().get());
+    auto output = stream->str();
+    DumpLog::GetInstance().Reset();
+    EXPECT_NE(output.find("jank: 0"), std::string::npos);
+    EXPECT_NE(output.find("layout     count: 1, mean: 1200"), std::string::npos);
+    EXPECT_NE(output.find("build      count: 1, mean: 3"), std::string::npos);
+
+    statistics.Reset();
+    EXPECT_EQ(statistics.GetPhaseHistogram(FramePhase::LAYOUT).GetCount(), 0u);
+}
+
+/**
+ * @tc.name: FrameStatisticsTest005
+ * @tc.desc: The window is rotated by the vsync time, and dump reports the last completed window.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameStatisticsTest, FrameStatisticsTest005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record frames of two and a half windows, each window has frames with its own layout time.
+     * @tc.expected: step1. the completed window only has the frames of the second window.
+     */
+    FrameStatistics statistics;
+    statistics.SetWindowPeriod(WINDOW_PERIOD);
+    uint64_t vsyncTime = VSYNC_PERIOD_120HZ;
+    for (int32_t index = 0; index < VSYNC_COUNT + VSYNC_COUNT / 4; ++index) {
+        statistics.BeginFrame(vsyncTime);
+        statistics.RecordPhase(FramePhase::LAYOUT, 1000 * (index / (VSYNC_COUNT / 2) + 1));
+        statistics.EndFrame();
+        vsyncTime += VSYNC_PERIOD_120HZ;
+    }
+    const auto& completed = statistics.GetCompletedWindow();
+    const auto& layout = completed.phases[static_cast<size_t>(FramePhase::LAYOUT)];
+    EXPECT_EQ(layout.GetCount(), static_cast<uint64_t>(VSYNC_COUNT / 2));
+    EXPECT_EQ(layout.GetMax(), 2000u);
+    EXPECT_EQ(layout.GetMean(), 2000u);
+    EXPECT_EQ(completed.endTime - completed.beginTime, WINDOW_PERIOD);
+    EXPECT_EQ(statistics.GetPhaseHistogram(FramePhase::LAYOUT).GetCount(), static_cast<uint64_t>(VSYNC_COUNT / 4));
+
+    /**
+     * @tc.steps: step2. dump the statistics.
+     * @tc.expected: step2. the completed window is written to dump log.
+     */
+    DumpLog::GetInstance().SetDumpFile(std::make_unique<std::ostringstream>());
+    statistics.Dump();
+    auto* stream = static_cast<std::ostringstream*>(DumpLog::GetInstance().GetDumpFile().get());
+    auto output = stream->str();
+    DumpLog::GetInstance().Reset();
+    EXPECT_NE(output.find("completed window(ms): 833, frames: 100"), std::string::npos);
+    EXPECT_NE(output.find("layout     count: 100, mean: 2000"), std::string::npos);
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_DIRTY_NODE_QUEUE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_DIRTY_NODE_QUEUE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "base/memory/referenced.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace::NG {
+
+// DirtyNodeQueue keeps dirty nodes in buckets indexed by node depth, so nodes are visited from top to bottom without
+// sorting. The buckets keep their capacity after Clear, and two queues can be swapped, so a queue used once per frame
+// stops allocating after the first few frames.
+// The queue does not remove duplicated nodes, the caller should mark the node when it is pushed. Use WeakPtr<T> as
+// NodePtr if the queue should not keep the nodes alive.
+template<typename T, typename NodePtr = RefPtr<T>>
+class DirtyNodeQueue final {
+public:
+    DirtyNodeQueue() = default;
+    ~DirtyNodeQueue() = default;
+
+    void Push(const RefPtr<T>& node)
+    {
+        auto depth = node->GetDepth();
+        size_t index = depth > 0 ? static_cast<size_t>(depth) : 0;
+        if (index >= buckets_.size()) {
+            buckets_.resize(index + 1);
+        }
+        buckets_[index].emplace_back(node);
+        if (index < minDepth_) {
+            minDepth_ = index;
+        }
+        if (index + 1 > maxDepth_) {
+            maxDepth_ = index + 1;
+        }
+        ++size_;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    // Visit nodes from the lowest depth to the highest depth, nodes in the same depth are visited in push order.
+    template<typename Callback>
+    void ForEach(Callback&& callback) const
+    {
+        for (size_t depth = minDepth_; depth < maxDepth_; ++depth) {
+            for (const auto& node : buckets_[depth]) {
+                callback(node);
+            }
+        }
+    }
+
+    // Release the nodes and keep the memory of buckets.
+    void Clear()
+    {
+        for (size_t depth = minDepth_; depth < maxDepth_; ++depth) {
+            buckets_[depth].clear();
+        }
+        minDepth_ = SIZE_MAX;
+        maxDepth_ = 0;
+        size_ = 0;
+    }
+
+    void Swap(DirtyNodeQueue& other)
+    {
+        buckets_.swap(other.buckets_);
+        std::swap(minDepth_, other.minDepth_);
+        std::swap(maxDepth_, other.maxDepth_);
+        std::swap(size_, other.size_);
+    }
+
+private:
+    std::vector<std::vector<NodePtr>> buckets_;
+    // Range [minDepth_, maxDepth_) of buckets which may contain nodes.
+    size_t minDepth_ = SIZE_MAX;
+    size_t maxDepth_ = 0;
+    size_t size_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(DirtyNodeQueue);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_DIRTY_NODE_QUEUE_H
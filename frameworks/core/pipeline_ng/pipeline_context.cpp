@@ -24,6 +24,7 @@
 #include "base/log/frame_report.h"
 #include "base/memory/referenced.h"
 #include "base/thread/task_executor.h"
+#include "base/utils/system_properties.h"
 #include "base/utils/utils.h"
 #include "core/common/ace_application_info.h"
 #include "core/common/container.h"
@@ -75,7 +76,7 @@ void PipelineContext::AddDirtyCustomNode(const RefPtr<CustomNode>& dirtyNode)
 {
     CHECK_RUN_ON(UI);
     CHECK_NULL_VOID(dirtyNode);
-    dirtyNodes_.emplace(dirtyNode);
+    dirtyNodes_.Push(dirtyNode);
     hasIdleTasks_ = true;
     window_->RequestFrame();
 }
@@ -98,21 +99,53 @@ void PipelineContext::AddDirtyRenderNode(const RefPtr<FrameNode>& dirty)
     window_->RequestFrame();
 }
 
+void PipelineContext::AddPredictTask(PredictTask&& task)
+{
+    CHECK_RUN_ON(UI);
+    CHECK_NULL_VOID(task);
+    predictTasks_.emplace_back(std::move(task));
+}
+
+void PipelineContext::OnIdle(int64_t deadline)
+{
+    CHECK_RUN_ON(UI);
+    if (deadline == 0) {
+        return;
+    }
+    FlushPredictTask(deadline);
+}
+
+void PipelineContext::FlushPredictTask(int64_t deadline)
+{
+    CHECK_RUN_ON(UI);
+    if (predictTasks_.empty()) {
+        return;
+    }
+    ACE_FUNCTION_TRACE();
+    decltype(predictTasks_) tasks(std::move(predictTasks_));
+    for (const auto& task : tasks) {
+        task(deadline);
+    }
+}
+
 void PipelineContext::FlushDirtyNodeUpdate()
 {
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACE();
+    FramePhaseScope phaseScope(frameStatistics_, FramePhase::BUILD);
+    frameStatistics_.RecordDirtyNodes(FramePhase::BUILD, dirtyNodes_.Size());
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushBuild();
     }
 
-    decltype(dirtyNodes_) dirtyNodes(std::move(dirtyNodes_));
-    for (const auto& weakNode : dirtyNodes) {
+    flushingNodes_.Swap(dirtyNodes_);
+    flushingNodes_.ForEach([](const WeakPtr<CustomNode>& weakNode) {
         auto node = weakNode.Upgrade();
         if (node) {
             node->Update();
         }
-    }
+    });
+    flushingNodes_.Clear();
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().EndFlushBuild();
@@ -135,14 +168,18 @@ void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
                                                ? AceApplicationInfo::GetInstance().GetPackageName()
                                                : AceApplicationInfo::GetInstance().GetProcessName();
     window_->RecordFrameTime(nanoTimestamp, abilityName);
+    vsyncTime_ = nanoTimestamp;
+    frameStatistics_.BeginFrame(nanoTimestamp);
     FlushAnimation(GetTimeFromExternalTimer());
     FlushPipelineWithoutAnimation();
+    frameStatistics_.EndFrame();
 }
 
 void PipelineContext::FlushAnimation(uint64_t nanoTimestamp)
 {
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACE();
+    FramePhaseScope phaseScope(frameStatistics_, FramePhase::ANIMATION);
 
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushAnimation();
@@ -171,10 +208,25 @@ void PipelineContext::FlushPipelineWithoutAnimation()
 {
     FlushDirtyNodeUpdate();
     FlushTouchEvents();
-    UITaskScheduler::GetInstance()->FlushTask();
+    FlushUITasks();
     FlushMessages();
 }
 
+void PipelineContext::FlushUITasks()
+{
+    CHECK_RUN_ON(UI);
+    ACE_FUNCTION_TRACE();
+    auto taskScheduler = UITaskScheduler::GetInstance();
+    {
+        FramePhaseScope phaseScope(frameStatistics_, FramePhase::LAYOUT);
+        frameStatistics_.RecordDirtyNodes(FramePhase::LAYOUT, taskScheduler->GetDirtyLayoutNodeCount());
+        taskScheduler->FlushLayoutTask();
+    }
+    FramePhaseScope phaseScope(frameStatistics_, FramePhase::RENDER);
+    frameStatistics_.RecordDirtyNodes(FramePhase::RENDER, taskScheduler->GetDirtyRenderNodeCount());
+    taskScheduler->FlushRenderTask();
+}
+
 void PipelineContext::SetupRootElement()
 {
     CHECK_RUN_ON(UI);
@@ -281,7 +333,25 @@ void PipelineContext::FlushTouchEvents()
     {
         ACE_SCOPED_TRACE("PipelineContext::DispatchTouchEvent");
         decltype(touchEvents_) touchEvents(std::move(touchEvents_));
-        for (const auto& touchEvent : touchEvents) {
+        if (touchEvents.empty()) {
+            return;
+        }
+        // frames without touch events are not recorded, so the touch phase reflects the cost of dispatching.
+        FramePhaseScope phaseScope(frameStatistics_, FramePhase::TOUCH);
+        if (SystemProperties::GetTouchCoalesceEnabled()) {
+            // touch events and vsync time stamps are both from the monotonic clock.
+            TimeStamp frameTime { std::chrono::nanoseconds(vsyncTime_) };
+            touchEventCoalescer_.SetResampleEnabled(SystemProperties::GetTouchResampleEnabled());
+            touchEvents = touchEventCoalescer_.Coalesce(std::move(touchEvents), frameTime);
+        }
+        eventManager_->FlushTouchEventsBegin(touchEvents);
+        auto lastEvent = std::prev(touchEvents.end());
+        for (auto iter = touchEvents.begin(); iter != touchEvents.end(); ++iter) {
+            const auto& touchEvent = *iter;
+            if (iter == lastEvent) {
+                // same as the old pipeline, recognizers handling several pointers update once per frame.
+                eventManager_->FlushTouchEventsEnd(touchEvents);
+            }
             auto scalePoint = touchEvent.CreateScalePoint(GetViewScale());
             LOGD("AceTouchEvent: x = %{public}f, y = %{public}f, type = %{public}zu", scalePoint.x, scalePoint.y,
                 scalePoint.type);
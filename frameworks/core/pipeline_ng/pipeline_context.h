@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_CONTEXT_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_CONTEXT_H
 
+#include <functional>
+#include <list>
 #include <utility>
 
 #include "base/memory/referenced.h"
@@ -24,6 +26,8 @@
 #include "core/components_ng/pattern/stage/stage_manager.h"
 #include "core/event/touch_event.h"
 #include "core/pipeline/pipeline_base.h"
+#include "core/pipeline_ng/dirty_node_queue.h"
+#include "core/pipeline_ng/touch_event_coalescer.h"
 
 namespace OHOS::Ace::NG {
 
@@ -109,7 +113,7 @@ public:
     void OnDragEvent(int32_t x, int32_t y, DragEventAction action) override {}
 
     // Called by view when idle event.
-    void OnIdle(int64_t deadline) override {}
+    void OnIdle(int64_t deadline) override;
 
     void OnActionEvent(const std::string& action) override {}
 
@@ -163,6 +167,10 @@ public:
 
     void AddDirtyRenderNode(const RefPtr<FrameNode>& dirty);
 
+    // The task is called in idle time with the deadline of next vsync, and it should return before the deadline.
+    using PredictTask = std::function<void(int64_t deadline)>;
+    void AddPredictTask(PredictTask&& task);
+
     void FlushDirtyNodeUpdate();
 
     void SetRootRect(double width, double height, double offset) override;
@@ -177,42 +185,22 @@ protected:
 
 private:
     void FlushTouchEvents();
-
-    template<typename T>
-    struct NodeCompare {
-        bool operator()(const T& nodeLeft, const T& nodeRight)
-        {
-            if (nodeLeft->GetDepth() < nodeRight->GetDepth()) {
-                return true;
-            }
-            if (nodeLeft->GetDepth() == nodeRight->GetDepth()) {
-                return nodeLeft < nodeRight;
-            }
-            return false;
-        }
-    };
-
-    template<typename T>
-    struct NodeCompareWeak {
-        bool operator()(const T& nodeLeftWeak, const T& nodeRightWeak)
-        {
-            auto nodeLeft = nodeLeftWeak.Upgrade();
-            auto nodeRight = nodeRightWeak.Upgrade();
-            if (!nodeLeft || !nodeRight) {
-                return false;
-            }
-            auto compare = NodeCompare<decltype(nodeLeft)>();
-            return compare(nodeLeft, nodeRight);
-        }
-    };
+    // Flush layout and render tasks of UITaskScheduler, recording the statistics of each phase.
+    void FlushUITasks();
+    void FlushPredictTask(int64_t deadline);
 
     std::unordered_map<uint32_t, WeakPtr<ScheduleTask>> scheduleTasks_;
-    std::set<WeakPtr<CustomNode>, NodeCompareWeak<WeakPtr<CustomNode>>> dirtyNodes_;
+    // CustomNode is deduplicated by its own need rebuild flag, the queue does not keep removed nodes alive.
+    DirtyNodeQueue<CustomNode, WeakPtr<CustomNode>> dirtyNodes_;
+    DirtyNodeQueue<CustomNode, WeakPtr<CustomNode>> flushingNodes_;
     std::list<TouchEvent> touchEvents_;
+    TouchEventCoalescer touchEventCoalescer_;
+    std::list<PredictTask> predictTasks_;
 
     RefPtr<FrameNode> rootNode_ = nullptr;
     RefPtr<StageManager> stageManager_ = nullptr;
     uint32_t nextScheduleTaskId_ = 0;
+    uint64_t vsyncTime_ = 0;
     bool hasIdleTasks_ = false;
     ACE_DISALLOW_COPY_AND_MOVE(PipelineContext);
 };
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/memory/ace_type.h"
+#include "core/pipeline_ng/dirty_node_queue.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+class FakeNode : public AceType {
+    DECLARE_ACE_TYPE(FakeNode, AceType);
+
+public:
+    FakeNode(int32_t id, int32_t depth) : id_(id), depth_(depth) {}
+    ~FakeNode() override = default;
+
+    int32_t GetId() const
+    {
+        return id_;
+    }
+
+    int32_t GetDepth() const
+    {
+        return depth_;
+    }
+
+private:
+    int32_t id_ = 0;
+    int32_t depth_ = 0;
+};
+} // namespace
+
+class DirtyNodeQueueTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: DirtyNodeQueueTest001
+ * @tc.desc: Nodes are visited from low depth to high depth, in push order for the same depth.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DirtyNodeQueueTest, DirtyNodeQueueTest001, TestSize.Level1)
+{
+    DirtyNodeQueue<FakeNode> queue;
+    queue.Push(AceType::MakeRefPtr<FakeNode>(0, 3));
+    queue.Push(AceType::MakeRefPtr<FakeNode>(1, 1));
+    queue.Push(AceType::MakeRefPtr<FakeNode>(2, 3));
+    queue.Push(AceType::MakeRefPtr<FakeNode>(3, 2));
+    EXPECT_EQ(queue.Size(), 4);
+
+    std::vector<int32_t> ids;
+    queue.ForEach([&ids](const RefPtr<FakeNode>& node) { ids.emplace_back(node->GetId()); });
+    std::vector<int32_t> expected = { 1, 3, 0, 2 };
+    EXPECT_EQ(ids, expected);
+}
+
+/**
+ * @tc.name: DirtyNodeQueueTest002
+ * @tc.desc: Clear releases nodes and Swap exchanges the content of two queues.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DirtyNodeQueueTest, DirtyNodeQueueTest002, TestSize.Level1)
+{
+    DirtyNodeQueue<FakeNode> dirty;
+    DirtyNodeQueue<FakeNode> flushing;
+    dirty.Push(AceType::MakeRefPtr<FakeNode>(0, 5));
+    WeakPtr<FakeNode> weakNode;
+    dirty.ForEach([&weakNode](const RefPtr<FakeNode>& node) { weakNode = node; });
+    EXPECT_TRUE(weakNode.Upgrade());
+
+    flushing.Swap(dirty);
+    EXPECT_TRUE(dirty.Empty());
+    EXPECT_EQ(flushing.Size(), 1);
+
+    flushing.Clear();
+    EXPECT_TRUE(flushing.Empty());
+    EXPECT_FALSE(weakNode.Upgrade());
+
+    int32_t count = 0;
+    flushing.ForEach([&count](const RefPtr<FakeNode>& /* node */) { ++count; });
+    EXPECT_EQ(count, 0);
+}
+
+/**
+ * @tc.name: DirtyNodeQueueTest003
+ * @tc.desc: Queue with weak pointers does not keep the nodes alive.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DirtyNodeQueueTest, DirtyNodeQueueTest003, TestSize.Level1)
+{
+    DirtyNodeQueue<FakeNode, WeakPtr<FakeNode>> queue;
+    auto alive = AceType::MakeRefPtr<FakeNode>(0, 1);
+    queue.Push(alive);
+    queue.Push(AceType::MakeRefPtr<FakeNode>(1, 0));
+
+    std::vector<int32_t> ids;
+    queue.ForEach([&ids](const WeakPtr<FakeNode>& weak) {
+        auto node = weak.Upgrade();
+        if (node) {
+            ids.emplace_back(node->GetId());
+        }
+    });
+    std::vector<int32_t> expected = { 0 };
+    EXPECT_EQ(ids, expected);
+}
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <list>
+
+#include "gtest/gtest.h"
+
+#include "base/utils/system_properties.h"
+#include "core/pipeline_ng/touch_event_coalescer.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+
+constexpr int32_t FIRST_POINTER = 0;
+constexpr int32_t SECOND_POINTER = 1;
+constexpr int32_t MOVE_COUNT = 4;
+constexpr float MOVE_STEP = 10.0f;
+
+TimeStamp Milliseconds(int64_t ms)
+{
+    return TimeStamp(std::chrono::milliseconds(ms));
+}
+
+TouchEvent CreateEvent(int32_t id, TouchType type, float x, int64_t ms)
+{
+    TouchEvent event { id, x, 0.0f, x, 0.0f, type, Milliseconds(ms) };
+    event.pointers.push_back({ id, x, 0.0f, x, 0.0f });
+    return event;
+}
+
+} // namespace
+
+class TouchEventCoalescerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+};
+
+/**
+ * @tc.name: TouchEventCoalescerTest001
+ * @tc.desc: Moves of every pointer in a frame are merged to one event, raw samples are kept in history.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchEventCoalescerTest, TouchEventCoalescerTest001, TestSize.Level1)
+{
+    TouchEventCoalescer coalescer;
+    coalescer.SetResampleEnabled(false);
+    std::list<TouchEvent> events;
+    for (int32_t index = 1; index <= MOVE_COUNT; ++index) {
+        events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, index * MOVE_STEP, index * 4));
+        events.emplace_back(CreateEvent(SECOND_POINTER, TouchType::MOVE, -index * MOVE_STEP, index * 4));
+    }
+    auto result = coalescer.Coalesce(std::move(events), Milliseconds(20));
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result.front().id, FIRST_POINTER);
+    EXPECT_EQ(result.back().id, SECOND_POINTER);
+    for (const auto& event : result) {
+        float sign = event.id == FIRST_POINTER ? 1.0f : -1.0f;
+        EXPECT_EQ(event.x, sign * MOVE_COUNT * MOVE_STEP);
+        ASSERT_EQ(event.history.size(), static_cast<size_t>(MOVE_COUNT));
+        for (int32_t index = 0; index < MOVE_COUNT; ++index) {
+            EXPECT_EQ(event.history[index].x, sign * (index + 1) * MOVE_STEP);
+            EXPECT_EQ(event.history[index].time, Milliseconds((index + 1) * 4));
+        }
+    }
+}
+
+/**
+ * @tc.name: TouchEventCoalescerTest002
+ * @tc.desc: Down and up events are kept in order, moves are not merged across them.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchEventCoalescerTest, TouchEventCoalescerTest002, TestSize.Level1)
+{
+    TouchEventCoalescer coalescer;
+    std::list<TouchEvent> events;
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::DOWN, 0.0f, 1));
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 10.0f, 2));
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 20.0f, 3));
+    events.emplace_back(CreateEvent(SECOND_POINTER, TouchType::DOWN, 50.0f, 4));
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 30.0f, 5));
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::UP, 30.0f, 6));
+    auto result = coalescer.Coalesce(std::move(events), Milliseconds(8));
+
+    std::vector<TouchType> types;
+    for (const auto& event : result) {
+        types.push_back(event.type);
+    }
+    std::vector<TouchType> expected = { TouchType::DOWN, TouchType::MOVE, TouchType::DOWN, TouchType::MOVE,
+        TouchType::UP };
+    EXPECT_EQ(types, expected);
+    auto iter = std::next(result.begin());
+    EXPECT_EQ(iter->x, 20.0f);
+    EXPECT_EQ(iter->history.size(), 2u);
+    EXPECT_EQ(std::next(iter, 2)->history.size(), 0u);
+    EXPECT_EQ(result.back().x, 30.0f);
+}
+
+/**
+ * @tc.name: TouchEventCoalescerTest003
+ * @tc.desc: Position is interpolated or predicted at the frame time, and the prediction is limited.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchEventCoalescerTest, TouchEventCoalescerTest003, TestSize.Level1)
+{
+    TouchEventCoalescer coalescer;
+    std::list<TouchEvent> events;
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::DOWN, 0.0f, 0));
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 100.0f, 10));
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 200.0f, 20));
+    // sample time is 13ms, between the two moves.
+    auto result = coalescer.Coalesce(std::move(events), Milliseconds(18));
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_FLOAT_EQ(result.back().x, 130.0f);
+    EXPECT_FLOAT_EQ(result.back().pointers.front().x, 130.0f);
+    EXPECT_EQ(result.back().time, Milliseconds(13));
+    ASSERT_EQ(result.back().history.size(), 2u);
+    EXPECT_EQ(result.back().history.back().x, 200.0f);
+
+    // sample time is 31ms, prediction is limited to half of the delta.
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 300.0f, 30));
+    result = coalescer.Coalesce(std::move(events), Milliseconds(36));
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_FLOAT_EQ(result.back().x, 310.0f);
+    EXPECT_EQ(result.back().time, Milliseconds(31));
+    result = coalescer.Coalesce({}, Milliseconds(40));
+    EXPECT_TRUE(result.empty());
+
+    // samples too far apart are not resampled.
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 400.0f, 60));
+    result = coalescer.Coalesce(std::move(events), Milliseconds(70));
+    ASSERT_EQ(result.size(), 1u);
+    EXPECT_EQ(result.back().x, 400.0f);
+    EXPECT_TRUE(result.back().history.empty());
+}
+
+/**
+ * @tc.name: TouchEventCoalescerTest004
+ * @tc.desc: Position is not resampled when resample is disabled or after the pointer is up.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchEventCoalescerTest, TouchEventCoalescerTest004, TestSize.Level1)
+{
+    TouchEventCoalescer coalescer;
+    coalescer.SetResampleEnabled(false);
+    std::list<TouchEvent> events;
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::DOWN, 0.0f, 0));
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 100.0f, 10));
+    auto result = coalescer.Coalesce(std::move(events), Milliseconds(30));
+    EXPECT_EQ(result.back().x, 100.0f);
+    EXPECT_EQ(result.back().time, Milliseconds(10));
+
+    coalescer.SetResampleEnabled(true);
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::UP, 100.0f, 12));
+    coalescer.Coalesce(std::move(events), Milliseconds(30));
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, 200.0f, 20));
+    result = coalescer.Coalesce(std::move(events), Milliseconds(30));
+    EXPECT_EQ(result.back().x, 200.0f);
+}
+
+/**
+ * @tc.name: TouchEventCoalescerTest005
+ * @tc.desc: Moves are merged by default while resample is disabled, as the pipeline configures the coalescer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(TouchEventCoalescerTest, TouchEventCoalescerTest005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. check the default properties.
+     * @tc.expected: step1. coalesce is enabled and resample is not.
+     */
+    ASSERT_TRUE(SystemProperties::GetTouchCoalesceEnabled());
+    ASSERT_FALSE(SystemProperties::GetTouchResampleEnabled());
+
+    /**
+     * @tc.steps: step2. coalesce moves with resample set from the properties.
+     * @tc.expected: step2. moves are merged to the latest raw sample, the position is not resampled.
+     */
+    TouchEventCoalescer coalescer;
+    coalescer.SetResampleEnabled(SystemProperties::GetTouchResampleEnabled());
+    std::list<TouchEvent> events;
+    events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::DOWN, 0.0f, 0));
+    for (int32_t index = 1; index <= MOVE_COUNT; ++index) {
+        events.emplace_back(CreateEvent(FIRST_POINTER, TouchType::MOVE, index * MOVE_STEP, index * 4));
+    }
+    auto result = coalescer.Coalesce(std::move(events), Milliseconds(20));
+    ASSERT_EQ(result.size(), 2u);
+    EXPECT_EQ(result.back().x, MOVE_COUNT * MOVE_STEP);
+    EXPECT_EQ(result.back().time, Milliseconds(MOVE_COUNT * 4));
+    EXPECT_EQ(result.back().history.size(), static_cast<size_t>(MOVE_COUNT));
+}
+
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/pipeline_ng/touch_event_coalescer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+namespace OHOS::Ace::NG {
+namespace {
+
+// same as the input resampling of Android: the frame shows the position at 5ms before the frame time, which is
+// interpolated between two samples or predicted from the latest two samples at most 8ms ahead.
+constexpr std::chrono::nanoseconds RESAMPLE_LATENCY = std::chrono::milliseconds(5);
+constexpr std::chrono::nanoseconds RESAMPLE_MIN_DELTA = std::chrono::milliseconds(2);
+constexpr std::chrono::nanoseconds RESAMPLE_MAX_DELTA = std::chrono::milliseconds(20);
+constexpr std::chrono::nanoseconds RESAMPLE_MAX_PREDICTION = std::chrono::milliseconds(8);
+constexpr int32_t RESAMPLE_MIN_SAMPLES = 2;
+
+// Keep the position and time of the raw sample, pointers of the frame are in the merged event.
+TouchSample CreateSample(const TouchEvent& event)
+{
+    return { event.x, event.y, event.screenX, event.screenY, event.time };
+}
+
+float Lerp(float start, float end, float alpha)
+{
+    return start + (end - start) * alpha;
+}
+
+} // namespace
+
+std::list<TouchEvent> TouchEventCoalescer::Coalesce(std::list<TouchEvent>&& events, TimeStamp frameTime)
+{
+    std::list<TouchEvent> result;
+    // the pending move of every pointer, which later moves of the same pointer are merged into.
+    std::unordered_map<int32_t, std::list<TouchEvent>::iterator> pendingMoves;
+    for (auto& event : events) {
+        if (event.type != TouchType::MOVE) {
+            // moves are not merged across down and up, recognizers rely on the order of them.
+            pendingMoves.clear();
+            if (event.type == TouchType::DOWN) {
+                samples_.erase(event.id);
+                AddSample(event);
+            } else {
+                samples_.erase(event.id);
+            }
+            result.emplace_back(std::move(event));
+            continue;
+        }
+
+        AddSample(event);
+        auto pending = pendingMoves.find(event.id);
+        if (pending != pendingMoves.end()) {
+            auto& merged = *pending->second;
+            auto history = std::move(merged.history);
+            if (history.empty()) {
+                history.emplace_back(CreateSample(merged));
+            }
+            history.emplace_back(CreateSample(event));
+            event.history = std::move(history);
+            result.erase(pending->second);
+        }
+        result.emplace_back(std::move(event));
+        pendingMoves[result.back().id] = std::prev(result.end());
+    }
+    events.clear();
+
+    if (resampleEnabled_) {
+        for (auto& [id, move] : pendingMoves) {
+            Resample(*move, frameTime);
+        }
+    }
+    return result;
+}
+
+void TouchEventCoalescer::AddSample(const TouchEvent& event)
+{
+    auto& samples = samples_[event.id];
+    samples.previous = samples.latest;
+    samples.latest = CreateSample(event);
+    ++samples.count;
+}
+
+void TouchEventCoalescer::Resample(TouchEvent& event, TimeStamp frameTime) const
+{
+    auto iter = samples_.find(event.id);
+    if (iter == samples_.end() || iter->second.count < RESAMPLE_MIN_SAMPLES) {
+        return;
+    }
+    const auto& previous = iter->second.previous;
+    const auto& latest = iter->second.latest;
+    auto delta = latest.time - previous.time;
+    if (delta < RESAMPLE_MIN_DELTA || delta > RESAMPLE_MAX_DELTA) {
+        return;
+    }
+    auto sampleTime = frameTime - RESAMPLE_LATENCY;
+    if (sampleTime > latest.time) {
+        // predict ahead of the latest sample.
+        auto maxPrediction = std::min<std::chrono::nanoseconds>(delta / 2, RESAMPLE_MAX_PREDICTION);
+        sampleTime = std::min(sampleTime, latest.time + maxPrediction);
+    } else if (sampleTime < previous.time) {
+        return;
+    }
+    if (sampleTime == latest.time) {
+        return;
+    }
+
+    auto alpha = std::chrono::duration<float>(sampleTime - previous.time).count() /
+                 std::chrono::duration<float>(delta).count();
+    if (event.history.empty()) {
+        event.history.emplace_back(CreateSample(event));
+    }
+    event.x = Lerp(previous.x, latest.x, alpha);
+    event.y = Lerp(previous.y, latest.y, alpha);
+    event.screenX = Lerp(previous.screenX, latest.screenX, alpha);
+    event.screenY = Lerp(previous.screenY, latest.screenY, alpha);
+    event.time = std::chrono::time_point_cast<TimeStamp::duration>(sampleTime);
+    for (auto& pointer : event.pointers) {
+        if (pointer.id == event.id) {
+            pointer.x = event.x;
+            pointer.y = event.y;
+            pointer.screenX = event.screenX;
+            pointer.screenY = event.screenY;
+        }
+    }
+}
+
+} // namespace OHOS::Ace::NG
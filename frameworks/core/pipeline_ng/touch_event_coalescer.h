@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_NG_TOUCH_EVENT_COALESCER_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_NG_TOUCH_EVENT_COALESCER_H
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+#include "core/event/touch_event.h"
+
+namespace OHOS::Ace::NG {
+
+// Merges the touch events received in a frame before they are dispatched. Move events of a pointer are merged to one
+// event keeping the raw samples in history, so recognizers handle one move per pointer per frame whatever the report
+// rate of the touch panel is. When resample is enabled, the position is also resampled at the frame time so the moves
+// have a steady rate.
+class ACE_EXPORT TouchEventCoalescer final {
+public:
+    TouchEventCoalescer() = default;
+    ~TouchEventCoalescer() = default;
+
+    // Returns the events to dispatch in the frame at frameTime. Down, up and cancel events are kept in order, moves
+    // are only merged between them.
+    std::list<TouchEvent> Coalesce(std::list<TouchEvent>&& events, TimeStamp frameTime);
+
+    void SetResampleEnabled(bool enabled)
+    {
+        resampleEnabled_ = enabled;
+    }
+
+private:
+    // last two raw samples of a pointer, kept across frames.
+    struct PointerSamples {
+        TouchSample previous;
+        TouchSample latest;
+        int32_t count = 0;
+    };
+
+    void AddSample(const TouchEvent& event);
+    void Resample(TouchEvent& event, TimeStamp frameTime) const;
+
+    std::unordered_map<int32_t, PointerSamples> samples_;
+    bool resampleEnabled_ = true;
+
+    ACE_DISALLOW_COPY_AND_MOVE(TouchEventCoalescer);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_NG_TOUCH_EVENT_COALESCER_H
@@ -15,12 +15,91 @@
 
 #include "core/pipeline_ng/ui_task_scheduler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <unordered_set>
+
 #include "base/thread/background_task_executor.h"
 #include "base/thread/cancelable_callback.h"
+#include "base/utils/system_properties.h"
+#include "core/common/container_scope.h"
 #include "core/common/thread_checker.h"
 #include "core/components_ng/base/frame_node.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+
+// Batch of tasks shared by main thread and background threads, every thread claims tasks by index until all of them
+// are claimed, so main thread never waits for a background thread which has not started yet.
+class UITaskBatch final {
+public:
+    explicit UITaskBatch(std::vector<UITask>&& tasks) : tasks_(std::move(tasks)), taskCount_(tasks_.size()) {}
+    ~UITaskBatch() = default;
+
+    // Called on any thread.
+    void Drain()
+    {
+        auto index = nextIndex_.fetch_add(1, std::memory_order_relaxed);
+        while (index < taskCount_) {
+            tasks_[index]();
+            if (finishedCount_.fetch_add(1, std::memory_order_acq_rel) + 1 == taskCount_) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                condition_.notify_all();
+            }
+            index = nextIndex_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Called on main thread, wait until all the claimed tasks finished.
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return finishedCount_.load(std::memory_order_acquire) == taskCount_; });
+    }
+
+    // Only valid after Wait, the batch may be released on background thread, so take the tasks back to main thread.
+    std::vector<UITask> TakeTasks()
+    {
+        return std::move(tasks_);
+    }
+
+private:
+    std::vector<UITask> tasks_;
+    const size_t taskCount_;
+    std::atomic<size_t> nextIndex_ { 0 };
+    std::atomic<size_t> finishedCount_ { 0 };
+    std::mutex mutex_;
+    std::condition_variable condition_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(UITaskBatch);
+};
+
+size_t GetParallelWorkerCount(size_t taskCount)
+{
+    // Main thread takes part in the batch as well.
+    size_t hardwareThreads = std::thread::hardware_concurrency();
+    size_t maxWorkers = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    return std::min(taskCount - 1, maxWorkers);
+}
+
+bool HasPendingAncestor(const RefPtr<FrameNode>& node, const std::unordered_set<const UINode*>& pendingNodes)
+{
+    if (pendingNodes.empty()) {
+        return false;
+    }
+    auto parent = node->GetParent();
+    while (parent) {
+        if (pendingNodes.count(AceType::RawPtr(parent)) != 0) {
+            return true;
+        }
+        parent = parent->GetParent();
+    }
+    return false;
+}
+
+} // namespace
 
 std::unique_ptr<UITaskScheduler> UITaskScheduler::instance_ = nullptr;
 
@@ -44,7 +123,11 @@ void UITaskScheduler::AddDirtyLayoutNode(const RefPtr<FrameNode>& dirty)
         LOGW("dirty is null");
         return;
     }
-    dirtyLayoutNodes_[dirty->GetRootId()][dirty->GetPageId()].emplace(dirty);
+    if (dirty->IsInDirtyLayoutQueue()) {
+        return;
+    }
+    dirty->SetInDirtyLayoutQueue(true);
+    dirtyLayoutNodes_.Push(dirty);
 }
 
 void UITaskScheduler::AddDirtyRenderNode(const RefPtr<FrameNode>& dirty)
@@ -54,28 +137,75 @@ void UITaskScheduler::AddDirtyRenderNode(const RefPtr<FrameNode>& dirty)
         LOGW("dirty is null");
         return;
     }
-    dirtyRenderNodes_[dirty->GetRootId()][dirty->GetPageId()].emplace(dirty);
+    if (dirty->IsInDirtyRenderQueue()) {
+        return;
+    }
+    dirty->SetInDirtyRenderQueue(true);
+    dirtyRenderNodes_.Push(dirty);
 }
 
 void UITaskScheduler::FlushLayoutTask(bool onCreate, bool forceUseMainThread)
 {
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACE();
-    auto dirtyLayoutNodes = std::move(dirtyLayoutNodes_);
+    flushingLayoutNodes_.Swap(dirtyLayoutNodes_);
+    bool parallel = !forceUseMainThread && SystemProperties::GetParallelLayoutEnabled();
+    std::vector<UITask> backgroundTasks;
+    std::unordered_set<const UINode*> pendingNodes;
     // Priority task creation
-    for (auto&& rootNodes : dirtyLayoutNodes) {
-        for (auto&& pageNodes : rootNodes.second) {
-            for (auto&& node : pageNodes.second) {
-                auto task = node->CreateLayoutTask(onCreate, forceUseMainThread);
-                if (task) {
-                    if (forceUseMainThread || (task->GetTaskThreadType() == MAIN_TASK)) {
-                        (*task)();
-                    } else {
-                        LOGW("need to use multithread feature");
-                    }
-                }
-            }
+    flushingLayoutNodes_.ForEach([onCreate, forceUseMainThread, parallel, &backgroundTasks, &pendingNodes](
+                                     const RefPtr<FrameNode>& node) {
+        node->SetInDirtyLayoutQueue(false);
+        // The layout constraint and parent offset are captured when the task is created, so the pending ancestors
+        // must be measured and mounted before that.
+        if (HasPendingAncestor(node, pendingNodes)) {
+            FlushParallelTask(std::move(backgroundTasks));
+            backgroundTasks.clear();
+            pendingNodes.clear();
+        }
+        auto task = node->CreateLayoutTask(onCreate, forceUseMainThread);
+        if (!task) {
+            return;
         }
+        if (!parallel || (task->GetTaskThreadType() == MAIN_TASK)) {
+            (*task)();
+            task->Commit();
+            return;
+        }
+        pendingNodes.emplace(AceType::RawPtr(node));
+        backgroundTasks.emplace_back(std::move(*task));
+    });
+    flushingLayoutNodes_.Clear();
+    FlushParallelTask(std::move(backgroundTasks));
+}
+
+void UITaskScheduler::FlushParallelTask(std::vector<UITask>&& tasks)
+{
+    if (tasks.empty()) {
+        return;
+    }
+    if (tasks.size() == 1) {
+        tasks.front()();
+        tasks.front().Commit();
+        return;
+    }
+    ACE_SCOPED_TRACE("UITaskScheduler::FlushParallelTask %zu", tasks.size());
+    auto workerCount = GetParallelWorkerCount(tasks.size());
+    auto batch = std::make_shared<UITaskBatch>(std::move(tasks));
+    auto instanceId = ContainerScope::CurrentId();
+    for (size_t i = 0; i < workerCount; ++i) {
+        BackgroundTaskExecutor::GetInstance().PostTask([batch, instanceId]() {
+            ContainerScope scope(instanceId);
+            ACE_SCOPED_TRACE("UITaskScheduler::ParallelWorker");
+            batch->Drain();
+        });
+    }
+    batch->Drain();
+    batch->Wait();
+    // Dirty nodes are sorted by depth, so the subtrees are mounted from top to bottom.
+    auto finishedTasks = batch->TakeTasks();
+    for (const auto& task : finishedTasks) {
+        task.Commit();
     }
 }
 
@@ -83,22 +213,25 @@ void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
 {
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACE();
-    auto dirtyRenderNodes = std::move(dirtyRenderNodes_);
+    flushingRenderNodes_.Swap(dirtyRenderNodes_);
+    bool parallel = !forceUseMainThread && SystemProperties::GetParallelRenderEnabled();
+    std::vector<UITask> backgroundTasks;
     // Priority task creation
-    for (auto&& rootNodes : dirtyRenderNodes) {
-        for (auto&& pageNodes : rootNodes.second) {
-            for (auto&& node : pageNodes.second) {
-                auto task = node->CreateRenderTask(forceUseMainThread);
-                if (task) {
-                    if (forceUseMainThread || (task->GetTaskThreadType() == MAIN_TASK)) {
-                        (*task)();
-                    } else {
-                        LOGW("need to use multithread feature");
-                    }
-                }
-            }
+    flushingRenderNodes_.ForEach([forceUseMainThread, parallel, &backgroundTasks](const RefPtr<FrameNode>& node) {
+        node->SetInDirtyRenderQueue(false);
+        auto task = node->CreateRenderTask(forceUseMainThread);
+        if (!task) {
+            return;
         }
-    }
+        if (!parallel || (task->GetTaskThreadType() == MAIN_TASK)) {
+            (*task)();
+            task->Commit();
+            return;
+        }
+        backgroundTasks.emplace_back(std::move(*task));
+    });
+    flushingRenderNodes_.Clear();
+    FlushParallelTask(std::move(backgroundTasks));
 }
 
 void UITaskScheduler::FlushTask()
@@ -19,11 +19,11 @@
 #include <cstdint>
 #include <functional>
 #include <mutex>
-#include <set>
-#include <unordered_map>
+#include <vector>
 
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
+#include "core/pipeline_ng/dirty_node_queue.h"
 
 namespace OHOS::Ace::NG {
 
@@ -41,6 +41,12 @@ public:
 
     UITask(std::function<void()>&& task, TaskThread taskThread) : task_(std::move(task)), taskThread_(taskThread) {}
 
+    // The commit task is used to sync the result of a task running on background thread, it is always called on main
+    // thread after the task finished.
+    UITask(std::function<void()>&& task, TaskThread taskThread, std::function<void()>&& commitTask)
+        : task_(std::move(task)), commitTask_(std::move(commitTask)), taskThread_(taskThread)
+    {}
+
     ~UITask() = default;
 
     void SetTaskThreadType(TaskThread taskThread)
@@ -60,8 +66,16 @@ public:
         }
     }
 
+    void Commit() const
+    {
+        if (commitTask_) {
+            commitTask_();
+        }
+    }
+
 private:
     std::function<void()> task_;
+    std::function<void()> commitTask_;
     TaskThread taskThread_ = MAIN_TASK;
 };
 
@@ -79,6 +93,16 @@ public:
     void FlushRenderTask(bool forceUseMainThread = false);
     void FlushTask();
 
+    size_t GetDirtyLayoutNodeCount() const
+    {
+        return dirtyLayoutNodes_.Size();
+    }
+
+    size_t GetDirtyRenderNodeCount() const
+    {
+        return dirtyRenderNodes_.Size();
+    }
+
     void UpdateCurrentRootId(uint32_t id)
     {
         currentRootId_ = id;
@@ -92,26 +116,16 @@ public:
 private:
     UITaskScheduler() = default;
 
-    template<typename T>
-    struct NodeCompare {
-        bool operator()(const T& nodeLeft, const T& nodeRight)
-        {
-            if (nodeLeft->GetDepth() < nodeRight->GetDepth()) {
-                return true;
-            }
-            if (nodeLeft->GetDepth() == nodeRight->GetDepth()) {
-                return nodeLeft < nodeRight;
-            }
-            return false;
-        }
-    };
-
-    using PageDirtySet = std::set<RefPtr<FrameNode>, NodeCompare<RefPtr<FrameNode>>>;
-    using RootDirtyMap = std::unordered_map<uint32_t, PageDirtySet>;
+    // Run background tasks in parallel and commit the results on main thread in depth order.
+    static void FlushParallelTask(std::vector<UITask>&& tasks);
 
-    std::unordered_map<uint32_t, RootDirtyMap> dirtyLayoutNodes_;
+    // Nodes marked in current frame.
+    DirtyNodeQueue<FrameNode> dirtyLayoutNodes_;
+    DirtyNodeQueue<FrameNode> dirtyRenderNodes_;
 
-    std::unordered_map<uint32_t, RootDirtyMap> dirtyRenderNodes_;
+    // Nodes being flushed, swapped with the dirty queues at the beginning of flush to reuse the memory.
+    DirtyNodeQueue<FrameNode> flushingLayoutNodes_;
+    DirtyNodeQueue<FrameNode> flushingRenderNodes_;
 
     // Singleton instance
     static std::unique_ptr<UITaskScheduler> instance_;
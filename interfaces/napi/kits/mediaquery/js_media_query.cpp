@@ -85,8 +85,8 @@ public:
     {
         const std::lock_guard<std::mutex> lock(mutex_);
         MediaQueryer queryer;
+        auto json = MediaQueryInfo::GetMediaQueryJsonInfo();
         for (auto listener : listenerSets_[jsEngine]) {
-            auto json = MediaQueryInfo::GetMediaQueryJsonInfo();
             listener->matches_ = queryer.MatchCondition(listener->media_, json);
             for (auto& cbRef : listener->cbList_) {
                 napi_value thisVal = nullptr;
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "base/geometry/dimension.h"
+#include "base/utils/string_expression.h"
+#include "core/components_ng/property/calc_length.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr double ROOT_WIDTH = 720.0;
+constexpr double DENSITY = 3.0;
+constexpr int32_t LIST_ITEM_COUNT = 1000;
+
+// calc() expressions of a page, each is evaluated by every layout of the nodes using it.
+const std::vector<std::string> CALC_EXPRESSIONS = {
+    "calc(100% - 32vp)",
+    "calc(50% + 2 * 8vp)",
+    "calc((100% - 3 * 12vp) / 4)",
+    "calc(100px + 20% - 4vp * 2)",
+};
+
+double ConvertToPx(const Dimension& dimension)
+{
+    switch (dimension.Unit()) {
+        case DimensionUnit::PERCENT:
+            return dimension.Value() * ROOT_WIDTH;
+        case DimensionUnit::VP:
+            return dimension.Value() * DENSITY;
+        default:
+            return dimension.Value();
+    }
+}
+
+// Parse and evaluate the expression every time.
+void EvaluateCalcString(benchmark::State& state)
+{
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (const auto& expression : CALC_EXPRESSIONS) {
+            sum += StringExpression::CalculateExp(expression, ConvertToPx);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(CALC_EXPRESSIONS.size()));
+}
+BENCHMARK(EvaluateCalcString);
+
+// Evaluate the programs compiled when the properties are set, as the layout does.
+void EvaluateCalcProgram(benchmark::State& state)
+{
+    std::vector<StringExpression::CalcProgram> programs;
+    for (const auto& expression : CALC_EXPRESSIONS) {
+        programs.emplace_back(StringExpression::CompileExp(expression));
+    }
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (const auto& program : programs) {
+            sum += StringExpression::CalculateExp(program, ConvertToPx);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(programs.size()));
+}
+BENCHMARK(EvaluateCalcProgram);
+
+void CompileCalc(benchmark::State& state)
+{
+    for (auto _ : state) {
+        for (const auto& expression : CALC_EXPRESSIONS) {
+            auto program = StringExpression::CompileExp(expression);
+            benchmark::DoNotOptimize(program.instructions.data());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(CALC_EXPRESSIONS.size()));
+}
+BENCHMARK(CompileCalc);
+
+// Measure the calc() widths of the items of a list. Arg 0 parses the expression strings in every measure, arg 1
+// normalizes the lengths with their cached programs.
+void MeasureCalcList(benchmark::State& state)
+{
+    bool useProgram = state.range(0) != 0;
+    std::vector<NG::CalcLength> widths;
+    widths.reserve(LIST_ITEM_COUNT);
+    for (int32_t index = 0; index < LIST_ITEM_COUNT; ++index) {
+        widths.emplace_back(CALC_EXPRESSIONS[index % CALC_EXPRESSIONS.size()]);
+    }
+    for (auto _ : state) {
+        double sum = 0.0;
+        for (const auto& width : widths) {
+            double result = 0.0;
+            if (useProgram) {
+                width.NormalizeToPx(DENSITY, DENSITY, 1.0, ROOT_WIDTH, result);
+            } else {
+                result = StringExpression::CalculateExp(width.CalcValue(), ConvertToPx);
+            }
+            sum += result;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LIST_ITEM_COUNT);
+}
+BENCHMARK(MeasureCalcList)->ArgName("cached")->Arg(0)->Arg(1);
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
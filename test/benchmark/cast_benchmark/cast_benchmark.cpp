@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// A pattern like chain of single inheritance, as FrameNode, Pattern and LayoutAlgorithm classes.
+class ChainLevel0 : public virtual AceType {
+    DECLARE_ACE_TYPE(ChainLevel0, AceType);
+};
+
+class ChainLevel1 : public ChainLevel0 {
+    DECLARE_ACE_TYPE(ChainLevel1, ChainLevel0);
+};
+
+class ChainLevel2 : public ChainLevel1 {
+    DECLARE_ACE_TYPE(ChainLevel2, ChainLevel1);
+};
+
+class ChainLevel3 : public ChainLevel2 {
+    DECLARE_ACE_TYPE(ChainLevel3, ChainLevel2);
+};
+
+class ChainLevel4 : public ChainLevel3 {
+    DECLARE_ACE_TYPE(ChainLevel4, ChainLevel3);
+};
+
+class ChainLevel5 : public ChainLevel4 {
+    DECLARE_ACE_TYPE(ChainLevel5, ChainLevel4);
+};
+
+// Interfaces mixed into a class, as the listeners of LazyForEachBuilder.
+class ListenerA : public virtual AceType {
+    DECLARE_ACE_TYPE(ListenerA, AceType);
+};
+
+class ListenerB : public virtual AceType {
+    DECLARE_ACE_TYPE(ListenerB, AceType);
+};
+
+class MultiBase final : public ChainLevel5, public ListenerA, public ListenerB {
+    DECLARE_ACE_TYPE(MultiBase, ChainLevel5, ListenerA, ListenerB);
+};
+
+class Unrelated final : public virtual AceType {
+    DECLARE_ACE_TYPE(Unrelated, AceType);
+};
+
+// count of objects which are casted in turn, so the dynamic type is not known by the compiler.
+constexpr size_t OBJECT_COUNT = 64;
+constexpr int64_t CAST_PER_ITERATION = 1024;
+
+std::vector<RefPtr<AceType>> CreateObjects()
+{
+    std::vector<RefPtr<AceType>> objects;
+    objects.reserve(OBJECT_COUNT);
+    for (size_t index = 0; index < OBJECT_COUNT; ++index) {
+        objects.emplace_back(AceType::MakeRefPtr<MultiBase>());
+    }
+    return objects;
+}
+
+template<class T>
+void RunCast(benchmark::State& state, bool expectHit)
+{
+    auto objects = CreateObjects();
+    size_t index = 0;
+    for (auto _ : state) {
+        for (int64_t count = 0; count < CAST_PER_ITERATION; ++count) {
+            auto* object = AceType::RawPtr(objects[index]);
+            index = (index + 1) % OBJECT_COUNT;
+            benchmark::DoNotOptimize(object);
+            auto* result = AceType::DynamicCast<T>(object);
+            benchmark::DoNotOptimize(result);
+            if ((result != nullptr) != expectHit) {
+                state.SkipWithError("unexpected cast result");
+                return;
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * CAST_PER_ITERATION);
+}
+
+// Cast to the dynamic type, which is returned without walking.
+void CastToSelf(benchmark::State& state)
+{
+    RunCast<MultiBase>(state, true);
+}
+BENCHMARK(CastToSelf);
+
+// Casts to ancestors, which walk the inheritance tree to get the adjusted pointer.
+void CastToNearAncestor(benchmark::State& state)
+{
+    RunCast<ChainLevel5>(state, true);
+}
+BENCHMARK(CastToNearAncestor);
+
+void CastToFarAncestor(benchmark::State& state)
+{
+    RunCast<ChainLevel0>(state, true);
+}
+BENCHMARK(CastToFarAncestor);
+
+void CastToLastBase(benchmark::State& state)
+{
+    RunCast<ListenerB>(state, true);
+}
+BENCHMARK(CastToLastBase);
+
+void CastToRoot(benchmark::State& state)
+{
+    RunCast<AceType>(state, true);
+}
+BENCHMARK(CastToRoot);
+
+// Failed cast, which is rejected by the type id list of the dynamic type.
+void CastToUnrelated(benchmark::State& state)
+{
+    RunCast<Unrelated>(state, false);
+}
+BENCHMARK(CastToUnrelated);
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "frameworks/bridge/codec/codec_buffer_pool.h"
+#include "frameworks/bridge/codec/codec_data.h"
+#include "frameworks/bridge/codec/function_call.h"
+#include "frameworks/bridge/codec/standard_codec_buffer_operator.h"
+#include "frameworks/bridge/codec/standard_codec_stream_decoder.h"
+#include "frameworks/bridge/codec/standard_function_codec.h"
+
+namespace OHOS::Ace::Framework {
+namespace {
+
+constexpr int64_t MIN_ARRAY_SIZE = 8;
+constexpr int64_t MAX_ARRAY_SIZE = 1 << 16;
+constexpr int64_t ARRAY_SIZE_MULTIPLIER = 16;
+// image bytes crossing the platform bridge, received in chunks.
+constexpr int64_t MIN_IMAGE_BYTES = 256 * 1024;
+constexpr int64_t MAX_IMAGE_BYTES = 4 * 1024 * 1024;
+constexpr int64_t IMAGE_BYTES_MULTIPLIER = 4;
+constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+// Call of a plugin with small arguments and an int array of the given size, as a message between js and native.
+FunctionCall CreateFunctionCall(int64_t arraySize)
+{
+    std::vector<CodecData> args;
+    args.emplace_back(std::string("callback_1"));
+    args.emplace_back(static_cast<int32_t>(arraySize));
+    args.emplace_back(true);
+    args.emplace_back(std::vector<int32_t>(static_cast<size_t>(arraySize), 1));
+    return FunctionCall("onDataReceived", std::move(args));
+}
+
+LengthEncoding GetEncoding(const benchmark::State& state)
+{
+    return state.range(1) == 0 ? LengthEncoding::FIXED_INT32 : LengthEncoding::VARINT;
+}
+
+void CodecArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (int64_t size = MIN_ARRAY_SIZE; size <= MAX_ARRAY_SIZE; size *= ARRAY_SIZE_MULTIPLIER) {
+        benchmark->Args({ size, 0 });
+        benchmark->Args({ size, 1 });
+    }
+    benchmark->ArgNames({ "array", "varint" });
+}
+
+void EncodeFunctionCall(benchmark::State& state)
+{
+    auto functionCall = CreateFunctionCall(state.range(0));
+    StandardFunctionCodec codec(GetEncoding(state));
+    size_t size = 0;
+    for (auto _ : state) {
+        auto buffer = CodecBufferPool::GetInstance().Acquire();
+        codec.EncodeFunctionCall(functionCall, buffer);
+        size = buffer.size();
+        CodecBufferPool::GetInstance().Release(std::move(buffer));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    state.counters["encoded_bytes"] = static_cast<double>(size);
+}
+BENCHMARK(EncodeFunctionCall)->Apply(CodecArguments);
+
+void DecodeFunctionCall(benchmark::State& state)
+{
+    StandardFunctionCodec codec(GetEncoding(state));
+    std::vector<uint8_t> buffer;
+    codec.EncodeFunctionCall(CreateFunctionCall(state.range(0)), buffer);
+    for (auto _ : state) {
+        FunctionCall functionCall;
+        codec.DecodeFunctionCall(buffer, functionCall);
+        benchmark::DoNotOptimize(functionCall.GetArgs().size());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(buffer.size()));
+}
+BENCHMARK(DecodeFunctionCall)->Apply(CodecArguments);
+
+// Messages from platform are decoded to CodecData, which copies strings and arrays.
+void DecodePlatformMessage(benchmark::State& state)
+{
+    auto encoding = GetEncoding(state);
+    std::vector<uint8_t> buffer;
+    StandardCodecBufferWriter writer(buffer, encoding);
+    writer.WriteData(CodecData(std::vector<int32_t>(static_cast<size_t>(state.range(0)), 1)));
+    StandardFunctionCodec codec(encoding);
+    for (auto _ : state) {
+        CodecData message;
+        codec.DecodePlatformMessage(buffer.data(), buffer.size(), message);
+        benchmark::DoNotOptimize(message.GetInt32ArrayValue().size());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(buffer.size()));
+}
+BENCHMARK(DecodePlatformMessage)->Apply(CodecArguments);
+
+// Same messages decoded to views of the buffer without copy.
+void DecodePlatformMessageView(benchmark::State& state)
+{
+    auto encoding = GetEncoding(state);
+    std::vector<uint8_t> buffer;
+    StandardCodecBufferWriter writer(buffer, encoding);
+    writer.WriteData(CodecData(std::vector<int32_t>(static_cast<size_t>(state.range(0)), 1)));
+    StandardFunctionCodec codec(encoding);
+    for (auto _ : state) {
+        CodecDataView message;
+        codec.DecodePlatformMessageView(buffer.data(), buffer.size(), message);
+        benchmark::DoNotOptimize(message.arrayLength);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(buffer.size()));
+}
+BENCHMARK(DecodePlatformMessageView)->Apply(CodecArguments);
+
+// Encode a call and decode it again, as a message from js to native. Arg 1 encodes into a fresh vector as before the
+// buffer pool, arg 2 encodes into a pooled buffer.
+void RoundTripFunctionCall(benchmark::State& state)
+{
+    auto functionCall = CreateFunctionCall(state.range(0));
+    StandardFunctionCodec codec(GetEncoding(state));
+    bool pooled = state.range(2) != 0;
+    size_t size = 0;
+    for (auto _ : state) {
+        auto buffer = pooled ? CodecBufferPool::GetInstance().Acquire() : std::vector<uint8_t>();
+        codec.EncodeFunctionCall(functionCall, buffer);
+        FunctionCall decoded;
+        codec.DecodeFunctionCall(buffer, decoded);
+        benchmark::DoNotOptimize(decoded.GetArgs().size());
+        size = buffer.size();
+        if (pooled) {
+            CodecBufferPool::GetInstance().Release(std::move(buffer));
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+}
+void RoundTripArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (int64_t size = MIN_ARRAY_SIZE; size <= MAX_ARRAY_SIZE; size *= ARRAY_SIZE_MULTIPLIER) {
+        for (int64_t varint = 0; varint <= 1; ++varint) {
+            benchmark->Args({ size, varint, 0 });
+            benchmark->Args({ size, varint, 1 });
+        }
+    }
+    benchmark->ArgNames({ "array", "varint", "pooled" });
+}
+BENCHMARK(RoundTripFunctionCall)->Apply(RoundTripArguments);
+
+std::vector<uint8_t> CreateImageMessage(int64_t imageBytes)
+{
+    std::vector<uint8_t> buffer;
+    StandardCodecBufferWriter writer(buffer, LengthEncoding::VARINT);
+    writer.WriteData(CodecData(std::vector<int8_t>(static_cast<size_t>(imageBytes), 1)));
+    return buffer;
+}
+
+// Receive the image bytes in chunks. Arg 1 gathers the chunks and decodes the whole message, which copies the bytes
+// into CodecData. Arg 2 feeds the chunks to the stream decoder, and the bytes are copied to the image data as they
+// arrive.
+void ReceiveImageMessage(benchmark::State& state)
+{
+    auto message = CreateImageMessage(state.range(0));
+    bool streamed = state.range(1) != 0;
+    StandardFunctionCodec codec(LengthEncoding::VARINT);
+    std::vector<uint8_t> imageData;
+    imageData.reserve(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        size_t received = 0;
+        CodecData result;
+        if (streamed) {
+            imageData.clear();
+            StandardCodecStreamDecoder decoder(LengthEncoding::VARINT);
+            decoder.SetArrayChunkCallback([&imageData](const uint8_t* data, size_t size) {
+                imageData.insert(imageData.end(), data, data + size);
+            });
+            for (size_t offset = 0; offset < message.size(); offset += CHUNK_SIZE) {
+                decoder.Feed(message.data() + offset, std::min(CHUNK_SIZE, message.size() - offset));
+            }
+            decoder.Finish(result);
+            received = imageData.size();
+        } else {
+            std::vector<uint8_t> gathered;
+            for (size_t offset = 0; offset < message.size(); offset += CHUNK_SIZE) {
+                auto end = message.begin() + static_cast<std::ptrdiff_t>(std::min(offset + CHUNK_SIZE, message.size()));
+                gathered.insert(gathered.end(), message.begin() + static_cast<std::ptrdiff_t>(offset), end);
+            }
+            codec.DecodePlatformMessage(gathered, result);
+            received = result.GetInt8ArrayValue().size();
+        }
+        benchmark::DoNotOptimize(received);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(message.size()));
+}
+void ImageMessageArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (int64_t bytes = MIN_IMAGE_BYTES; bytes <= MAX_IMAGE_BYTES; bytes *= IMAGE_BYTES_MULTIPLIER) {
+        benchmark->Args({ bytes, 0 });
+        benchmark->Args({ bytes, 1 });
+    }
+    benchmark->ArgNames({ "bytes", "streamed" });
+}
+BENCHMARK(ReceiveImageMessage)->Apply(ImageMessageArguments);
+
+} // namespace
+} // namespace OHOS::Ace::Framework
+
+BENCHMARK_MAIN();
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/components/common/properties/color.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int32_t UNIQUE_COLOR_COUNT = 4096;
+constexpr int32_t COLOR_STRING_BASE = 16;
+constexpr size_t COLOR_STRING_SIZE_STANDARD = 8;
+constexpr uint32_t MASK_ALPHA = 0xff000000;
+
+const std::regex COLOR_WITH_MAGIC("#[0-9A-Fa-f]{6,8}");
+const std::regex COLOR_WITH_MAGIC_MINI("#[0-9A-Fa-f]{3,4}");
+const std::regex COLOR_WITH_RGB(R"(rgb\(([0-9]{1,3})\,([0-9]{1,3})\,([0-9]{1,3})\))", std::regex::icase);
+const std::regex COLOR_WITH_RGBA(R"(rgba\(([0-9]{1,3})\,([0-9]{1,3})\,([0-9]{1,3})\,(\d+\.?\d*)\))", std::regex::icase);
+
+// Colors used by the attributes of a page, the same few strings are parsed again and again.
+const std::vector<std::string> PAGE_COLORS = {
+    "#FF007DFF",
+    "#182431",
+    "#99182431",
+    "rgb(255, 255, 255)",
+    "rgba(0, 0, 0, 0.9)",
+    "red",
+    "#F1F3F5",
+    "rgba(24, 36, 49, 0.6)",
+};
+
+// Copy of the regex based parser replaced by the single pass parser, as the baseline.
+uint32_t ParseColorWithRegex(std::string colorStr)
+{
+    colorStr.erase(std::remove(colorStr.begin(), colorStr.end(), ' '), colorStr.end());
+    std::smatch matches;
+    if (std::regex_match(colorStr, matches, COLOR_WITH_MAGIC)) {
+        auto value = std::stoul(colorStr.substr(1), nullptr, COLOR_STRING_BASE);
+        return colorStr.length() - 1 < COLOR_STRING_SIZE_STANDARD ? (value | MASK_ALPHA) : value;
+    }
+    if (std::regex_match(colorStr, matches, COLOR_WITH_MAGIC_MINI)) {
+        std::string newColorStr;
+        for (auto iter = colorStr.begin() + 1; iter != colorStr.end(); ++iter) {
+            newColorStr += *iter;
+            newColorStr += *iter;
+        }
+        auto value = std::stoul(newColorStr, nullptr, COLOR_STRING_BASE);
+        return newColorStr.length() < COLOR_STRING_SIZE_STANDARD ? (value | MASK_ALPHA) : value;
+    }
+    if (std::regex_match(colorStr, matches, COLOR_WITH_RGB)) {
+        return Color::FromRGB(static_cast<uint8_t>(std::stoi(matches[1])), static_cast<uint8_t>(std::stoi(matches[2])),
+            static_cast<uint8_t>(std::stoi(matches[3])))
+            .GetValue();
+    }
+    if (std::regex_match(colorStr, matches, COLOR_WITH_RGBA)) {
+        return Color::FromRGBO(static_cast<uint8_t>(std::stoi(matches[1])),
+            static_cast<uint8_t>(std::stoi(matches[2])), static_cast<uint8_t>(std::stoi(matches[3])),
+            std::stod(matches[4]))
+            .GetValue();
+    }
+    return colorStr == "red" ? Color::RED.GetValue() : Color::BLACK.GetValue();
+}
+
+uint32_t ParseColor(const std::string& color, bool useRegex)
+{
+    return useRegex ? ParseColorWithRegex(color) : Color::FromString(color).GetValue();
+}
+
+// Colors of a page, mostly served by the cache of parsed colors. Arg 0 uses the regex baseline.
+void ParsePageColors(benchmark::State& state)
+{
+    bool useRegex = state.range(0) == 0;
+    for (auto _ : state) {
+        uint32_t sum = 0;
+        for (const auto& color : PAGE_COLORS) {
+            sum += ParseColor(color, useRegex);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(PAGE_COLORS.size()));
+}
+BENCHMARK(ParsePageColors)->ArgName("parser")->Arg(0)->Arg(1);
+
+// Colors which are all different, such as generated by an animation, every parse misses the cache.
+void ParseUniqueColors(benchmark::State& state)
+{
+    bool useRegex = state.range(0) == 0;
+    std::vector<std::string> colors;
+    colors.reserve(UNIQUE_COLOR_COUNT);
+    for (int32_t index = 0; index < UNIQUE_COLOR_COUNT; ++index) {
+        colors.emplace_back("rgba(" + std::to_string(index % 256) + ", " + std::to_string(index / 256) + ", 128, 0." +
+                            std::to_string(index % 10) + ")");
+    }
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ParseColor(colors[index], useRegex));
+        index = (index + 1) % colors.size();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(ParseUniqueColors)->ArgName("parser")->Arg(0)->Arg(1);
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test/benchmark/common/allocation_scope.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace OHOS::Ace {
+namespace {
+
+std::atomic<int32_t> g_activeScopeCount { 0 };
+std::atomic<uint64_t> g_allocationCount { 0 };
+std::atomic<uint64_t> g_allocationBytes { 0 };
+
+} // namespace
+
+AllocationScope::AllocationScope()
+{
+    g_activeScopeCount.fetch_add(1, std::memory_order_acq_rel);
+    startCount_ = g_allocationCount.load(std::memory_order_relaxed);
+    startBytes_ = g_allocationBytes.load(std::memory_order_relaxed);
+}
+
+AllocationScope::~AllocationScope()
+{
+    g_activeScopeCount.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+uint64_t AllocationScope::GetAllocationCount() const
+{
+    return g_allocationCount.load(std::memory_order_relaxed) - startCount_;
+}
+
+uint64_t AllocationScope::GetAllocationBytes() const
+{
+    return g_allocationBytes.load(std::memory_order_relaxed) - startBytes_;
+}
+
+} // namespace OHOS::Ace
+
+void* operator new(size_t size)
+{
+    if (OHOS::Ace::g_activeScopeCount.load(std::memory_order_relaxed) > 0) {
+        OHOS::Ace::g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        OHOS::Ace::g_allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    }
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t /* size */) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t /* size */) noexcept
+{
+    std::free(ptr);
+}
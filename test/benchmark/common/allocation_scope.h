@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_TEST_BENCHMARK_COMMON_ALLOCATION_SCOPE_H
+#define FOUNDATION_ACE_TEST_BENCHMARK_COMMON_ALLOCATION_SCOPE_H
+
+#include <cstdint>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// Counts the allocations made through operator new while the scope is alive. The allocations of all threads are
+// counted, as the pipeline may run tasks on background threads. Out of any scope operator new goes to malloc directly.
+// The benchmark links allocation_scope.cpp to replace the global operator new and delete.
+class AllocationScope final {
+public:
+    AllocationScope();
+    ~AllocationScope();
+
+    uint64_t GetAllocationCount() const;
+    uint64_t GetAllocationBytes() const;
+
+private:
+    uint64_t startCount_ = 0;
+    uint64_t startBytes_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(AllocationScope);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_TEST_BENCHMARK_COMMON_ALLOCATION_SCOPE_H
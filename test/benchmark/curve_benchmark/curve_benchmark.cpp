@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/animation/curves.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// times of a 1 second animation on a 120Hz display, and 8 times more for the accuracy check.
+constexpr int32_t FRAME_COUNT = 120;
+constexpr int32_t ACCURACY_SAMPLE_COUNT = FRAME_COUNT * 8;
+constexpr int32_t BISECTION_ITERATIONS = 60;
+// count of curves in Curves, the benchmarks are registered before the curves are initialized.
+constexpr int64_t BUILTIN_CURVE_COUNT = 18;
+
+struct ControlPoints {
+    double x0 = 0.0;
+    double y0 = 0.0;
+    double x1 = 0.0;
+    double y1 = 0.0;
+};
+
+struct BuiltinCurve {
+    const char* name;
+    RefPtr<Curve> curve;
+    // set for cubic-bezier curves, whose accuracy is checked against a reference solution.
+    std::optional<ControlPoints> points;
+};
+
+const std::vector<BuiltinCurve>& GetBuiltinCurves()
+{
+    static const std::vector<BuiltinCurve> curves = {
+        { "DECELE", Curves::DECELE, std::nullopt },
+        { "LINEAR", Curves::LINEAR, std::nullopt },
+        { "SINE", Curves::SINE, std::nullopt },
+        { "EASE", Curves::EASE, ControlPoints { 0.25, 0.1, 0.25, 1.0 } },
+        { "EASE_IN", Curves::EASE_IN, ControlPoints { 0.42, 0.0, 1.0, 1.0 } },
+        { "EASE_OUT", Curves::EASE_OUT, ControlPoints { 0.0, 0.0, 0.58, 1.0 } },
+        { "EASE_IN_OUT", Curves::EASE_IN_OUT, ControlPoints { 0.42, 0.0, 0.58, 1.0 } },
+        { "FAST_OUT_SLOW_IN", Curves::FAST_OUT_SLOW_IN, ControlPoints { 0.4, 0.0, 0.2, 1.0 } },
+        { "LINEAR_OUT_SLOW_IN", Curves::LINEAR_OUT_SLOW_IN, ControlPoints { 0.0, 0.0, 0.2, 1.0 } },
+        { "FAST_OUT_LINEAR_IN", Curves::FAST_OUT_LINEAR_IN, ControlPoints { 0.4, 0.0, 1.0, 1.0 } },
+        { "FRICTION", Curves::FRICTION, ControlPoints { 0.2, 0.0, 0.2, 1.0 } },
+        { "EXTREME_DECELERATION", Curves::EXTREME_DECELERATION, ControlPoints { 0.0, 0.0, 0.0, 1.0 } },
+        { "SHARP", Curves::SHARP, ControlPoints { 0.33, 0.0, 0.67, 1.0 } },
+        { "RHYTHM", Curves::RHYTHM, ControlPoints { 0.7, 0.0, 0.2, 1.0 } },
+        { "SMOOTH", Curves::SMOOTH, ControlPoints { 0.4, 0.0, 0.4, 1.0 } },
+        { "ANTICIPATE", Curves::ANTICIPATE, std::nullopt },
+        { "MAGNETIC", Curves::MAGNETIC, ControlPoints { 0.8, 0.0, 1.0, 0.6 } },
+        { "ELASTICS", Curves::ELASTICS, std::nullopt },
+    };
+    return curves;
+}
+
+double Bezier(double m, double p1, double p2)
+{
+    double inverse = 1.0 - m;
+    return 3.0 * m * inverse * inverse * p1 + 3.0 * m * m * inverse * p2 + m * m * m;
+}
+
+// Solve Bx(m) = time by bisection in double, Bx is monotonic as x of the control points are in [0, 1].
+double ReferenceMove(const ControlPoints& points, double time)
+{
+    double start = 0.0;
+    double end = 1.0;
+    for (int32_t iteration = 0; iteration < BISECTION_ITERATIONS; ++iteration) {
+        double middle = (start + end) / 2.0;
+        if (Bezier(middle, points.x0, points.x1) < time) {
+            start = middle;
+        } else {
+            end = middle;
+        }
+    }
+    return Bezier((start + end) / 2.0, points.y0, points.y1);
+}
+
+double GetMaxError(const RefPtr<Curve>& curve, const ControlPoints& points)
+{
+    double maxError = 0.0;
+    for (int32_t index = 0; index <= ACCURACY_SAMPLE_COUNT; ++index) {
+        auto time = static_cast<float>(index) / ACCURACY_SAMPLE_COUNT;
+        maxError = std::max(maxError, std::abs(curve->Move(time) - ReferenceMove(points, time)));
+    }
+    return maxError;
+}
+
+// Copy of the cubic-bezier evaluation replaced by the sample table, bisection in float until x is within the bound.
+class BisectionCubicCurve final {
+public:
+    explicit BisectionCubicCurve(const ControlPoints& points)
+        : x0_(static_cast<float>(points.x0)), y0_(static_cast<float>(points.y0)), x1_(static_cast<float>(points.x1)),
+          y1_(static_cast<float>(points.y1))
+    {}
+
+    float Move(float time) const
+    {
+        float start = 0.0f;
+        float end = 1.0f;
+        while (true) {
+            float midpoint = (start + end) / 2;
+            float estimate = CalculateCubic(x0_, x1_, midpoint);
+            if (std::abs(time - estimate) <= CUBIC_ERROR_BOUND) {
+                return CalculateCubic(y0_, y1_, midpoint);
+            }
+            if (estimate < time) {
+                start = midpoint;
+            } else {
+                end = midpoint;
+            }
+        }
+    }
+
+private:
+    static constexpr float CUBIC_ERROR_BOUND = 0.001f;
+
+    static float CalculateCubic(float a, float b, float m)
+    {
+        return 3.0f * a * (1.0f - m) * (1.0f - m) * m + 3.0f * b * (1.0f - m) * m * m + m * m * m;
+    }
+
+    float x0_;
+    float y0_;
+    float x1_;
+    float y1_;
+};
+
+std::vector<float> CreateFrameTimes()
+{
+    std::vector<float> times(FRAME_COUNT + 1);
+    for (int32_t index = 0; index <= FRAME_COUNT; ++index) {
+        times[index] = static_cast<float>(index) / FRAME_COUNT;
+    }
+    return times;
+}
+
+void CurveArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (int64_t index = 0; index < BUILTIN_CURVE_COUNT; ++index) {
+        benchmark->Arg(index);
+    }
+}
+
+// Values of all frames of an animation, one by one as the animator does.
+void MoveCurve(benchmark::State& state)
+{
+    const auto& builtinCurve = GetBuiltinCurves()[state.range(0)];
+    auto times = CreateFrameTimes();
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (auto time : times) {
+            sum += builtinCurve.curve->Move(time);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(times.size()));
+    state.SetLabel(builtinCurve.name);
+    if (builtinCurve.points) {
+        state.counters["max_error"] = GetMaxError(builtinCurve.curve, builtinCurve.points.value());
+    }
+}
+BENCHMARK(MoveCurve)->Apply(CurveArguments);
+
+// Values of all frames of the cubic-bezier curves with the bisection baseline, the other curves are skipped.
+void MoveCurveBisection(benchmark::State& state)
+{
+    const auto& builtinCurve = GetBuiltinCurves()[state.range(0)];
+    state.SetLabel(builtinCurve.name);
+    if (!builtinCurve.points) {
+        state.SkipWithError("not a cubic-bezier curve");
+        return;
+    }
+    const auto& points = builtinCurve.points.value();
+    BisectionCubicCurve curve(points);
+    auto times = CreateFrameTimes();
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (auto time : times) {
+            sum += curve.Move(time);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(times.size()));
+    double maxError = 0.0;
+    for (int32_t index = 0; index <= ACCURACY_SAMPLE_COUNT; ++index) {
+        auto time = static_cast<float>(index) / ACCURACY_SAMPLE_COUNT;
+        maxError = std::max(maxError, std::abs(curve.Move(time) - ReferenceMove(points, time)));
+    }
+    state.counters["max_error"] = maxError;
+}
+BENCHMARK(MoveCurveBisection)->Apply(CurveArguments);
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
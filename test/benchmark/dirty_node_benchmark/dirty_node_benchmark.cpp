@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+#include "core/pipeline_ng/dirty_node_queue.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+// depth of the nodes of a deep page, and times a node is marked in a frame by the updates of its properties.
+constexpr int32_t MAX_DEPTH = 32;
+constexpr int32_t MARK_TIMES = 2;
+constexpr uint32_t ROOT_ID = 0;
+constexpr uint32_t PAGE_ID = 1;
+
+class BenchmarkNode : public AceType {
+    DECLARE_ACE_TYPE(BenchmarkNode, AceType);
+
+public:
+    explicit BenchmarkNode(int32_t depth) : depth_(depth) {}
+    ~BenchmarkNode() override = default;
+
+    int32_t GetDepth() const
+    {
+        return depth_;
+    }
+
+    bool IsInDirtyQueue() const
+    {
+        return inDirtyQueue_;
+    }
+
+    void SetInDirtyQueue(bool inDirtyQueue)
+    {
+        inDirtyQueue_ = inDirtyQueue;
+    }
+
+private:
+    int32_t depth_ = 0;
+    bool inDirtyQueue_ = false;
+};
+
+std::vector<RefPtr<BenchmarkNode>> CreateNodes(int64_t count)
+{
+    std::vector<RefPtr<BenchmarkNode>> nodes;
+    nodes.reserve(static_cast<size_t>(count));
+    for (int64_t index = 0; index < count; ++index) {
+        nodes.emplace_back(AceType::MakeRefPtr<BenchmarkNode>(static_cast<int32_t>(index % MAX_DEPTH)));
+    }
+    return nodes;
+}
+
+// The dirty node sets used by UITaskScheduler before DirtyNodeQueue, sorted by depth and keyed by root and page id.
+class DirtyNodeSet final {
+public:
+    void Push(const RefPtr<BenchmarkNode>& node)
+    {
+        dirtyNodes_[ROOT_ID][PAGE_ID].emplace(node);
+    }
+
+    template<typename Callback>
+    void Flush(Callback&& callback)
+    {
+        auto dirtyNodes = std::move(dirtyNodes_);
+        for (auto&& [rootId, pageNodes] : dirtyNodes) {
+            for (auto&& [pageId, nodes] : pageNodes) {
+                for (const auto& node : nodes) {
+                    callback(node);
+                }
+            }
+        }
+    }
+
+private:
+    struct NodeCompare {
+        bool operator()(const RefPtr<BenchmarkNode>& nodeLeft, const RefPtr<BenchmarkNode>& nodeRight) const
+        {
+            if (nodeLeft->GetDepth() < nodeRight->GetDepth()) {
+                return true;
+            }
+            if (nodeLeft->GetDepth() == nodeRight->GetDepth()) {
+                return nodeLeft < nodeRight;
+            }
+            return false;
+        }
+    };
+
+    using PageDirtySet = std::set<RefPtr<BenchmarkNode>, NodeCompare>;
+    using RootDirtyMap = std::unordered_map<uint32_t, PageDirtySet>;
+    std::unordered_map<uint32_t, RootDirtyMap> dirtyNodes_;
+};
+
+// Mark the nodes dirty and flush them once per iteration, as a frame which updates arg 0 nodes.
+void FlushDirtyNodeSet(benchmark::State& state)
+{
+    auto nodes = CreateNodes(state.range(0));
+    DirtyNodeSet dirtyNodes;
+    int64_t checksum = 0;
+    for (auto _ : state) {
+        for (int32_t time = 0; time < MARK_TIMES; ++time) {
+            for (const auto& node : nodes) {
+                dirtyNodes.Push(node);
+            }
+        }
+        dirtyNodes.Flush([&checksum](const RefPtr<BenchmarkNode>& node) { checksum += node->GetDepth(); });
+    }
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(FlushDirtyNodeSet)->ArgName("nodes")->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000);
+
+void FlushDirtyNodeQueue(benchmark::State& state)
+{
+    auto nodes = CreateNodes(state.range(0));
+    DirtyNodeQueue<BenchmarkNode> dirtyNodes;
+    DirtyNodeQueue<BenchmarkNode> flushingNodes;
+    int64_t checksum = 0;
+    for (auto _ : state) {
+        for (int32_t time = 0; time < MARK_TIMES; ++time) {
+            for (const auto& node : nodes) {
+                if (node->IsInDirtyQueue()) {
+                    continue;
+                }
+                node->SetInDirtyQueue(true);
+                dirtyNodes.Push(node);
+            }
+        }
+        flushingNodes.Swap(dirtyNodes);
+        flushingNodes.ForEach([&checksum](const RefPtr<BenchmarkNode>& node) {
+            node->SetInDirtyQueue(false);
+            checksum += node->GetDepth();
+        });
+        flushingNodes.Clear();
+    }
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(FlushDirtyNodeQueue)->ArgName("nodes")->Arg(1000)->Arg(5000)->Arg(10000)->Arg(50000);
+
+} // namespace
+} // namespace OHOS::Ace::NG
+
+BENCHMARK_MAIN();
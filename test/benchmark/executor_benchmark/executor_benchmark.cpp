@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "base/thread/background_task_executor.h"
+
+namespace OHOS::Ace {
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// size of a task, about a microsecond, such as decoding a small piece of an image or measuring a text.
+constexpr int32_t TASK_WORK_UNITS = 256;
+// tasks posted at a time, such as the items of a list which are prefetched in a frame.
+constexpr int32_t BURST_SIZE = 64;
+// tasks posted from background threads, such as the nested steps of image loading.
+constexpr int32_t FAN_OUT_DEPTH = 6;
+constexpr int32_t FAN_OUT_WIDTH = 4;
+constexpr double PERCENTILE_50 = 0.5;
+constexpr double PERCENTILE_99 = 0.99;
+constexpr double PERCENTILE_999 = 0.999;
+
+// The executor used before the work-stealing queues: 3 threads share one mutex, one condition variable and two
+// std::list queues.
+class LegacyTaskExecutor final {
+public:
+    using Task = std::function<void()>;
+
+    LegacyTaskExecutor()
+    {
+        for (size_t index = 0; index < THREAD_NUM; ++index) {
+            threads_.emplace_back([this]() { ThreadLoop(); });
+        }
+    }
+
+    ~LegacyTaskExecutor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_ = false;
+            condition_.notify_all();
+        }
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    bool PostTask(Task&& task, BgTaskPriority priority = BgTaskPriority::DEFAULT)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return false;
+        }
+        if (priority == BgTaskPriority::LOW) {
+            lowPriorityTasks_.emplace_back(std::move(task));
+        } else {
+            tasks_.emplace_back(std::move(task));
+        }
+        condition_.notify_one();
+        return true;
+    }
+
+private:
+    static constexpr size_t THREAD_NUM = 3;
+
+    void ThreadLoop()
+    {
+        Task task;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (running_) {
+            if (tasks_.empty() && lowPriorityTasks_.empty()) {
+                condition_.wait(lock);
+                continue;
+            }
+            if (!tasks_.empty()) {
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            } else {
+                task = std::move(lowPriorityTasks_.front());
+                lowPriorityTasks_.pop_front();
+            }
+            lock.unlock();
+            task();
+            task = nullptr;
+            lock.lock();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    std::list<Task> tasks_;
+    std::list<Task> lowPriorityTasks_;
+    std::vector<std::thread> threads_;
+    bool running_ = true;
+};
+
+LegacyTaskExecutor& GetLegacyExecutor()
+{
+    static LegacyTaskExecutor executor;
+    return executor;
+}
+
+// Wait until the count of finished tasks reaches the count of posted tasks.
+class TaskLatch final {
+public:
+    void Add(int64_t count)
+    {
+        pending_.fetch_add(count, std::memory_order_relaxed);
+    }
+
+    void Done()
+    {
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            condition_.notify_all();
+        }
+    }
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return pending_.load(std::memory_order_acquire) == 0; });
+    }
+
+private:
+    std::atomic<int64_t> pending_ { 0 };
+    std::mutex mutex_;
+    std::condition_variable condition_;
+};
+
+void DoWork()
+{
+    uint32_t value = 0;
+    for (int32_t unit = 0; unit < TASK_WORK_UNITS; ++unit) {
+        value = value * 31 + static_cast<uint32_t>(unit);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+double GetPercentile(std::vector<double>& samples, double percentile)
+{
+    if (samples.empty()) {
+        return 0.0;
+    }
+    auto index = static_cast<size_t>(percentile * static_cast<double>(samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(index), samples.end());
+    return samples[index];
+}
+
+// Post bursts of independent tasks from the benchmark thread, which acts as the UI thread.
+template<typename Executor>
+void PostBurst(benchmark::State& state, Executor& executor)
+{
+    TaskLatch latch;
+    for (auto _ : state) {
+        latch.Add(BURST_SIZE);
+        for (int32_t index = 0; index < BURST_SIZE; ++index) {
+            executor.PostTask([&latch]() {
+                DoWork();
+                latch.Done();
+            });
+        }
+        latch.Wait();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * BURST_SIZE);
+}
+
+void PostBurstLegacy(benchmark::State& state)
+{
+    PostBurst(state, GetLegacyExecutor());
+}
+BENCHMARK(PostBurstLegacy)->UseRealTime();
+
+void PostBurstWorkStealing(benchmark::State& state)
+{
+    PostBurst(state, BackgroundTaskExecutor::GetInstance());
+}
+BENCHMARK(PostBurstWorkStealing)->UseRealTime();
+
+template<typename Executor>
+void PostFanOutTask(Executor& executor, TaskLatch& latch, int32_t depth)
+{
+    executor.PostTask([&executor, &latch, depth]() {
+        DoWork();
+        if (depth > 0) {
+            latch.Add(FAN_OUT_WIDTH);
+            for (int32_t index = 0; index < FAN_OUT_WIDTH; ++index) {
+                PostFanOutTask(executor, latch, depth - 1);
+            }
+        }
+        latch.Done();
+    });
+}
+
+// Every task posts more tasks from the background threads, such as loading and decoding image pieces.
+template<typename Executor>
+void FanOut(benchmark::State& state, Executor& executor)
+{
+    TaskLatch latch;
+    int64_t taskCount = 0;
+    int64_t levelCount = 1;
+    for (int32_t depth = 0; depth <= FAN_OUT_DEPTH; ++depth) {
+        taskCount += levelCount;
+        levelCount *= FAN_OUT_WIDTH;
+    }
+    for (auto _ : state) {
+        latch.Add(1);
+        PostFanOutTask(executor, latch, FAN_OUT_DEPTH);
+        latch.Wait();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * taskCount);
+}
+
+void FanOutLegacy(benchmark::State& state)
+{
+    FanOut(state, GetLegacyExecutor());
+}
+BENCHMARK(FanOutLegacy)->UseRealTime();
+
+void FanOutWorkStealing(benchmark::State& state)
+{
+    FanOut(state, BackgroundTaskExecutor::GetInstance());
+}
+BENCHMARK(FanOutWorkStealing)->UseRealTime();
+
+// Latency from posting a task to starting it, while the executor is busy with a burst of tasks.
+template<typename Executor>
+void TaskLatency(benchmark::State& state, Executor& executor)
+{
+    TaskLatch latch;
+    std::vector<double> latencies(BURST_SIZE);
+    std::vector<double> samples;
+    for (auto _ : state) {
+        latch.Add(BURST_SIZE);
+        for (int32_t index = 0; index < BURST_SIZE; ++index) {
+            executor.PostTask([&latch, &latencies, index, postTime = Clock::now()]() {
+                latencies[index] = std::chrono::duration<double, std::micro>(Clock::now() - postTime).count();
+                DoWork();
+                latch.Done();
+            });
+        }
+        latch.Wait();
+        samples.insert(samples.end(), latencies.begin(), latencies.end());
+    }
+    state.counters["p50_us"] = GetPercentile(samples, PERCENTILE_50);
+    state.counters["p99_us"] = GetPercentile(samples, PERCENTILE_99);
+    state.counters["p999_us"] = GetPercentile(samples, PERCENTILE_999);
+}
+
+void TaskLatencyLegacy(benchmark::State& state)
+{
+    TaskLatency(state, GetLegacyExecutor());
+}
+BENCHMARK(TaskLatencyLegacy)->UseRealTime();
+
+void TaskLatencyWorkStealing(benchmark::State& state)
+{
+    TaskLatency(state, BackgroundTaskExecutor::GetInstance());
+}
+BENCHMARK(TaskLatencyWorkStealing)->UseRealTime();
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/image/sharded_clock_cache.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr size_t CACHE_SIZE_LIMIT = 64 * 1024 * 1024;
+constexpr size_t IMAGE_SIZE = 256 * 1024;
+constexpr int32_t IMAGE_COUNT = 1024;
+// a few images such as icons are shown again and again, the others are seen once while a list is scrolled.
+constexpr double HOT_IMAGE_RATIO = 0.1;
+constexpr double HOT_ACCESS_RATIO = 0.8;
+constexpr uint32_t RANDOM_SEED = 20221017;
+constexpr int32_t MAX_THREADS = 8;
+// a gallery page shows large thumbnails and a lot of small icons.
+constexpr int32_t THUMBNAIL_COUNT = 100;
+constexpr size_t THUMBNAIL_SIZE = 1024 * 1024;
+constexpr int32_t ICON_COUNT = 1000;
+constexpr size_t ICON_SIZE = 16 * 1024;
+constexpr size_t GALLERY_SIZE_LIMIT = 32 * 1024 * 1024;
+constexpr int32_t GALLERY_VISIBLE_ROWS = 8;
+
+using ImageData = std::shared_ptr<std::vector<uint8_t>>;
+
+// Copy of the image cache before it was limited by bytes: a LRU list limited by count, the list and the map are
+// guarded by separate mutexes which are both taken by every call. Sizes are only summed for the report.
+class CountLimitedLruCache final {
+public:
+    void SetCountLimit(size_t countLimit)
+    {
+        countLimit_ = countLimit;
+    }
+
+    void Clear()
+    {
+        std::scoped_lock lock(mapMutex_, listMutex_);
+        list_.clear();
+        map_.clear();
+        size_ = 0;
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+    bool Put(const std::string& key, const ImageData& value, size_t size)
+    {
+        std::scoped_lock lock(mapMutex_, listMutex_);
+        auto iter = map_.find(key);
+        if (iter != map_.end()) {
+            size_ -= iter->second->size;
+            list_.erase(iter->second);
+        }
+        list_.push_front({ key, value, size });
+        map_[key] = list_.begin();
+        size_ += size;
+        if (list_.size() > countLimit_) {
+            size_ -= list_.back().size;
+            map_.erase(list_.back().key);
+            list_.pop_back();
+        }
+        return true;
+    }
+
+    ImageData Get(const std::string& key)
+    {
+        std::scoped_lock lock(mapMutex_, listMutex_);
+        auto iter = map_.find(key);
+        if (iter == map_.end()) {
+            ++misses_;
+            return nullptr;
+        }
+        ++hits_;
+        list_.splice(list_.begin(), list_, iter->second);
+        return iter->second->value;
+    }
+
+    ImageCacheStats GetStats() const
+    {
+        std::scoped_lock lock(mapMutex_, listMutex_);
+        ImageCacheStats stats;
+        stats.hits = hits_;
+        stats.misses = misses_;
+        stats.count = list_.size();
+        stats.size = size_;
+        return stats;
+    }
+
+private:
+    struct Node {
+        std::string key;
+        ImageData value;
+        size_t size;
+    };
+
+    mutable std::mutex mapMutex_;
+    mutable std::mutex listMutex_;
+    std::list<Node> list_;
+    std::unordered_map<std::string, std::list<Node>::iterator> map_;
+    size_t countLimit_ = 0;
+    size_t size_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+std::vector<std::string> CreateImageKeys(const std::string& prefix, int32_t count)
+{
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (int32_t index = 0; index < count; ++index) {
+        keys.emplace_back("resource:///media/" + prefix + "_" + std::to_string(index) + ".png");
+    }
+    return keys;
+}
+
+template<typename Cache>
+Cache& GetCache()
+{
+    static Cache cache;
+    return cache;
+}
+
+// The legacy cache is only limited by count, which is the size limit divided by the size of the common images.
+void ResetCache(ShardedClockCache<ImageData>& cache, size_t sizeLimit, size_t countLimit)
+{
+    cache.Clear();
+    cache.SetSizeLimit(sizeLimit);
+    cache.SetCountLimit(countLimit);
+}
+
+void ResetCache(CountLimitedLruCache& cache, size_t /* sizeLimit */, size_t countLimit)
+{
+    cache.Clear();
+    cache.SetCountLimit(countLimit);
+}
+
+template<typename Cache>
+void ReportStats(benchmark::State& state, Cache& cache)
+{
+    auto stats = cache.GetStats();
+    auto total = stats.hits + stats.misses;
+    state.counters["hit_ratio"] = total == 0 ? 0.0 : static_cast<double>(stats.hits) / static_cast<double>(total);
+    state.counters["cache_bytes"] = static_cast<double>(stats.size);
+}
+
+// Load images from the threads of image loading, an image which misses the cache is decoded and put into it.
+template<typename Cache>
+void LoadImages(benchmark::State& state)
+{
+    auto& cache = GetCache<Cache>();
+    if (state.thread_index() == 0) {
+        ResetCache(cache, CACHE_SIZE_LIMIT, CACHE_SIZE_LIMIT / IMAGE_SIZE);
+    }
+    auto keys = CreateImageKeys("image", IMAGE_COUNT);
+    auto hotCount = static_cast<int32_t>(IMAGE_COUNT * HOT_IMAGE_RATIO);
+    std::mt19937 random(RANDOM_SEED + static_cast<uint32_t>(state.thread_index()));
+    std::bernoulli_distribution hotAccess(HOT_ACCESS_RATIO);
+    std::uniform_int_distribution<int32_t> hotImage(0, hotCount - 1);
+    std::uniform_int_distribution<int32_t> coldImage(hotCount, IMAGE_COUNT - 1);
+    auto decoded = std::make_shared<std::vector<uint8_t>>();
+
+    for (auto _ : state) {
+        const auto& key = keys[hotAccess(random) ? hotImage(random) : coldImage(random)];
+        auto data = cache.Get(key);
+        if (!data) {
+            cache.Put(key, decoded, IMAGE_SIZE);
+        }
+        benchmark::DoNotOptimize(data);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    if (state.thread_index() == 0) {
+        ReportStats(state, cache);
+    }
+}
+BENCHMARK_TEMPLATE(LoadImages, CountLimitedLruCache)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+BENCHMARK_TEMPLATE(LoadImages, ShardedClockCache<ImageData>)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+template<typename Cache>
+void LoadGalleryImage(Cache& cache, const std::string& key, const ImageData& decoded, size_t size)
+{
+    if (!cache.Get(key)) {
+        cache.Put(key, decoded, size);
+    }
+}
+
+// Scroll a gallery of large thumbnails and small icons from top to bottom again and again, every step shows a window
+// of GALLERY_VISIBLE_ROWS rows. A cache limited by count keeps as many thumbnails as icons, so it holds much more than
+// the budget, cache_bytes reports the bytes held at the end.
+template<typename Cache>
+void ScrollGallery(benchmark::State& state)
+{
+    Cache cache;
+    ResetCache(cache, GALLERY_SIZE_LIMIT, GALLERY_SIZE_LIMIT / ICON_SIZE);
+    auto thumbnails = CreateImageKeys("thumbnail", THUMBNAIL_COUNT);
+    auto icons = CreateImageKeys("icon", ICON_COUNT);
+    auto decoded = std::make_shared<std::vector<uint8_t>>();
+    constexpr int32_t iconsPerRow = ICON_COUNT / THUMBNAIL_COUNT;
+    for (auto _ : state) {
+        for (int32_t top = 0; top + GALLERY_VISIBLE_ROWS <= THUMBNAIL_COUNT; ++top) {
+            for (int32_t row = top; row < top + GALLERY_VISIBLE_ROWS; ++row) {
+                LoadGalleryImage(cache, thumbnails[row], decoded, THUMBNAIL_SIZE);
+                for (int32_t column = 0; column < iconsPerRow; ++column) {
+                    LoadGalleryImage(cache, icons[row * iconsPerRow + column], decoded, ICON_SIZE);
+                }
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            (THUMBNAIL_COUNT - GALLERY_VISIBLE_ROWS + 1) * GALLERY_VISIBLE_ROWS * (iconsPerRow + 1));
+    ReportStats(state, cache);
+}
+BENCHMARK_TEMPLATE(ScrollGallery, CountLimitedLruCache);
+BENCHMARK_TEMPLATE(ScrollGallery, ShardedClockCache<ImageData>);
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkColorPriv.h"
+#include "third_party/skia/include/core/SkStream.h"
+#include "third_party/skia/include/encode/SkJpegEncoder.h"
+#include "third_party/skia/include/encode/SkPngEncoder.h"
+#include "third_party/skia/include/encode/SkWebpEncoder.h"
+
+#include "core/components_ng/image_provider/adapter/skia_image_decoder.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+// a 12MP camera photo shown as a thumbnail of a feed.
+constexpr int32_t PHOTO_WIDTH = 4000;
+constexpr int32_t PHOTO_HEIGHT = 3000;
+constexpr float THUMBNAIL_WIDTH = 200.0f;
+constexpr float THUMBNAIL_HEIGHT = 150.0f;
+constexpr int32_t PHOTO_QUALITY = 90;
+
+enum class PhotoFormat : int32_t {
+    JPEG = 0,
+    PNG,
+    WEBP,
+};
+
+// Smooth gradients with some noise, so the encoded sizes are close to the sizes of photos.
+SkBitmap CreatePhotoPixels()
+{
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(PHOTO_WIDTH, PHOTO_HEIGHT, true);
+    uint32_t noise = 1;
+    for (int32_t y = 0; y < PHOTO_HEIGHT; ++y) {
+        auto* row = bitmap.getAddr32(0, y);
+        for (int32_t x = 0; x < PHOTO_WIDTH; ++x) {
+            noise = noise * 1103515245u + 12345u;
+            auto grain = static_cast<int32_t>((noise >> 16) & 0x0f);
+            auto red = static_cast<U8CPU>((x * 255 / PHOTO_WIDTH + grain) & 0xff);
+            auto green = static_cast<U8CPU>((y * 255 / PHOTO_HEIGHT + grain) & 0xff);
+            auto blue = static_cast<U8CPU>(((x + y) * 127 / PHOTO_HEIGHT + grain) & 0xff);
+            row[x] = SkPackARGB32(0xff, red, green, blue);
+        }
+    }
+    return bitmap;
+}
+
+sk_sp<SkData> EncodePhoto(const SkBitmap& bitmap, PhotoFormat format)
+{
+    SkDynamicMemoryWStream stream;
+    bool success = false;
+    switch (format) {
+        case PhotoFormat::JPEG: {
+            SkJpegEncoder::Options options;
+            options.fQuality = PHOTO_QUALITY;
+            success = SkJpegEncoder::Encode(&stream, bitmap.pixmap(), options);
+            break;
+        }
+        case PhotoFormat::PNG:
+            success = SkPngEncoder::Encode(&stream, bitmap.pixmap(), SkPngEncoder::Options());
+            break;
+        case PhotoFormat::WEBP: {
+            SkWebpEncoder::Options options;
+            options.fQuality = PHOTO_QUALITY;
+            success = SkWebpEncoder::Encode(&stream, bitmap.pixmap(), options);
+            break;
+        }
+    }
+    return success ? stream.detachAsData() : nullptr;
+}
+
+const std::vector<sk_sp<SkData>>& GetPhotoCorpus()
+{
+    static std::vector<sk_sp<SkData>> corpus = [] {
+        auto bitmap = CreatePhotoPixels();
+        return std::vector<sk_sp<SkData>> { EncodePhoto(bitmap, PhotoFormat::JPEG),
+            EncodePhoto(bitmap, PhotoFormat::PNG), EncodePhoto(bitmap, PhotoFormat::WEBP) };
+    }();
+    return corpus;
+}
+
+// Decode a photo as a thumbnail. Arg 0 is the format, JPEG, PNG or WebP. Arg 1 is 0 to decode at full size and then
+// scale down, as before decoding at the target size, or 1 to decode at the codec scale nearest to the thumbnail size.
+void DecodeThumbnail(benchmark::State& state)
+{
+    const auto& data = GetPhotoCorpus()[state.range(0)];
+    if (!data) {
+        state.SkipWithError("encode photo failed");
+        return;
+    }
+    bool decodeToTarget = state.range(1) != 0;
+    SizeF thumbnailSize(THUMBNAIL_WIDTH, THUMBNAIL_HEIGHT);
+    int64_t decodedPixels = 0;
+    for (auto _ : state) {
+        auto rawImage = decodeToTarget ? SkiaImageDecoder::DecodeToTargetSize(data, thumbnailSize) : nullptr;
+        if (!rawImage) {
+            rawImage = SkImage::MakeFromEncoded(data);
+        }
+        if (!rawImage) {
+            state.SkipWithError("decode photo failed");
+            return;
+        }
+        decodedPixels = static_cast<int64_t>(rawImage->width()) * rawImage->height();
+        auto thumbnail = SkiaImageDecoder::ResizeImage(rawImage, "", thumbnailSize, false);
+        benchmark::DoNotOptimize(thumbnail);
+    }
+    state.counters["encoded_bytes"] = static_cast<double>(data->size());
+    state.counters["decoded_pixels"] = static_cast<double>(decodedPixels);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(DecodeThumbnail)
+    ->ArgNames({ "format", "to_target" })
+    ->ArgsProduct({ { 0, 1, 2 }, { 0, 1 } })
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
+} // namespace OHOS::Ace::NG
+
+BENCHMARK_MAIN();
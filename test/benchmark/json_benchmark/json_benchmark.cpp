@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <string>
+
+#include "benchmark/benchmark.h"
+
+#include "base/json/json_util.h"
+#include "base/json/json_view.h"
+#include "base/json/json_writer.h"
+#include "test/benchmark/common/allocation_scope.h"
+
+namespace OHOS::Ace {
+namespace {
+
+constexpr int64_t MIN_NODE_COUNT = 16;
+constexpr int64_t MAX_NODE_COUNT = 4096;
+constexpr int64_t NODE_COUNT_MULTIPLIER = 16;
+constexpr double NODE_WIDTH = 100.5;
+
+// Inspector like document: an array of nodes, each with several attributes.
+std::string CreateNodesJson(int64_t count)
+{
+    JsonWriter writer;
+    writer.StartObject();
+    writer.Put("type", "root");
+    writer.Key("nodes");
+    writer.StartArray();
+    for (int64_t index = 0; index < count; ++index) {
+        writer.StartObject();
+        writer.Put("id", index);
+        writer.Put("tag", "Text");
+        writer.Put("content", "line \"" + std::to_string(index) + "\" of text");
+        writer.Put("width", NODE_WIDTH);
+        writer.Put("visible", index % 2 == 0);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return writer.TakeString();
+}
+
+void ReportAllocations(benchmark::State& state, uint64_t allocationCount)
+{
+    auto nodeCount = static_cast<double>(state.iterations()) * static_cast<double>(state.range(0));
+    state.counters["allocs_per_node"] = static_cast<double>(allocationCount) / nodeCount;
+}
+
+// Parse the document and read the id and the content of every node, as the card parser reads attributes.
+void ParseJsonValue(benchmark::State& state)
+{
+    auto text = CreateNodesJson(state.range(0));
+    uint64_t allocationCount = 0;
+    for (auto _ : state) {
+        AllocationScope scope;
+        auto root = JsonUtil::ParseJsonString(text);
+        auto nodes = root->GetValue("nodes");
+        int64_t sum = 0;
+        for (int32_t index = 0; index < nodes->GetArraySize(); ++index) {
+            auto node = nodes->GetArrayItem(index);
+            sum += node->GetInt("id");
+            sum += static_cast<int64_t>(node->GetString("content").size());
+        }
+        benchmark::DoNotOptimize(sum);
+        nodes.reset();
+        root.reset();
+        allocationCount += scope.GetAllocationCount();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(text.size()));
+    ReportAllocations(state, allocationCount);
+}
+BENCHMARK(ParseJsonValue)->RangeMultiplier(NODE_COUNT_MULTIPLIER)->Range(MIN_NODE_COUNT, MAX_NODE_COUNT);
+
+void ParseJsonView(benchmark::State& state)
+{
+    auto text = CreateNodesJson(state.range(0));
+    uint64_t allocationCount = 0;
+    for (auto _ : state) {
+        AllocationScope scope;
+        auto document = JsonDocument::ParseView(text);
+        auto nodes = document->GetRoot()->GetValue("nodes");
+        int64_t sum = 0;
+        for (auto node = nodes->GetChild(); node; node = node->GetNext()) {
+            sum += node->GetInt("id");
+            sum += static_cast<int64_t>(node->GetValue("content")->GetStringView().size());
+        }
+        benchmark::DoNotOptimize(sum);
+        document.reset();
+        allocationCount += scope.GetAllocationCount();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(text.size()));
+    ReportAllocations(state, allocationCount);
+}
+BENCHMARK(ParseJsonView)->RangeMultiplier(NODE_COUNT_MULTIPLIER)->Range(MIN_NODE_COUNT, MAX_NODE_COUNT);
+
+void SerializeJsonValue(benchmark::State& state)
+{
+    size_t size = 0;
+    for (auto _ : state) {
+        auto root = JsonUtil::Create(true);
+        root->Put("type", "root");
+        auto nodes = JsonUtil::CreateArray(false);
+        for (int64_t index = 0; index < state.range(0); ++index) {
+            auto node = JsonUtil::Create(false);
+            node->Put("id", index);
+            node->Put("tag", "Text");
+            node->Put("content", ("line \"" + std::to_string(index) + "\" of text").c_str());
+            node->Put("width", NODE_WIDTH);
+            node->Put("visible", index % 2 == 0);
+            nodes->Put(node);
+        }
+        root->Put("nodes", nodes);
+        size = root->ToString().size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+}
+BENCHMARK(SerializeJsonValue)->RangeMultiplier(NODE_COUNT_MULTIPLIER)->Range(MIN_NODE_COUNT, MAX_NODE_COUNT);
+
+void SerializeJsonWriter(benchmark::State& state)
+{
+    size_t size = 0;
+    for (auto _ : state) {
+        size = CreateNodesJson(state.range(0)).size();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+}
+BENCHMARK(SerializeJsonWriter)->RangeMultiplier(NODE_COUNT_MULTIPLIER)->Range(MIN_NODE_COUNT, MAX_NODE_COUNT);
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
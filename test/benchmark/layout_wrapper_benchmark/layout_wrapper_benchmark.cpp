@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "base/memory/fixed_block_pool.h"
+#include "base/memory/ref_counter.h"
+#include "core/components_ng/base/geometry_node.h"
+#include "core/components_ng/layout/box_layout_algorithm.h"
+#include "core/components_ng/layout/layout_algorithm.h"
+#include "core/components_ng/layout/layout_property.h"
+#include "core/components_ng/layout/layout_wrapper.h"
+#include "test/benchmark/common/allocation_scope.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+// a complete tree of depth 5 with 8 children per node, 1 + 8 + 64 + 512 + 4096 nodes.
+constexpr int32_t CHILDREN_PER_NODE = 8;
+constexpr int32_t TREE_NODE_COUNT = 4681;
+
+// Geometry and layout property of the frame nodes, cloned into the wrappers of every frame.
+struct NodeProperties {
+    NodeProperties()
+    {
+        for (int32_t index = 0; index < TREE_NODE_COUNT; ++index) {
+            auto geometryNode = AceType::MakeRefPtr<GeometryNode>();
+            geometryNode->SetFrameSize(SizeF(100.0f, 40.0f));
+            geometryNode->SetContentSize(SizeF(96.0f, 36.0f));
+            geometryNodes.emplace_back(geometryNode);
+            layoutProperties.emplace_back(AceType::MakeRefPtr<LayoutProperty>());
+        }
+    }
+
+    std::vector<RefPtr<GeometryNode>> geometryNodes;
+    std::vector<RefPtr<LayoutProperty>> layoutProperties;
+};
+
+const NodeProperties& GetNodeProperties()
+{
+    static NodeProperties properties;
+    return properties;
+}
+
+// Create the layout wrappers of all nodes, as the layout task of a frame rebuilding the whole page does.
+RefPtr<LayoutWrapper> BuildWrapperTree(const NodeProperties& properties)
+{
+    std::vector<RefPtr<LayoutWrapper>> wrappers;
+    wrappers.reserve(TREE_NODE_COUNT);
+    for (int32_t index = 0; index < TREE_NODE_COUNT; ++index) {
+        auto wrapper = AceType::MakeRefPtr<LayoutWrapper>(nullptr, properties.geometryNodes[index]->Clone(),
+            properties.layoutProperties[index]->Clone());
+        auto layoutAlgorithm = AceType::MakeRefPtr<BoxLayoutAlgorithm>();
+        wrapper->SetLayoutAlgorithm(AceType::MakeRefPtr<LayoutAlgorithmWrapper>(layoutAlgorithm));
+        if (index > 0) {
+            wrappers[(index - 1) / CHILDREN_PER_NODE]->AppendChild(wrapper);
+        }
+        wrappers.emplace_back(std::move(wrapper));
+    }
+    return wrappers.front();
+}
+
+// Build and release the wrapper tree of a frame. Arg 1 trims the pools before every frame, as after a memory warning.
+void RebuildWrapperTree(benchmark::State& state)
+{
+    const auto& properties = GetNodeProperties();
+    bool trim = state.range(0) != 0;
+    uint64_t allocationCount = 0;
+    for (auto _ : state) {
+        if (trim) {
+            state.PauseTiming();
+            RefCounter::TrimPool();
+            SizeClassPool::Trim();
+            state.ResumeTiming();
+        }
+        AllocationScope scope;
+        auto root = BuildWrapperTree(properties);
+        benchmark::DoNotOptimize(root);
+        root.Reset();
+        allocationCount += scope.GetAllocationCount();
+    }
+    state.counters["mallocs_per_frame"] =
+        static_cast<double>(allocationCount) / static_cast<double>(state.iterations());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * TREE_NODE_COUNT);
+}
+BENCHMARK(RebuildWrapperTree)->ArgName("trim")->Arg(0)->Arg(1);
+
+} // namespace
+} // namespace OHOS::Ace::NG
+
+BENCHMARK_MAIN();
@@ -0,0 +1,548 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "base/thread/background_task_executor.h"
+#include "base/thread/task_executor.h"
+#include "base/utils/time_util.h"
+#include "core/animation/curves.h"
+#include "core/animation/schedule_task.h"
+#include "core/common/ace_engine.h"
+#include "core/common/container.h"
+#include "core/common/container_scope.h"
+#include "core/common/window.h"
+#include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/pattern/custom/custom_node.h"
+#include "core/components_ng/pattern/linear_layout/linear_layout_pattern.h"
+#include "core/components_ng/pattern/list/list_pattern.h"
+#include "core/components_ng/pattern/pattern.h"
+#include "core/components_ng/pattern/stage/page_pattern.h"
+#include "core/components_ng/syntax/lazy_for_each_builder.h"
+#include "core/components_ng/syntax/lazy_for_each_node.h"
+#include "core/components_v2/inspector/inspector_constants.h"
+#include "core/pipeline/base/element_register.h"
+#include "core/pipeline_ng/pipeline_context.h"
+#include "test/benchmark/common/allocation_scope.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+constexpr int32_t INSTANCE_ID = 0;
+constexpr int32_t ROOT_WIDTH = 720;
+constexpr int32_t ROOT_HEIGHT = 1280;
+constexpr uint64_t VSYNC_PERIOD = 16666667;
+// frames delivered at most to let a scenario settle, pages of the scenarios settle in a few frames.
+constexpr int32_t MAX_SETTLE_FRAMES = 16;
+constexpr int64_t IDLE_TIME = 8000000;
+
+constexpr int32_t PAGE_ROW_COUNT = 100;
+constexpr int32_t PAGE_COLUMN_COUNT = 100;
+constexpr float PAGE_ITEM_SIZE = 6.0f;
+
+constexpr int32_t LIST_ITEM_COUNT = 100000;
+constexpr float LIST_ITEM_HEIGHT = 100.0f;
+constexpr float SCROLL_DELTA = 40.0f;
+constexpr int32_t LIST_CACHED_COUNT = 2;
+
+constexpr int32_t ANIMATED_NODE_COUNT = 500;
+constexpr int32_t ANIMATION_FRAMES = 60;
+constexpr float ANIMATED_NODE_HEIGHT = 2.0f;
+constexpr float ANIMATED_MIN_WIDTH = 100.0f;
+constexpr float ANIMATED_MAX_WIDTH = 600.0f;
+
+// Runs tasks of ui and platform threads at once on the benchmark thread, so the pipeline is driven synchronously.
+class InlineTaskExecutor final : public TaskExecutor {
+public:
+    void AddTaskObserver(Task&& callback) override {}
+    void RemoveTaskObserver() override {}
+
+    bool WillRunOnCurrentThread(TaskType type) const override
+    {
+        return type == TaskType::UI || type == TaskType::PLATFORM || type == TaskType::JS;
+    }
+
+    Task WrapTaskWithTraceId(Task&& task, int32_t id) const override
+    {
+        return std::move(task);
+    }
+
+private:
+    bool OnPostTask(Task&& task, TaskType type, uint32_t delayTime) const override
+    {
+        if (type == TaskType::BACKGROUND) {
+            return BackgroundTaskExecutor::GetInstance().PostTask(std::move(task));
+        }
+        if (task) {
+            task();
+        }
+        return true;
+    }
+};
+
+// Window without platform, vsync is delivered by the benchmark when a frame is requested, with time stamps of a
+// steady 60Hz display.
+class FakeVsyncWindow final : public Window {
+public:
+    FakeVsyncWindow() = default;
+    ~FakeVsyncWindow() override = default;
+
+    void RequestFrame() override
+    {
+        isRequestVsync_ = true;
+    }
+
+    void Destroy() override {}
+
+    // Returns false if no frame is requested.
+    bool Vsync()
+    {
+        if (!isRequestVsync_) {
+            return false;
+        }
+        vsyncTime_ += VSYNC_PERIOD;
+        OnVsync(vsyncTime_, ++frameCount_);
+        return true;
+    }
+
+private:
+    uint64_t vsyncTime_ = 0;
+    uint32_t frameCount_ = 0;
+};
+
+class BenchmarkContainer final : public Container {
+    DECLARE_ACE_TYPE(BenchmarkContainer, Container);
+
+public:
+    explicit BenchmarkContainer(const RefPtr<TaskExecutor>& taskExecutor) : taskExecutor_(taskExecutor) {}
+    ~BenchmarkContainer() override = default;
+
+    void Initialize() override {}
+    void Destroy() override {}
+
+    int32_t GetInstanceId() const override
+    {
+        return INSTANCE_ID;
+    }
+
+    std::string GetHostClassName() const override
+    {
+        return "";
+    }
+
+    RefPtr<Frontend> GetFrontend() const override
+    {
+        return nullptr;
+    }
+
+    RefPtr<TaskExecutor> GetTaskExecutor() const override
+    {
+        return taskExecutor_;
+    }
+
+    RefPtr<AssetManager> GetAssetManager() const override
+    {
+        return nullptr;
+    }
+
+    RefPtr<PlatformResRegister> GetPlatformResRegister() const override
+    {
+        return nullptr;
+    }
+
+    RefPtr<PipelineBase> GetPipelineContext() const override
+    {
+        return pipelineContext_;
+    }
+
+    void SetPipelineContext(const RefPtr<PipelineBase>& pipelineContext)
+    {
+        pipelineContext_ = pipelineContext;
+    }
+
+    bool Dump(const std::vector<std::string>& params) override
+    {
+        return false;
+    }
+
+    int32_t GetViewWidth() const override
+    {
+        return ROOT_WIDTH;
+    }
+
+    int32_t GetViewHeight() const override
+    {
+        return ROOT_HEIGHT;
+    }
+
+    void* GetView() const override
+    {
+        return nullptr;
+    }
+
+private:
+    RefPtr<TaskExecutor> taskExecutor_;
+    RefPtr<PipelineBase> pipelineContext_;
+};
+
+// Headless pipeline of one window, every scenario pushes its page and drives frames through FlushVsync.
+class PipelineHarness final {
+public:
+    PipelineHarness() : scope_(INSTANCE_ID)
+    {
+        auto taskExecutor = AceType::MakeRefPtr<InlineTaskExecutor>();
+        container_ = AceType::MakeRefPtr<BenchmarkContainer>(taskExecutor);
+        AceEngine::Get().AddContainer(INSTANCE_ID, container_);
+        auto window = std::make_unique<FakeVsyncWindow>();
+        window_ = window.get();
+        context_ = AceType::MakeRefPtr<PipelineContext>(std::move(window), taskExecutor, nullptr, nullptr, INSTANCE_ID);
+        container_->SetPipelineContext(context_);
+        context_->SetupRootElement();
+        context_->OnSurfaceChanged(ROOT_WIDTH, ROOT_HEIGHT);
+        FlushFrames();
+    }
+
+    ~PipelineHarness()
+    {
+        PopPage();
+        container_->SetPipelineContext(nullptr);
+        AceEngine::Get().RemoveContainer(INSTANCE_ID);
+    }
+
+    const RefPtr<PipelineContext>& GetContext() const
+    {
+        return context_;
+    }
+
+    void PushPage(const RefPtr<UINode>& content)
+    {
+        auto pageNode = FrameNode::CreateFrameNode(V2::PAGE_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
+            AceType::MakeRefPtr<PagePattern>(AceType::MakeRefPtr<PageInfo>(++pageId_, "")));
+        content->MountToParent(pageNode);
+        context_->GetStageManager()->PushPage(pageNode);
+        hasPage_ = true;
+    }
+
+    void PopPage()
+    {
+        if (hasPage_) {
+            context_->GetStageManager()->PopPage();
+            hasPage_ = false;
+            FlushFrames();
+        }
+    }
+
+    // Deliver one vsync and the idle time after it, returns false if no frame is requested.
+    bool FlushFrame()
+    {
+        if (!window_->Vsync()) {
+            return false;
+        }
+        context_->OnIdle(GetSysTimestamp() + IDLE_TIME);
+        return true;
+    }
+
+    // Deliver frames until the pipeline is idle, returns the count of frames.
+    int32_t FlushFrames()
+    {
+        int32_t count = 0;
+        while (count < MAX_SETTLE_FRAMES && FlushFrame()) {
+            ++count;
+        }
+        return count;
+    }
+
+    void Rotate()
+    {
+        isLandscape_ = !isLandscape_;
+        if (isLandscape_) {
+            context_->OnSurfaceChanged(ROOT_HEIGHT, ROOT_WIDTH, WindowSizeChangeReason::ROTATION);
+        } else {
+            context_->OnSurfaceChanged(ROOT_WIDTH, ROOT_HEIGHT, WindowSizeChangeReason::ROTATION);
+        }
+    }
+
+private:
+    ContainerScope scope_;
+    RefPtr<BenchmarkContainer> container_;
+    RefPtr<PipelineContext> context_;
+    FakeVsyncWindow* window_ = nullptr;
+    int32_t pageId_ = 0;
+    bool hasPage_ = false;
+    bool isLandscape_ = false;
+};
+
+// Report per frame statistics of the pipeline and allocations of the measured frames.
+class FrameReporter final {
+public:
+    explicit FrameReporter(const RefPtr<PipelineContext>& context) : context_(context)
+    {
+        // all measured frames are reported, however long the benchmark runs.
+        context_->GetFrameStatistics().SetWindowPeriod(UINT64_MAX);
+        context_->GetFrameStatistics().Reset();
+    }
+
+    ~FrameReporter() = default;
+
+    void Report(benchmark::State& state) const
+    {
+        const auto& statistics = context_->GetFrameStatistics();
+        auto frames = statistics.GetPhaseHistogram(FramePhase::FRAME).GetCount();
+        auto perFrame = [frames](uint64_t value) {
+            return frames == 0 ? 0.0 : static_cast<double>(value) / static_cast<double>(frames);
+        };
+        state.counters["frames"] = benchmark::Counter(static_cast<double>(frames));
+        state.counters["allocs/frame"] = perFrame(allocationScope_.GetAllocationCount());
+        state.counters["alloc_bytes/frame"] = perFrame(allocationScope_.GetAllocationBytes());
+        const std::pair<const char*, FramePhase> phases[] = {
+            { "animation_us", FramePhase::ANIMATION },
+            { "build_us", FramePhase::BUILD },
+            { "touch_us", FramePhase::TOUCH },
+            { "layout_us", FramePhase::LAYOUT },
+            { "render_us", FramePhase::RENDER },
+            { "frame_us", FramePhase::FRAME },
+        };
+        constexpr double p99 = 99.0;
+        for (const auto& [name, phase] : phases) {
+            const auto& histogram = statistics.GetPhaseHistogram(phase);
+            state.counters[name] = static_cast<double>(histogram.GetMean());
+            state.counters[std::string(name) + "_p99"] = static_cast<double>(histogram.GetPercentile(p99));
+        }
+        state.counters["layout_dirty"] =
+            static_cast<double>(statistics.GetDirtyNodeHistogram(FramePhase::LAYOUT).GetMean());
+    }
+
+private:
+    RefPtr<PipelineContext> context_;
+    // allocations of all threads, the pipeline may run layout and render tasks in background threads.
+    AllocationScope allocationScope_;
+};
+
+RefPtr<FrameNode> CreateLinearNode(bool isVertical)
+{
+    return FrameNode::CreateFrameNode(isVertical ? V2::COLUMN_ETS_TAG : V2::ROW_ETS_TAG,
+        ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<LinearLayoutPattern>(isVertical));
+}
+
+RefPtr<FrameNode> CreateBlankNode(float width, float height)
+{
+    auto node = FrameNode::CreateFrameNode(
+        V2::BLANK_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<Pattern>());
+    node->GetLayoutProperty()->UpdateCalcSelfIdealSize(CalcSize(CalcLength(width), CalcLength(height)));
+    return node;
+}
+
+// Grid of rows, built by the render function of a custom node as a page of an app.
+RefPtr<UINode> BuildGridPage(int32_t rowCount, int32_t columnCount)
+{
+    auto column = CreateLinearNode(true);
+    for (int32_t row = 0; row < rowCount; ++row) {
+        auto rowNode = CreateLinearNode(false);
+        for (int32_t index = 0; index < columnCount; ++index) {
+            CreateBlankNode(PAGE_ITEM_SIZE, PAGE_ITEM_SIZE)->MountToParent(rowNode);
+        }
+        rowNode->MountToParent(column);
+    }
+    return column;
+}
+
+RefPtr<CustomNode> CreateGridPage(int32_t rowCount, int32_t columnCount)
+{
+    auto customNode = CustomNode::CreateCustomNode(ElementRegister::GetInstance()->MakeUniqueId(), "GridPage");
+    customNode->SetRenderFunction(
+        [rowCount, columnCount]() -> RefPtr<UINode> { return BuildGridPage(rowCount, columnCount); });
+    return customNode;
+}
+
+class BenchmarkLazyForEachBuilder final : public LazyForEachBuilder {
+    DECLARE_ACE_TYPE(BenchmarkLazyForEachBuilder, LazyForEachBuilder);
+
+public:
+    explicit BenchmarkLazyForEachBuilder(int32_t totalCount) : totalCount_(totalCount) {}
+    ~BenchmarkLazyForEachBuilder() override = default;
+
+    void ReleaseChildGroupById(const std::string& id) override {}
+    void RegisterDataChangeListener(const RefPtr<V2::DataChangeListener>& listener) override {}
+    void UnregisterDataChangeListener(const RefPtr<V2::DataChangeListener>& listener) override {}
+
+protected:
+    int32_t OnGetTotalCount() override
+    {
+        return totalCount_;
+    }
+
+    std::pair<std::string, RefPtr<UINode>> OnGetChildByIndex(int32_t index) override
+    {
+        auto item = CreateLinearNode(false);
+        CreateBlankNode(LIST_ITEM_HEIGHT, LIST_ITEM_HEIGHT)->MountToParent(item);
+        CreateBlankNode(ROOT_WIDTH - LIST_ITEM_HEIGHT, LIST_ITEM_HEIGHT)->MountToParent(item);
+        return { OnGetKeyByIndex(index), item };
+    }
+
+    std::string OnGetKeyByIndex(int32_t index) override
+    {
+        return std::to_string(index);
+    }
+
+private:
+    int32_t totalCount_ = 0;
+};
+
+// Resize the nodes along an ease curve on every frame, as a property animation of their size.
+class ResizeAnimationTask final : public ScheduleTask {
+    DECLARE_ACE_TYPE(ResizeAnimationTask, ScheduleTask);
+
+public:
+    explicit ResizeAnimationTask(std::vector<RefPtr<FrameNode>>&& nodes) : nodes_(std::move(nodes)) {}
+    ~ResizeAnimationTask() override = default;
+
+    void OnFrame(uint64_t nanoTimestamp) override
+    {
+        auto time = static_cast<float>(frame_++ % ANIMATION_FRAMES) / ANIMATION_FRAMES;
+        auto width = ANIMATED_MIN_WIDTH + (ANIMATED_MAX_WIDTH - ANIMATED_MIN_WIDTH) * Curves::EASE_IN_OUT->Move(time);
+        for (const auto& node : nodes_) {
+            node->GetLayoutProperty()->UpdateCalcSelfIdealSize(
+                CalcSize(CalcLength(width), CalcLength(ANIMATED_NODE_HEIGHT)));
+            node->MarkDirtyNode();
+        }
+    }
+
+private:
+    std::vector<RefPtr<FrameNode>> nodes_;
+    int32_t frame_ = 0;
+};
+
+// Build, measure, layout and render a page of 10k nodes from scratch.
+void BuildPage(benchmark::State& state)
+{
+    PipelineHarness harness;
+    FrameReporter reporter(harness.GetContext());
+    for (auto _ : state) {
+        harness.PushPage(CreateGridPage(PAGE_ROW_COUNT, PAGE_COLUMN_COUNT));
+        harness.FlushFrames();
+        state.PauseTiming();
+        harness.PopPage();
+        state.ResumeTiming();
+    }
+    reporter.Report(state);
+    state.counters["nodes"] = PAGE_ROW_COUNT * PAGE_COLUMN_COUNT;
+}
+BENCHMARK(BuildPage)->Unit(benchmark::kMillisecond);
+
+// Scroll a list of 100k lazy items by a fixed delta per frame, items are built, recycled and prefetched.
+void ScrollLazyList(benchmark::State& state)
+{
+    PipelineHarness harness;
+    auto listNode = FrameNode::CreateFrameNode(
+        V2::LIST_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<ListPattern>());
+    auto listLayoutProperty = listNode->GetLayoutProperty<ListLayoutProperty>();
+    listLayoutProperty->UpdateListDirection(Axis::VERTICAL);
+    listLayoutProperty->UpdateCachedCount(LIST_CACHED_COUNT);
+    listLayoutProperty->UpdateCalcSelfIdealSize(CalcSize(CalcLength(ROOT_WIDTH), CalcLength(ROOT_HEIGHT)));
+    auto lazyForEachNode = LazyForEachNode::GetOrCreateLazyForEachNode(
+        ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<BenchmarkLazyForEachBuilder>(LIST_ITEM_COUNT));
+    lazyForEachNode->MountToParent(listNode);
+    harness.PushPage(listNode);
+    harness.FlushFrames();
+
+    auto listPattern = listNode->GetPattern<ListPattern>();
+    FrameReporter reporter(harness.GetContext());
+    for (auto _ : state) {
+        listPattern->UpdateCurrentOffset(-SCROLL_DELTA);
+        harness.FlushFrame();
+    }
+    reporter.Report(state);
+}
+BENCHMARK(ScrollLazyList)->Unit(benchmark::kMicrosecond);
+
+// Animate the size of 500 nodes in a column, every frame measures and lays out all of them.
+void AnimateNodes(benchmark::State& state)
+{
+    PipelineHarness harness;
+    auto column = CreateLinearNode(true);
+    std::vector<RefPtr<FrameNode>> nodes;
+    nodes.reserve(ANIMATED_NODE_COUNT);
+    for (int32_t index = 0; index < ANIMATED_NODE_COUNT; ++index) {
+        auto node = CreateBlankNode(ANIMATED_MIN_WIDTH, ANIMATED_NODE_HEIGHT);
+        node->MountToParent(column);
+        nodes.emplace_back(node);
+    }
+    harness.PushPage(column);
+    harness.FlushFrames();
+
+    auto task = AceType::MakeRefPtr<ResizeAnimationTask>(std::move(nodes));
+    FrameReporter reporter(harness.GetContext());
+    for (auto _ : state) {
+        // schedule tasks are taken by the frame, an animator adds itself again for the next frame.
+        harness.GetContext()->AddScheduleTask(task);
+        harness.FlushFrame();
+    }
+    reporter.Report(state);
+}
+BENCHMARK(AnimateNodes)->Unit(benchmark::kMicrosecond);
+
+// Relayout the page of 10k nodes when the window is rotated.
+void RotatePage(benchmark::State& state)
+{
+    PipelineHarness harness;
+    harness.PushPage(CreateGridPage(PAGE_ROW_COUNT, PAGE_COLUMN_COUNT));
+    harness.FlushFrames();
+
+    FrameReporter reporter(harness.GetContext());
+    for (auto _ : state) {
+        harness.Rotate();
+        harness.FlushFrames();
+    }
+    reporter.Report(state);
+}
+BENCHMARK(RotatePage)->Unit(benchmark::kMillisecond);
+
+// Touch down and up on pages of different count of nodes, the frame runs the touch test of the down event.
+void TouchTest(benchmark::State& state)
+{
+    auto rowCount = static_cast<int32_t>(state.range(0));
+    PipelineHarness harness;
+    harness.PushPage(CreateGridPage(rowCount, PAGE_COLUMN_COUNT));
+    harness.FlushFrames();
+
+    const auto& context = harness.GetContext();
+    FrameReporter reporter(context);
+    float x = 0.0f;
+    for (auto _ : state) {
+        x = x + PAGE_ITEM_SIZE > PAGE_COLUMN_COUNT * PAGE_ITEM_SIZE ? 0.0f : x + PAGE_ITEM_SIZE;
+        auto y = static_cast<float>(rowCount) * PAGE_ITEM_SIZE / 2;
+        TouchEvent down { 0, x, y, x, y, TouchType::DOWN, TimeStamp(std::chrono::nanoseconds(GetSysTimestamp())) };
+        down.pointers.push_back({ 0, x, y, x, y });
+        context->OnTouchEvent(down);
+        harness.FlushFrame();
+        auto up = down;
+        up.type = TouchType::UP;
+        up.time = TimeStamp(std::chrono::nanoseconds(GetSysTimestamp()));
+        context->OnTouchEvent(up);
+        harness.FlushFrame();
+    }
+    reporter.Report(state);
+    state.counters["nodes"] = rowCount * PAGE_COLUMN_COUNT;
+}
+BENCHMARK(TouchTest)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace OHOS::Ace::NG
+
+BENCHMARK_MAIN();
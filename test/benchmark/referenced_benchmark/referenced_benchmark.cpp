@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+#include "test/benchmark/common/allocation_scope.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// a page is a tree of containers, every container has a few children and every child refers to its parent weakly.
+constexpr int32_t CHILDREN_PER_NODE = 4;
+
+class PageNode final : public virtual AceType {
+    DECLARE_ACE_TYPE(PageNode, AceType);
+
+public:
+    PageNode() = default;
+    ~PageNode() override = default;
+
+    void AddChild(const RefPtr<PageNode>& child)
+    {
+        child->parent_ = WeakClaim(this);
+        children_.emplace_back(child);
+    }
+
+    const std::vector<RefPtr<PageNode>>& GetChildren() const
+    {
+        return children_;
+    }
+
+    RefPtr<PageNode> GetParent() const
+    {
+        return parent_.Upgrade();
+    }
+
+private:
+    std::vector<RefPtr<PageNode>> children_;
+    WeakPtr<PageNode> parent_;
+};
+
+RefPtr<PageNode> BuildPage(int64_t nodeCount)
+{
+    auto root = AceType::MakeRefPtr<PageNode>();
+    std::vector<RefPtr<PageNode>> containers = { root };
+    size_t containerIndex = 0;
+    for (int64_t count = 1; count < nodeCount; ++count) {
+        auto node = AceType::MakeRefPtr<PageNode>();
+        containers[containerIndex]->AddChild(node);
+        if (static_cast<int32_t>(containers[containerIndex]->GetChildren().size()) == CHILDREN_PER_NODE) {
+            ++containerIndex;
+        }
+        containers.emplace_back(std::move(node));
+    }
+    return root;
+}
+
+// Build and release a page of arg 0 nodes, the nodes and their reference counters are allocated and released.
+void BuildAndReleasePage(benchmark::State& state)
+{
+    uint64_t allocationCount = 0;
+    for (auto _ : state) {
+        AllocationScope scope;
+        auto page = BuildPage(state.range(0));
+        benchmark::DoNotOptimize(page);
+        page.Reset();
+        allocationCount += scope.GetAllocationCount();
+    }
+    auto nodeCount = static_cast<double>(state.iterations()) * static_cast<double>(state.range(0));
+    state.counters["allocs_per_node"] = static_cast<double>(allocationCount) / nodeCount;
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BuildAndReleasePage)->ArgName("nodes")->Arg(1000)->Arg(25000);
+
+void VisitUpgradeParent(const RefPtr<PageNode>& node, int64_t& checksum)
+{
+    for (const auto& child : node->GetChildren()) {
+        auto parent = child->GetParent();
+        checksum += parent ? 1 : 0;
+        VisitUpgradeParent(child, checksum);
+    }
+}
+
+// Upgrade the parent of every node, as event bubbling and dirty marking do.
+void UpgradeParents(benchmark::State& state)
+{
+    auto page = BuildPage(state.range(0));
+    int64_t checksum = 0;
+    for (auto _ : state) {
+        VisitUpgradeParent(page, checksum);
+    }
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(UpgradeParents)->ArgName("nodes")->Arg(1000)->Arg(25000);
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "experimental/svg/model/SkSVGDOM.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "third_party/skia/include/core/SkStream.h"
+#include "third_party/skia/include/core/SkSurface.h"
+
+#include "core/components/svg/parse/svg_dom.h"
+#include "core/image/flutter_image_cache.h"
+
+namespace OHOS::Ace {
+namespace {
+
+// an icon grid page shows a few icons again and again, such as the entries of settings.
+constexpr int32_t ICON_COUNT = 24;
+constexpr int32_t GRID_COLUMNS = 8;
+constexpr int32_t GRID_ROWS = 50;
+constexpr int32_t ICON_SIZE = 48;
+constexpr size_t CACHE_COUNT_LIMIT = 500;
+
+std::string CreateIconSvg(int32_t index)
+{
+    auto radius = std::to_string(4 + index % 6);
+    auto peak = std::to_string(3 + index % 9);
+    return "<svg width=\"24\" height=\"24\" viewBox=\"0 0 24 24\" xmlns=\"http://www.w3.org/2000/svg\">"
+           "<style>.stroke{stroke:#182431;stroke-width:1.5;fill:none}</style>"
+           "<g fill-rule=\"evenodd\">"
+           "<rect class=\"stroke\" x=\"3\" y=\"3\" width=\"18\" height=\"18\" rx=\"4\"/>"
+           "<circle class=\"stroke\" cx=\"12\" cy=\"12\" r=\"" + radius + "\"/>"
+           "<path style=\"fill:#0A59F7;opacity:0.9\" d=\"M6 18 L12 " + peak + " L18 18 Z\"/>"
+           "<line class=\"stroke\" x1=\"6\" y1=\"20\" x2=\"18\" y2=\"20\"/>"
+           "</g></svg>";
+}
+
+struct IconGrid {
+    IconGrid()
+    {
+        for (int32_t index = 0; index < ICON_COUNT; ++index) {
+            auto svg = CreateIconSvg(index);
+            icons.emplace_back(SkData::MakeWithCopy(svg.data(), svg.size()));
+            keys.emplace_back("resource:///media/icon_" + std::to_string(index) + ".svg");
+        }
+    }
+
+    int32_t GetIconIndex(int32_t slot) const
+    {
+        return slot % ICON_COUNT;
+    }
+
+    std::vector<sk_sp<SkData>> icons;
+    std::vector<std::string> keys;
+};
+
+const IconGrid& GetIconGrid()
+{
+    static IconGrid grid;
+    return grid;
+}
+
+RefPtr<ImageCache> CreateImageCache()
+{
+    auto imageCache = ImageCache::Create();
+    imageCache->SetCapacity(CACHE_COUNT_LIMIT);
+    return imageCache;
+}
+
+void ReportCacheStats(benchmark::State& state, const ImageCacheStats& stats)
+{
+    auto total = stats.hits + stats.misses;
+    state.counters["hit_ratio"] = total == 0 ? 0.0 : static_cast<double>(stats.hits) / static_cast<double>(total);
+    state.counters["cache_bytes"] = static_cast<double>(stats.size);
+}
+
+// Load svg doms of every image on the page. Arg 0 parses each image, arg 1 clones the cached dom of the same icon,
+// which translates its xml dom without parsing it again.
+void LoadIconGrid(benchmark::State& state)
+{
+    const auto& grid = GetIconGrid();
+    bool useCache = state.range(0) != 0;
+    auto imageCache = CreateImageCache();
+    std::vector<RefPtr<SvgDom>> page;
+    page.reserve(GRID_COLUMNS * GRID_ROWS);
+    for (auto _ : state) {
+        page.clear();
+        for (int32_t slot = 0; slot < GRID_COLUMNS * GRID_ROWS; ++slot) {
+            auto index = grid.GetIconIndex(slot);
+            auto parsedDom = useCache ? imageCache->GetCacheSvgDom(grid.keys[index]) : nullptr;
+            if (!parsedDom) {
+                SkMemoryStream stream(grid.icons[index]);
+                parsedDom = SvgDom::CreateSvgDom(stream, WeakPtr<PipelineContext>(), std::nullopt);
+                if (!parsedDom) {
+                    state.SkipWithError("parse svg failed");
+                    return;
+                }
+                if (useCache) {
+                    imageCache->CacheSvgDom(grid.keys[index], parsedDom);
+                }
+            }
+            page.emplace_back(useCache ? parsedDom->Clone() : parsedDom);
+        }
+        benchmark::DoNotOptimize(page.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * GRID_COLUMNS * GRID_ROWS);
+    ReportCacheStats(state, imageCache->GetSvgDomCacheStats());
+}
+BENCHMARK(LoadIconGrid)->ArgName("cached")->Arg(0)->Arg(1);
+
+// Draw every image of the page. Arg 0 renders the svg of each image, arg 1 draws the cached rasters of the icons.
+void DrawIconGrid(benchmark::State& state)
+{
+    const auto& grid = GetIconGrid();
+    bool useCache = state.range(0) != 0;
+    auto imageCache = CreateImageCache();
+    std::vector<sk_sp<SkSVGDOM>> icons;
+    for (const auto& data : grid.icons) {
+        SkMemoryStream stream(data);
+        auto icon = SkSVGDOM::MakeFromStream(stream, 0);
+        if (!icon) {
+            state.SkipWithError("parse svg failed");
+            return;
+        }
+        icons.emplace_back(icon);
+    }
+    auto surface = SkSurface::MakeRasterN32Premul(GRID_COLUMNS * ICON_SIZE, GRID_ROWS * ICON_SIZE);
+    if (!surface) {
+        state.SkipWithError("create surface failed");
+        return;
+    }
+    auto sizeKey = "size" + std::to_string(ICON_SIZE) + "x" + std::to_string(ICON_SIZE);
+    auto* canvas = surface->getCanvas();
+    for (auto _ : state) {
+        canvas->clear(SK_ColorWHITE);
+        for (int32_t slot = 0; slot < GRID_COLUMNS * GRID_ROWS; ++slot) {
+            auto index = grid.GetIconIndex(slot);
+            canvas->save();
+            canvas->translate(static_cast<float>(slot % GRID_COLUMNS * ICON_SIZE),
+                static_cast<float>(slot / GRID_COLUMNS * ICON_SIZE));
+            canvas->clipRect(SkRect::MakeWH(ICON_SIZE, ICON_SIZE));
+            auto& icon = icons[index];
+            icon->setContainerSize({ ICON_SIZE, ICON_SIZE });
+            if (!useCache) {
+                icon->render(canvas);
+                canvas->restore();
+                continue;
+            }
+            auto key = grid.keys[index] + sizeKey;
+            auto raster = imageCache->GetCacheSvgRaster(key);
+            if (!raster) {
+                auto iconSurface = SkSurface::MakeRasterN32Premul(ICON_SIZE, ICON_SIZE);
+                icon->render(iconSurface->getCanvas());
+                raster = std::make_shared<CachedSvgRaster>(iconSurface->makeImageSnapshot());
+                imageCache->CacheSvgRaster(key, raster);
+            }
+            canvas->drawImage(raster->image, 0, 0);
+            canvas->restore();
+        }
+        surface->flush();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * GRID_COLUMNS * GRID_ROWS);
+    ReportCacheStats(state, imageCache->GetSvgRasterCacheStats());
+}
+BENCHMARK(DrawIconGrid)->ArgName("cached")->Arg(0)->Arg(1);
+
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
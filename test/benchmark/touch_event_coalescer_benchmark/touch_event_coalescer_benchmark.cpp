@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/pipeline_ng/touch_event_coalescer.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+constexpr int64_t FRAME_PERIOD_US = 16667;
+// report rates of touch panels in Hz.
+constexpr int64_t LOW_REPORT_RATE = 120;
+constexpr int64_t MEDIUM_REPORT_RATE = 240;
+constexpr int64_t HIGH_REPORT_RATE = 480;
+constexpr int64_t MICROSECONDS_PER_SECOND = 1000000;
+
+// the trace is a series of scroll gestures, each one a drag decelerating to the release, then a pause.
+constexpr int32_t GESTURE_COUNT = 20;
+constexpr int64_t GESTURE_DURATION_US = 300000;
+constexpr int64_t GESTURE_PAUSE_US = 200000;
+constexpr float GESTURE_DISTANCE = 900.0f;
+constexpr float START_X = 360.0f;
+constexpr float START_Y = 1100.0f;
+constexpr float POINTER_SPACING = 120.0f;
+// panels report with a jitter of the interval and drop a sample now and then.
+constexpr double REPORT_JITTER = 0.15;
+constexpr double DROP_PROBABILITY = 0.02;
+constexpr uint32_t TRACE_SEED = 20221017;
+
+// Position of the finger along the gesture at time us from its start, fast at first and slowing to the release.
+float GetDistance(int64_t us)
+{
+    auto progress = static_cast<float>(us) / GESTURE_DURATION_US;
+    return GESTURE_DISTANCE * (1.0f - (1.0f - progress) * (1.0f - progress));
+}
+
+// Pointers of a pinch move apart, a single pointer scrolls up.
+Offset GetPosition(int32_t id, int64_t us)
+{
+    auto distance = GetDistance(us);
+    auto direction = id % 2 == 0 ? -1.0f : 1.0f;
+    return Offset(START_X + static_cast<float>(id) * POINTER_SPACING, START_Y + direction * distance);
+}
+
+TouchEvent CreateEvent(int32_t id, TouchType type, const Offset& position, int64_t us)
+{
+    auto x = static_cast<float>(position.GetX());
+    auto y = static_cast<float>(position.GetY());
+    TouchEvent event { id, x, y, x, y, type, TimeStamp(std::chrono::microseconds(us)) };
+    event.pointers.push_back({ id, x, y, x, y });
+    return event;
+}
+
+struct TouchTrace {
+    // events received before each frame, the frame is at (index + 1) * FRAME_PERIOD_US.
+    std::vector<std::list<TouchEvent>> frames;
+    int64_t eventCount = 0;
+};
+
+void AddEvent(TouchTrace& trace, TouchEvent&& event)
+{
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(event.time.time_since_epoch()).count();
+    auto frame = static_cast<size_t>(us / FRAME_PERIOD_US);
+    if (trace.frames.size() <= frame) {
+        trace.frames.resize(frame + 1);
+    }
+    trace.frames[frame].emplace_back(std::move(event));
+    ++trace.eventCount;
+}
+
+// Events as recorded from a touch panel with the report rate, samples of pointers are reported together.
+TouchTrace CreateTouchTrace(int64_t reportRate, int32_t pointerCount)
+{
+    std::mt19937 random(TRACE_SEED);
+    std::uniform_real_distribution<double> jitter(-REPORT_JITTER, REPORT_JITTER);
+    std::bernoulli_distribution drop(DROP_PROBABILITY);
+    auto interval = MICROSECONDS_PER_SECOND / reportRate;
+    TouchTrace trace;
+    int64_t start = FRAME_PERIOD_US / 2;
+    for (int32_t gesture = 0; gesture < GESTURE_COUNT; ++gesture) {
+        for (int32_t id = 0; id < pointerCount; ++id) {
+            AddEvent(trace, CreateEvent(id, TouchType::DOWN, GetPosition(id, 0), start));
+        }
+        int64_t us = interval;
+        while (us < GESTURE_DURATION_US) {
+            if (!drop(random)) {
+                for (int32_t id = 0; id < pointerCount; ++id) {
+                    AddEvent(trace, CreateEvent(id, TouchType::MOVE, GetPosition(id, us), start + us));
+                }
+            }
+            us += static_cast<int64_t>(static_cast<double>(interval) * (1.0 + jitter(random)));
+        }
+        for (int32_t id = 0; id < pointerCount; ++id) {
+            AddEvent(trace, CreateEvent(id, TouchType::UP, GetPosition(id, GESTURE_DURATION_US),
+                start + GESTURE_DURATION_US));
+        }
+        start += GESTURE_DURATION_US + GESTURE_PAUSE_US;
+    }
+    return trace;
+}
+
+// How steady the dispatched moves are and how old the dispatched positions are at the frame time. Judder is the
+// difference between the distance moved in a frame and the distance the finger moved in the frame period.
+struct MoveStats {
+    struct LastMove {
+        int64_t frameUs = 0;
+        double y = 0.0;
+    };
+
+    void AddMove(const TouchEvent& event, int64_t frameUs, int64_t gestureStartUs)
+    {
+        auto eventUs = std::chrono::duration_cast<std::chrono::microseconds>(event.time.time_since_epoch()).count();
+        lagSum += static_cast<double>(frameUs - eventUs);
+        ++moveCount;
+        auto& last = lastMoves[event.id];
+        if (last.frameUs == frameUs - FRAME_PERIOD_US && last.frameUs > gestureStartUs) {
+            auto moved = event.y - last.y;
+            auto fingerMoved = GetPosition(event.id, frameUs - gestureStartUs).GetY() -
+                               GetPosition(event.id, last.frameUs - gestureStartUs).GetY();
+            judderSum += std::abs(moved - fingerMoved);
+            ++judderCount;
+        }
+        last = { frameUs, event.y };
+    }
+
+    std::unordered_map<int32_t, LastMove> lastMoves;
+    int64_t dispatchedCount = 0;
+    double lagSum = 0.0;
+    int64_t moveCount = 0;
+    double judderSum = 0.0;
+    int64_t judderCount = 0;
+};
+
+void TraceArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (auto reportRate : { LOW_REPORT_RATE, MEDIUM_REPORT_RATE, HIGH_REPORT_RATE }) {
+        for (auto pointerCount : { 1, 2 }) {
+            for (auto resample : { 0, 1 }) {
+                benchmark->Args({ reportRate, pointerCount, resample });
+            }
+        }
+    }
+}
+
+// Replay the trace once and measure the dispatched moves.
+MoveStats MeasureMoves(const TouchTrace& trace, bool resample)
+{
+    auto frames = trace.frames;
+    TouchEventCoalescer coalescer;
+    coalescer.SetResampleEnabled(resample);
+    MoveStats stats;
+    int64_t gestureStart = 0;
+    for (size_t index = 0; index < frames.size(); ++index) {
+        auto frameUs = static_cast<int64_t>(index + 1) * FRAME_PERIOD_US;
+        auto events = coalescer.Coalesce(std::move(frames[index]), TimeStamp(std::chrono::microseconds(frameUs)));
+        stats.dispatchedCount += static_cast<int64_t>(events.size());
+        for (const auto& event : events) {
+            if (event.type == TouchType::DOWN) {
+                gestureStart =
+                    std::chrono::duration_cast<std::chrono::microseconds>(event.time.time_since_epoch()).count();
+            } else if (event.type == TouchType::MOVE) {
+                stats.AddMove(event, frameUs, gestureStart);
+            }
+        }
+    }
+    return stats;
+}
+
+// Replay the trace frame by frame through the coalescer. Args are the report rate of the panel, the count of pointers
+// and whether moves are resampled at the frame time. Besides the time, reports the events per frame before and after
+// coalescing, the judder of the dispatched moves and the lag of the dispatched positions.
+void ReplayTouchTrace(benchmark::State& state)
+{
+    auto reportRate = state.range(0);
+    auto pointerCount = static_cast<int32_t>(state.range(1));
+    bool resample = state.range(2) != 0;
+    const auto trace = CreateTouchTrace(reportRate, pointerCount);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto frames = trace.frames;
+        state.ResumeTiming();
+        TouchEventCoalescer coalescer;
+        coalescer.SetResampleEnabled(resample);
+        for (size_t index = 0; index < frames.size(); ++index) {
+            auto frameUs = static_cast<int64_t>(index + 1) * FRAME_PERIOD_US;
+            auto events =
+                coalescer.Coalesce(std::move(frames[index]), TimeStamp(std::chrono::microseconds(frameUs)));
+            benchmark::DoNotOptimize(events.size());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * trace.eventCount);
+
+    auto stats = MeasureMoves(trace, resample);
+    auto frameCount = static_cast<double>(trace.frames.size());
+    state.counters["events/frame"] = static_cast<double>(trace.eventCount) / frameCount;
+    state.counters["dispatched/frame"] = static_cast<double>(stats.dispatchedCount) / frameCount;
+    state.counters["judder_px"] = stats.judderSum / static_cast<double>(std::max<int64_t>(stats.judderCount, 1));
+    state.counters["lag_us"] = stats.lagSum / static_cast<double>(std::max<int64_t>(stats.moveCount, 1));
+}
+BENCHMARK(ReplayTouchTrace)->ArgNames({ "rate", "pointers", "resample" })->Apply(TraceArguments);
+
+} // namespace
+} // namespace OHOS::Ace::NG
+
+BENCHMARK_MAIN();
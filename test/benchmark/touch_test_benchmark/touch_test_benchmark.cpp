@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/base/touch_test_index.h"
+#include "core/components_ng/pattern/pattern.h"
+#include "core/components_v2/inspector/inspector_constants.h"
+#include "core/pipeline/base/element_register.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+constexpr int32_t GRID_COLUMNS = 16;
+constexpr float ITEM_SIZE = 45.0f;
+constexpr int32_t POINT_COUNT = 1024;
+constexpr uint32_t POINT_SEED = 20220915;
+
+int32_t GetRowCount(int32_t itemCount)
+{
+    return (itemCount + GRID_COLUMNS - 1) / GRID_COLUMNS;
+}
+
+// Rects of a grid of items, in the paint order of children.
+std::vector<std::optional<RectF>> CreateGridRects(int32_t itemCount)
+{
+    std::vector<std::optional<RectF>> rects;
+    rects.reserve(itemCount);
+    for (int32_t index = 0; index < itemCount; ++index) {
+        auto x = static_cast<float>(index % GRID_COLUMNS) * ITEM_SIZE;
+        auto y = static_cast<float>(index / GRID_COLUMNS) * ITEM_SIZE;
+        rects.emplace_back(RectF(x, y, ITEM_SIZE, ITEM_SIZE));
+    }
+    return rects;
+}
+
+// Touch points spread over the whole grid, the same points for every count of items.
+std::vector<PointF> CreateTouchPoints(int32_t itemCount)
+{
+    std::mt19937 random(POINT_SEED);
+    std::uniform_real_distribution<float> x(0.0f, GRID_COLUMNS * ITEM_SIZE);
+    std::uniform_real_distribution<float> y(0.0f, static_cast<float>(GetRowCount(itemCount)) * ITEM_SIZE);
+    std::vector<PointF> points;
+    points.reserve(POINT_COUNT);
+    for (int32_t index = 0; index < POINT_COUNT; ++index) {
+        points.emplace_back(x(random), y(random));
+    }
+    return points;
+}
+
+// A container of frame nodes laid out as a grid, the frame rects are set as after layout.
+RefPtr<FrameNode> CreateGridNode(int32_t itemCount)
+{
+    auto grid = FrameNode::CreateFrameNode(
+        V2::COLUMN_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<Pattern>());
+    grid->GetGeometryNode()->SetFrameSize(
+        SizeF(GRID_COLUMNS * ITEM_SIZE, static_cast<float>(GetRowCount(itemCount)) * ITEM_SIZE));
+    for (const auto& rect : CreateGridRects(itemCount)) {
+        auto item = FrameNode::CreateFrameNode(
+            V2::BLANK_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<Pattern>());
+        item->GetGeometryNode()->SetFrameOffset(rect->GetOffset());
+        item->GetGeometryNode()->SetFrameSize(rect->GetSize());
+        item->MountToParent(grid);
+    }
+    return grid;
+}
+
+// Touch test of the children one by one from the top, as FrameNode::TouchTest did before the index.
+HitTestResult LinearTouchTest(const RefPtr<FrameNode>& node, const PointF& point, const TouchRestrict& touchRestrict,
+    TouchTestResult& result)
+{
+    const auto& children = node->GetChildren();
+    for (auto iter = children.rbegin(); iter != children.rend(); ++iter) {
+        auto hitResult = (*iter)->TouchTest(point, point, touchRestrict, result);
+        if (hitResult != HitTestResult::OUT_OF_REGION) {
+            return hitResult;
+        }
+    }
+    return HitTestResult::OUT_OF_REGION;
+}
+
+void NodeCountArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (int32_t itemCount : { 64, 256, 1024, 4096, 16384 }) {
+        benchmark->Args({ itemCount, 0 });
+        benchmark->Args({ itemCount, 1 });
+    }
+}
+
+// Hit test latency of a container against its count of children. Arg 1 is 0 to test the children one by one, 1 to
+// find the candidates in TouchTestIndex through FrameNode::TouchTest.
+void HitTestGrid(benchmark::State& state)
+{
+    auto itemCount = static_cast<int32_t>(state.range(0));
+    bool useIndex = state.range(1) != 0;
+    auto grid = CreateGridNode(itemCount);
+    auto points = CreateTouchPoints(itemCount);
+    TouchRestrict touchRestrict;
+    TouchTestResult result;
+    size_t pointIndex = 0;
+    for (auto _ : state) {
+        const auto& point = points[pointIndex++ % points.size()];
+        result.clear();
+        auto hitResult = useIndex ? grid->TouchTest(point, point, touchRestrict, result)
+                                  : LinearTouchTest(grid, point, touchRestrict, result);
+        benchmark::DoNotOptimize(hitResult);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.counters["nodes"] = itemCount;
+}
+BENCHMARK(HitTestGrid)->ArgNames({ "nodes", "index" })->Apply(NodeCountArguments);
+
+// Query cost of the index alone, against the linear scan of the rects it replaces. Args same as HitTestGrid.
+void QueryGridRects(benchmark::State& state)
+{
+    auto itemCount = static_cast<int32_t>(state.range(0));
+    bool useIndex = state.range(1) != 0;
+    auto rects = CreateGridRects(itemCount);
+    auto points = CreateTouchPoints(itemCount);
+    TouchTestIndex index;
+    index.Build(CreateGridRects(itemCount));
+    std::vector<int32_t> candidates;
+    size_t pointIndex = 0;
+    for (auto _ : state) {
+        const auto& point = points[pointIndex++ % points.size()];
+        if (useIndex) {
+            index.Query(point, candidates);
+        } else {
+            candidates.clear();
+            for (int32_t item = itemCount - 1; item >= 0; --item) {
+                if (rects[item]->IsInRegion(point)) {
+                    candidates.emplace_back(item);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(candidates.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(QueryGridRects)->ArgNames({ "nodes", "index" })->Apply(NodeCountArguments);
+
+// First touch test after the children are changed, which builds the index again.
+void RebuildAndHitTest(benchmark::State& state)
+{
+    auto itemCount = static_cast<int32_t>(state.range(0));
+    auto grid = CreateGridNode(itemCount);
+    auto points = CreateTouchPoints(itemCount);
+    TouchRestrict touchRestrict;
+    TouchTestResult result;
+    size_t pointIndex = 0;
+    for (auto _ : state) {
+        const auto& point = points[pointIndex++ % points.size()];
+        result.clear();
+        grid->MarkTouchTestIndexDirty();
+        benchmark::DoNotOptimize(grid->TouchTest(point, point, touchRestrict, result));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(RebuildAndHitTest)->ArgName("nodes")->Arg(64)->Arg(1024)->Arg(16384)->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace OHOS::Ace::NG
+
+BENCHMARK_MAIN();